@@ -0,0 +1,96 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_ART_ASSETS_H_
+#define CCPROG1_ART_ASSETS_H_
+
+#include <stddef.h>
+
+#define SEPARATOR_ART_ASSET 0
+#define GAME_TITLE_ART_ASSET 1
+#define GAME_SUBTITLE_ART_ASSET 2
+#define TIER_ONE_SHIP_ART_ASSET 3
+#define TIER_TWO_SHIP_ART_ASSET 4
+#define TIER_THREE_SHIP_ART_ASSET 5
+#define TIER_FOUR_SHIP_ART_ASSET 6
+#define TONDO_BANNER_ART_ASSET 7
+#define MANILA_BANNER_ART_ASSET 8
+#define PANDAKAN_BANNER_ART_ASSET 9
+#define SAPA_BANNER_ART_ASSET 10
+#define COCONUTS_BOUGHT_BANNER_ART_ASSET 11
+#define COCONUTS_SOLD_BANNER_ART_ASSET 12
+#define RICE_BOUGHT_BANNER_ART_ASSET 13
+#define RICE_SOLD_BANNER_ART_ASSET 14
+#define SILK_BOUGHT_BANNER_ART_ASSET 15
+#define SILK_SOLD_BANNER_ART_ASSET 16
+#define GUNS_BOUGHT_BANNER_ART_ASSET 17
+#define GUNS_SOLD_BANNER_ART_ASSET 18
+#define SHIP_UPGRADE_MENU_BANNER_ART_ASSET 19
+#define SHIP_UPGRADED_BANNER_ART_ASSET 20
+#define NAVIGATION_BANNER_ART_ASSET 21
+#define TONDO_MAP_ART_ASSET 22
+#define MANILA_MAP_ART_ASSET 23
+#define PANDAKAN_MAP_ART_ASSET 24
+#define SAPA_MAP_ART_ASSET 25
+#define DEPARTED_BANNER_ART_ASSET 26
+#define DEPARTURE_POSTPONED_BANNER_ART_ASSET 27
+#define WEATHER_REPORT_BANNER_ART_ASSET 28
+#define SIGNAL_ONE_CARD_ART_ASSET 29
+#define SIGNAL_TWO_CARD_ART_ASSET 30
+#define SIGNAL_THREE_CARD_ART_ASSET 31
+#define SIGNAL_FOUR_CARD_ART_ASSET 32
+#define SIGNAL_FIVE_CARD_ART_ASSET 33
+#define VICTORY_BANNER_ART_ASSET 34
+#define VICTORY_TROPHY_ART_ASSET 35
+#define DEFEAT_BANNER_ART_ASSET 36
+
+#define ART_ASSET_COUNT 37
+
+/** A block of constant art whose length is known ahead of time, so it can be copied without being scanned or parsed. */
+typedef struct {
+  size_t nByteCount;
+  const char *pBytes;
+  const char *strName;
+} ArtAsset;
+
+/**
+ * Gets the passed art asset, which includes any color escape sequences it is drawn with.
+ * @param nArtAssetIndex The index of the art asset.
+ * @pre @p nArtAssetIndex must be less than `ART_ASSET_COUNT`.
+ * @returns The art asset, which is stored in read-only memory.
+ */
+const ArtAsset *getArtAsset(int nArtAssetIndex);
+
+/**
+ * Copies the passed art asset into the open frame and counts it towards the asset's usage, unless the output is
+ * discarded.
+ * @param nArtAssetIndex The index of the art asset.
+ * @pre @p nArtAssetIndex must be less than `ART_ASSET_COUNT`.
+ * @pre A frame must be open.
+ */
+void appendArtAsset(int nArtAssetIndex);
+
+/**
+ * Gets the number of times the passed art asset has been appended to a frame.
+ * @param nArtAssetIndex The index of the art asset.
+ * @pre @p nArtAssetIndex must be less than `ART_ASSET_COUNT`.
+ * @returns A non-negative integer value.
+ */
+long getArtAssetUseCount(int nArtAssetIndex);
+
+#endif  // CCPROG1_ART_ASSETS_H_
@@ -0,0 +1,124 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_BATCH_H_
+#define CCPROG1_BATCH_H_
+
+#include <stdint.h>
+
+#include "engine.h"
+#include "trading.h"
+
+#define BATCH_ALIGNMENT 64
+
+/**
+ * Many games stored as a structure of arrays, where index `i` of every array belongs to game `i`. All games share the
+ * same turn count because every game sails exactly once per turn, so whole turns can be advanced with loops that the
+ * compiler vectorizes.
+ */
+typedef struct {
+  int nGameCount;
+  int nPlayerTurns;
+  int nPlayerInitialBalance;
+  int nPlayerProfitTarget;
+  int32_t *pPlayerBalances;
+  int32_t *pShipCargoLimits;
+  int32_t *pShipCargoAmounts[CARGO_COUNT];
+  int32_t *pMarketPrices[CARGO_COUNT];
+  int32_t *pPortIndices;
+  int32_t *pStormTurnDurations;
+  int32_t *pIsNewStorms;
+  int32_t *pStormWindSignalNumbers;
+  int32_t *pPostponedDepartureChances;
+  uint64_t *pRandomStates;
+  uint64_t *pRandomIncrements;
+  int32_t *pDrawMasks;
+  int32_t *pFixupMasks;
+  uint32_t *pBounds;
+  uint32_t *pLowBits;
+  uint32_t *pRandomNumbers;
+  int32_t *pTargetPortIndices;
+  int32_t nDoubledExpectedPrices[PORT_COUNT][CARGO_COUNT];
+  int32_t nBestDoubledExpectedPrices[PORT_COUNT][CARGO_COUNT];
+} GameBatch;
+
+/**
+ * Allocates the aligned arrays of a batch that can hold the passed number of games.
+ * @param[out] pGameBatch The batch to allocate.
+ * @param nGameCount The number of games in the batch.
+ * @returns `0` if the batch was allocated or `-1` if it could not be.
+ */
+int createGameBatch(GameBatch *pGameBatch, int nGameCount);
+
+/**
+ * Frees the arrays of the passed batch.
+ * @param[in,out] pGameBatch The batch to free.
+ */
+void destroyGameBatch(GameBatch *pGameBatch);
+
+/**
+ * Sets up every game of the batch exactly like `initializeGame`, where game `i` is seeded with `nBaseSeed + i`.
+ * @param[in,out] pGameBatch The batch to set up.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nBaseSeed The seed of the first game.
+ */
+void initializeGameBatch(GameBatch *pGameBatch, int nPlayerInitialBalance, int nPlayerProfitTarget,
+                         uint64_t nBaseSeed);
+
+/**
+ * Generates new market prices for every game based on the price ranges of its current port. Each game jumps straight
+ * to the states of all its cargo draws, so the whole batch is generated in a single vectorized pass.
+ * @param[in,out] pGameBatch The batch whose market prices to generate.
+ */
+void generateBatchMarketPrices(GameBatch *pGameBatch);
+
+/**
+ * Applies the trades and upgrades that the greedy policy makes before sailing to every game of the batch.
+ * @param[in,out] pGameBatch The batch to trade in.
+ */
+void tradeBatchGreedily(GameBatch *pGameBatch);
+
+/**
+ * Chooses the port that the greedy policy sails to for every game of the batch.
+ * @param[in,out] pGameBatch The batch whose target port indices to set.
+ */
+void chooseBatchGreedyPorts(GameBatch *pGameBatch);
+
+/**
+ * Ends the turn of every game by sailing to its target port, advancing its weather, and generating its next market
+ * prices, which consumes random numbers in the same order as `stepGame`.
+ * @param[in,out] pGameBatch The batch to advance.
+ */
+void advanceBatchTurn(GameBatch *pGameBatch);
+
+/**
+ * Plays every game of the batch to the end with the greedy policy.
+ * @param[in,out] pGameBatch The batch to play.
+ */
+void playBatchGreedily(GameBatch *pGameBatch);
+
+/**
+ * Copies a single game of the batch into a scalar game state.
+ * @param pGameBatch The batch to copy from.
+ * @param nGameIndex The index of the game.
+ * @param[out] pGameState The game state to copy to.
+ */
+void copyBatchGameState(const GameBatch *pGameBatch, int nGameIndex, GameState *pGameState);
+
+#endif  // CCPROG1_BATCH_H_
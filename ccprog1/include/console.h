@@ -19,8 +19,14 @@
 #ifndef CCPROG1_CONSOLE_H_
 #define CCPROG1_CONSOLE_H_
 
+#include <limits.h>
+#include <stddef.h>
+
 #define CONSOLE_MAX_WIDTH 156
 
+#define INVALID_INTEGER_INPUT INT_MIN
+#define INVALID_CHARACTER_INPUT '\0'
+
 #define COLOR_DEFAULT "\033[0m"
 #define COLOR_RED "\033[0;31m"
 #define COLOR_GREEN "\033[0;32m"
@@ -51,17 +57,25 @@ void setConsoleColorToPurple(void);
 void setConsoleColorToCyan(void);
 
 /**
- * Prompts the player to input an integer into the console.
+ * Prints out the input marker that precedes the player's answer to a prompt.
  * @param nConsoleLeftPaddingSize The number of spaces to move the console cursor to the right.
- * @returns The first integer value inputted into the console.
  */
-int getIntegerInput(int nConsoleLeftPaddingSize);
+void printInputMarker(int nConsoleLeftPaddingSize);
 
 /**
- * Prompts the player to input a character into the console.
- * @param nConsoleLeftPaddingSize The number of spaces to move the console cursor to the right.
- * @returns The first character value inputted into the console.
+ * Parses the passed answer to a prompt as an integer.
+ * @param pToken The first character of the answer.
+ * @param nTokenLength The number of characters in the answer.
+ * @returns The integer in the answer, or `INVALID_INTEGER_INPUT` if the answer was not an integer.
+ */
+int parseIntegerAnswer(const char *pToken, size_t nTokenLength);
+
+/**
+ * Parses the passed answer to a prompt as a single character.
+ * @param pToken The first character of the answer.
+ * @param nTokenLength The number of characters in the answer.
+ * @returns The character in the answer, or `INVALID_CHARACTER_INPUT` if it held more than one.
  */
-char getCharacterInput(int nConsoleLeftPaddingSize);
+char parseCharacterAnswer(const char *pToken, size_t nTokenLength);
 
 #endif  // CCPROG1_CONSOLE_H_
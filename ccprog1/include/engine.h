@@ -0,0 +1,168 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_ENGINE_H_
+#define CCPROG1_ENGINE_H_
+
+#include <stdint.h>
+
+#include "random.h"
+
+#define MAXIMUM_PLAYER_TURNS 31
+
+#define INITIAL_PORT_ID 'M'
+
+#define GAME_STEP_SUCCESS 0
+#define GAME_STEP_INVALID_ACTION 1
+#define GAME_STEP_GAME_OVER 2
+
+/** The complete state of a single game, which the engine advances without performing any I/O. */
+typedef struct {
+  int nPlayerMerchantId;
+  int nPlayerInitialBalance;
+  int nPlayerBalance;
+  int nPlayerProfitTarget;
+  int nPlayerProfit;
+  int nPlayerTurns;
+  int bIsQuitting;
+  char cCurrentPortId;
+  int nShipCargoLimit;
+  int nShipCoconutCargoAmount;
+  int nShipRiceCargoAmount;
+  int nShipSilkCargoAmount;
+  int nShipGunCargoAmount;
+  int nCoconutMarketPrice;
+  int nRiceMarketPrice;
+  int nSilkMarketPrice;
+  int nGunMarketPrice;
+  int nStormTurnDuration;
+  int bIsNewStorm;
+  int nStormWindSignalNumber;
+  int nPostponedDepartureChance;
+  RandomGenerator randomGenerator;
+} GameState;
+
+/** A single complete player decision, which is the same set of choices offered by the prompts. */
+typedef struct {
+  char cActionId;
+  char cCargoId;
+  int nCargoAmount;
+  char cPortId;
+} GameAction;
+
+/** The outcome of a single game step, which contains everything the screens need to report it to the player. */
+typedef struct {
+  int nStatus;
+  int nCargoPrice;
+  int nShipCargoLimitIncrease;
+  int nShipUpgradeCost;
+  int bIsDepartureSuccessful;
+  int bHasWeatherReport;
+  int bIsNewStorm;
+  int nStormOldWindSignalNumber;
+  int nStormNewWindSignalNumber;
+  int nPostponedDepartureChance;
+  int nStormTurnDuration;
+} GameStepResult;
+
+/**
+ * Calculates the player's profit percentage based on their current and initial balance.
+ * @param nPlayerBalance The player's gold coin balance.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @returns The player's profit percentage, truncated towards zero.
+ */
+int calculatePlayerProfit(int nPlayerBalance, int nPlayerInitialBalance);
+
+/**
+ * Sets up a new game with the passed player settings and generates the market prices of the first port.
+ * @param[out] pGameState The game to set up.
+ * @param nPlayerMerchantId The player's merchant ID.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nSeed The seed of the game's random number generator.
+ */
+void initializeGame(GameState *pGameState, int nPlayerMerchantId, int nPlayerInitialBalance, int nPlayerProfitTarget,
+                    uint64_t nSeed);
+
+/**
+ * Generates new market prices for all cargo based on the price ranges of the current port.
+ * @param[in,out] pGameState The game whose market prices to generate.
+ * @pre @p pGameState must have a current port ID of `T`, `M`, `P`, or `S`.
+ */
+void generateMarketPrices(GameState *pGameState);
+
+/**
+ * Gets the total amount of cargo carried by the ship.
+ * @param pGameState The game to inspect.
+ * @returns The sum of all cargo amounts.
+ */
+int getShipTotalCargoAmount(const GameState *pGameState);
+
+/**
+ * Gets the market price of the passed cargo.
+ * @param pGameState The game to inspect.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
+ * @returns The current market price of the cargo.
+ */
+int getCargoMarketPrice(const GameState *pGameState, char cCargoId);
+
+/**
+ * Gets the amount of the passed cargo carried by the ship.
+ * @param pGameState The game to inspect.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
+ * @returns The amount of the cargo carried by the ship.
+ */
+int getShipCargoAmount(const GameState *pGameState, char cCargoId);
+
+/**
+ * Gets the cost and new cargo limit of the ship's next upgrade.
+ * @param nShipCargoLimit The current maximum amount of cargo that the ship can carry.
+ * @param[out] nShipUpgradeCost The price of upgrading the ship.
+ * @param[out] nShipNewCargoLimit The upgraded maximum amount of cargo that the ship can carry.
+ * @returns `1` if the ship can still be upgraded or `0` if it is already in the highest tier.
+ */
+int getShipUpgrade(int nShipCargoLimit, int *nShipUpgradeCost, int *nShipNewCargoLimit);
+
+/**
+ * Checks whether the passed action follows the rules of the game in its current state.
+ * @param pGameState The game to check against.
+ * @param action The action to check.
+ * @returns `1` if the action is allowed or `0` if it is not.
+ */
+int isGameActionValid(const GameState *pGameState, GameAction action);
+
+/**
+ * Checks whether the game has ended, either by exhausting all turns or by quitting.
+ * @param pGameState The game to inspect.
+ * @returns `1` if the game has ended or `0` if it has not.
+ */
+int isGameOver(const GameState *pGameState);
+
+/**
+ * Applies the passed action to the game. Navigating ends the turn, which also advances the weather and generates the
+ * next port's market prices.
+ * @param[in,out] pGameState The game to advance.
+ * @param action The action to apply.
+ * @returns The outcome of the action, whose status is `GAME_STEP_SUCCESS`, `GAME_STEP_INVALID_ACTION`, or
+ * `GAME_STEP_GAME_OVER`.
+ */
+GameStepResult stepGame(GameState *pGameState, GameAction action);
+
+#endif  // CCPROG1_ENGINE_H_
@@ -0,0 +1,101 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_FRAME_H_
+#define CCPROG1_FRAME_H_
+
+#include <stddef.h>
+
+#define FRAME_INITIAL_CAPACITY 16384
+
+/**
+ * Counters about the frames emitted so far, which measure how much data each screen sends and how long it takes. The
+ * composed size is the size of the frame as the screens built it and the frame size is what was written to the console,
+ * which only differ if differential rendering is enabled.
+ */
+typedef struct {
+  long nFrameCount;
+  size_t nLastComposedSize;
+  size_t nLastFrameSize;
+  double nLastEmitSeconds;
+  size_t nTotalComposedSize;
+  size_t nTotalFrameSize;
+  double nTotalEmitSeconds;
+} FrameStatistics;
+
+/**
+ * Starts building a frame. Frames can be nested, in which case the inner frame is appended to the outer one and only
+ * the outermost frame is emitted.
+ */
+void beginFrame(void);
+
+/**
+ * Checks whether a frame is being built.
+ * @returns `1` if text is currently appended to a frame or `0` if it is written straight to the console.
+ */
+int isFrameOpen(void);
+
+/**
+ * Appends the passed text to the open frame.
+ * @param strText The text to append.
+ * @pre A frame must be open.
+ */
+void appendFrameText(const char *strText);
+
+/**
+ * Appends the passed number of bytes to the open frame.
+ * @param pBytes The bytes to append.
+ * @param nByteCount The number of bytes to append.
+ * @pre A frame must be open.
+ */
+void appendFrameBytes(const char *pBytes, size_t nByteCount);
+
+/**
+ * Appends formatted text to the open frame, which accepts the same format as `printf`.
+ * @param strFormat The format of the text.
+ * @pre A frame must be open.
+ */
+void appendFrameFormat(const char *strFormat, ...);
+
+/**
+ * Ends the innermost frame. Ending the outermost frame writes the whole frame to the output sink with a single write.
+ * @returns `0` if the frame was written or is still nested or `-1` if the output sink could not be written to.
+ */
+int emitFrame(void);
+
+/**
+ * Enables or disables differential rendering, which only redraws the cells of the console that differ from the
+ * previous frame instead of printing every frame below the last.
+ * @param bIsEnabled Whether or not to render frames differentially.
+ * @returns `0` if the setting was applied or `-1` if the screen renderer could not be allocated.
+ */
+int setFrameDifferentialRendering(int bIsEnabled);
+
+/**
+ * Enables or disables reporting the size and time-to-emit of every frame to the standard error stream.
+ * @param bIsEnabled Whether or not to report every frame.
+ */
+void setFrameStatisticsReporting(int bIsEnabled);
+
+/**
+ * Gets the counters about the frames emitted so far.
+ * @returns The frame statistics, which stay owned by the frame builder.
+ */
+const FrameStatistics *getFrameStatistics(void);
+
+#endif  // CCPROG1_FRAME_H_
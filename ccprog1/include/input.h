@@ -0,0 +1,59 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_INPUT_H_
+#define CCPROG1_INPUT_H_
+
+#include <stddef.h>
+
+#define INPUT_BUFFER_SIZE 65536
+
+/**
+ * Opens the passed file as the input in place of the standard input, discarding anything left unread.
+ * @param strFilePath The path of the file to read.
+ * @returns `0` if the file was opened or `-1` if it could not be.
+ */
+int openInputFile(const char *strFilePath);
+
+/**
+ * Checks whether another token is left in the input, reading more of it if the buffer only holds whitespace.
+ * @returns `1` if a token is left or `0` if the input has ended.
+ */
+int hasInputToken(void);
+
+/**
+ * Reads the next whitespace-separated token from the input, which is the standard input unless a file was opened.
+ * Input is read in chunks of up to `INPUT_BUFFER_SIZE` bytes, so a pipe full of queued commands is drained with a
+ * single read. Any pending output is flushed before the reader waits for more input.
+ * @param[out] pToken The first character of the token, which stays valid until the next token is read.
+ * @param[out] nTokenLength The number of characters in the token.
+ * @returns `0` if a token was read or `-1` if the input ended first.
+ * @note A token longer than `INPUT_BUFFER_SIZE` bytes is cut into several tokens.
+ */
+int readInputToken(const char **pToken, size_t *nTokenLength);
+
+/**
+ * Parses the passed token as a decimal integer with an optional sign.
+ * @param pToken The first character of the token.
+ * @param nTokenLength The number of characters in the token.
+ * @param[out] nValue The parsed integer.
+ * @returns `0` if the whole token is an integer that fits in an `int` or `-1` if it is not.
+ */
+int parseIntegerToken(const char *pToken, size_t nTokenLength, int *nValue);
+
+#endif  // CCPROG1_INPUT_H_
@@ -0,0 +1,186 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_JOURNAL_H_
+#define CCPROG1_JOURNAL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "engine.h"
+
+#define JOURNAL_READ_SUCCESS 1
+#define JOURNAL_READ_END 0
+#define JOURNAL_READ_MALFORMED -1
+
+#define JOURNAL_KEYFRAME_TURN_INTERVAL 4
+
+/** The position of a session's start or one of its keyframes, which the trailing index of a journal lists. */
+typedef struct {
+  uint32_t nSessionIndex;
+  uint32_t nTurn;
+  uint64_t nOffset;
+} JournalIndexEntry;
+
+/**
+ * An append-only journal that records games as they are played. A journal starts with a signature and holds any
+ * number of sessions, each of which is the seed and player settings of a game followed by every action applied to it,
+ * all encoded as variable-length integers. Every `JOURNAL_KEYFRAME_TURN_INTERVAL` turns, the full state of the game is
+ * recorded as a keyframe, and closing the journal appends an index of where every session and keyframe starts.
+ */
+typedef struct {
+  FILE *pFile;
+  int bIsFlushingEveryRecord;
+  uint64_t nByteOffset;
+  long nSessionCount;
+  long nActionCount;
+  int nLastKeyframeTurn;
+  JournalIndexEntry *pIndexEntries;
+  long nIndexEntryCount;
+  long nIndexEntryCapacity;
+} ActionJournalWriter;
+
+/**
+ * A journal that is mapped into memory for replaying, which is read from the front or sought through with its index.
+ * A journal whose writer never closed it, such as after a crash, has no index but can still be read from the front.
+ */
+typedef struct {
+  const uint8_t *pBytes;
+  size_t nByteCount;
+  size_t nRecordEndOffset;
+  size_t nOffset;
+  const uint8_t *pIndexBytes;
+  long nIndexEntryCount;
+} ActionJournalReader;
+
+/** The seed and player settings that a recorded game was started with. */
+typedef struct {
+  uint64_t nSeed;
+  int nPlayerMerchantId;
+  int nPlayerInitialBalance;
+  int nPlayerProfitTarget;
+} JournalSession;
+
+/**
+ * Creates or truncates the passed file and writes the signature of a journal to it.
+ * @param[out] pActionJournalWriter The journal to open.
+ * @param strFilePath The path of the file to write to.
+ * @param bIsFlushingEveryRecord `1` to write every record to the file as soon as it is appended, which interactive
+ * games do so that a crash keeps everything played up to it, or `0` to buffer the records.
+ * @returns `0` if the journal was opened or `-1` if the file could not be written to.
+ */
+int openActionJournalWriter(ActionJournalWriter *pActionJournalWriter, const char *strFilePath,
+                            int bIsFlushingEveryRecord);
+
+/**
+ * Appends the index of the passed journal, then flushes and closes its file.
+ * @param[in,out] pActionJournalWriter The journal to close.
+ * @returns `0` if every record reached the file or `-1` if some could not be written.
+ */
+int closeActionJournalWriter(ActionJournalWriter *pActionJournalWriter);
+
+/**
+ * Appends the start of a new game to the passed journal.
+ * @param[in,out] pActionJournalWriter The journal to append to.
+ * @param session The seed and player settings of the game.
+ * @returns `0` if the session was appended or `-1` if it could not be written.
+ */
+int recordJournalSession(ActionJournalWriter *pActionJournalWriter, JournalSession session);
+
+/**
+ * Appends an action applied to the current game to the passed journal. Only the fields that the action uses are
+ * written, so most actions take two to four bytes.
+ * @param[in,out] pActionJournalWriter The journal to append to.
+ * @param action The action to append.
+ * @returns `0` if the action was appended or `-1` if it could not be written.
+ */
+int recordJournalAction(ActionJournalWriter *pActionJournalWriter, GameAction action);
+
+/**
+ * Appends the full state of the current game to the passed journal if it has reached a turn that is due for a
+ * keyframe, which is every `JOURNAL_KEYFRAME_TURN_INTERVAL` turns.
+ * @param[in,out] pActionJournalWriter The journal to append to.
+ * @param pGameState The game after its latest action.
+ * @returns `0` if the keyframe was appended or is not due or `-1` if it could not be written.
+ */
+int recordJournalKeyframe(ActionJournalWriter *pActionJournalWriter, const GameState *pGameState);
+
+/**
+ * Writes every buffered record of the passed journal to its file, so that a crash cannot lose them.
+ * @param[in,out] pActionJournalWriter The journal to flush.
+ * @returns `0` if the records were written or `-1` if they could not be.
+ */
+int flushActionJournalWriter(ActionJournalWriter *pActionJournalWriter);
+
+/**
+ * Maps the passed journal into memory and checks its signature.
+ * @param[out] pActionJournalReader The journal to open.
+ * @param strFilePath The path of the file to read.
+ * @returns `0` if the journal was opened or `-1` if the file could not be mapped or is not a journal.
+ */
+int openActionJournalReader(ActionJournalReader *pActionJournalReader, const char *strFilePath);
+
+/**
+ * Unmaps the passed journal.
+ * @param[in,out] pActionJournalReader The journal to close.
+ */
+void closeActionJournalReader(ActionJournalReader *pActionJournalReader);
+
+/**
+ * Moves the passed journal back to its first game, so that it can be replayed again.
+ * @param[in,out] pActionJournalReader The journal to rewind.
+ */
+void rewindActionJournalReader(ActionJournalReader *pActionJournalReader);
+
+/**
+ * Replays the next recorded action of the current game. Keyframes along the way are checked against the replayed
+ * game, so a journal that no longer matches the engine is reported as malformed.
+ * @param[in,out] pActionJournalReader The journal to read from.
+ * @param[in,out] pGameState The game to advance.
+ * @returns `JOURNAL_READ_SUCCESS` if an action was applied, `JOURNAL_READ_END` if the game is already over, or
+ * `JOURNAL_READ_MALFORMED` if the journal is corrupt, ends in the middle of the game, or differs from the game.
+ */
+int replayJournalAction(ActionJournalReader *pActionJournalReader, GameState *pGameState);
+
+/**
+ * Replays the next recorded game of the passed journal, applying its actions until the game is over.
+ * @param[in,out] pActionJournalReader The journal to read from.
+ * @param[out] pSession The seed and player settings of the game.
+ * @param[out] pGameState The game to replay, which holds its final state afterwards.
+ * @param[out] nActionCount The number of actions that were applied.
+ * @returns `JOURNAL_READ_SUCCESS` if a game was replayed, `JOURNAL_READ_END` if no games are left, or
+ * `JOURNAL_READ_MALFORMED` if the journal is corrupt or ends in the middle of a game, whose state is then as far as
+ * it was recorded.
+ */
+int replayJournalSession(ActionJournalReader *pActionJournalReader, JournalSession *pSession, GameState *pGameState,
+                         long *nActionCount);
+
+/**
+ * Restores the state of a recorded game at the start of the passed turn from the nearest keyframe before it, then
+ * replays the few actions after the keyframe. The journal is left at the next action, so the game can be stepped
+ * forwards with `replayJournalAction`, and backwards by seeking to an earlier turn.
+ * @param[in,out] pActionJournalReader The journal to seek through.
+ * @param nSessionIndex The index of the game, which is `0` for the first game of the journal.
+ * @param nTurn The turn to seek to, which stops at the end of the game if the game ended before it.
+ * @param[out] pGameState The restored game.
+ * @returns `0` if the game was restored or `-1` if the journal has no index, lacks the game, or is corrupt.
+ */
+int seekJournalTurn(ActionJournalReader *pActionJournalReader, long nSessionIndex, int nTurn, GameState *pGameState);
+
+#endif  // CCPROG1_JOURNAL_H_
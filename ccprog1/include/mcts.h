@@ -0,0 +1,132 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_MCTS_H_
+#define CCPROG1_MCTS_H_
+
+#include <stdint.h>
+
+#include "engine.h"
+#include "random.h"
+#include "trading.h"
+#include "transposition.h"
+
+#define MCTS_SELL_ACTION_INDEX 0
+#define MCTS_BUY_ACTION_INDEX (MCTS_SELL_ACTION_INDEX + CARGO_COUNT)
+#define MCTS_UPGRADE_ACTION_INDEX (MCTS_BUY_ACTION_INDEX + CARGO_COUNT)
+#define MCTS_NAVIGATE_ACTION_INDEX (MCTS_UPGRADE_ACTION_INDEX + 1)
+#define MCTS_ACTION_COUNT (MCTS_NAVIGATE_ACTION_INDEX + PORT_COUNT)
+
+#define MCTS_DEFAULT_EXPLORATION_CONSTANT 0.3
+#define MCTS_TRANSPOSITION_ENTRY_COUNT (1L << 16)
+#define MCTS_TRANSPOSITION_MINIMUM_VISITS 4
+
+/**
+ * A single node of a search tree, which stands for the sequence of actions leading to it within the current turn. Its
+ * value is the mean reward of its rollouts until it is expanded and the value of its best child afterwards, and its
+ * children are stored next to each other, one for each action index.
+ */
+typedef struct {
+  long nFirstChildIndex;
+  long nVisitCount;
+  double nRewardSum;
+  double nValue;
+} MctsNode;
+
+/** The search tree of a single worker, whose nodes are kept allocated between decisions. */
+typedef struct {
+  MctsNode *pNodes;
+  long nNodeCount;
+  long nNodeCapacity;
+  RandomGenerator randomGenerator;
+  uint64_t nWorldSeed;
+  double nMinimumReward;
+  double nMaximumReward;
+  long nRolloutCount;
+  long nTranspositionCount;
+} MctsTree;
+
+/**
+ * A Monte Carlo tree search that chooses between selling all of a cargo, buying as much of a cargo as possible,
+ * upgrading the ship, and navigating to a port. The tree covers the rest of the current turn, and every later turn is
+ * played out by the greedy policy. Each worker grows its own tree from the same game, and their root visit counts are
+ * summed to choose the action. Since prices only change between turns, a cargo cannot be sold in the turn it was bought
+ * or bought in the turn it was sold, which keeps the search from trading back and forth forever. Trades within a turn
+ * reach the same state in different orders, so every worker stores the value of each state it visits in a shared
+ * transposition table, and a leaf whose state was already visited `MCTS_TRANSPOSITION_MINIMUM_VISITS` times takes its
+ * value from the table instead of a rollout.
+ */
+typedef struct {
+  int nWorkerCount;
+  int nTimeBudgetMilliseconds;
+  long nRolloutBudget;
+  double nExplorationConstant;
+  MctsTree *pWorkerTrees;
+  TranspositionTable transpositionTable;
+  int nTradeTurn;
+  int nBoughtCargoMask;
+  int nSoldCargoMask;
+  long nRolloutCount;
+  long nTranspositionCount;
+  double nSearchSeconds;
+} MctsSearch;
+
+/**
+ * Allocates a search, the trees of its workers, and their transposition table.
+ * @param[out] pMctsSearch The search to allocate.
+ * @param nWorkerCount The number of worker threads, each of which grows its own tree.
+ * @param nTimeBudgetMilliseconds The time spent on each decision.
+ * @param nRolloutBudget The maximum number of rollouts that each worker plays per decision, or `0` for no limit.
+ * @param nSeed The seed of the workers' random number generators.
+ * @returns `0` if the search was allocated or `-1` if it could not be.
+ */
+int createMctsSearch(MctsSearch *pMctsSearch, int nWorkerCount, int nTimeBudgetMilliseconds, long nRolloutBudget,
+                     uint64_t nSeed);
+
+/**
+ * Frees the trees and the transposition table of the passed search.
+ * @param[in,out] pMctsSearch The search to free.
+ */
+void destroyMctsSearch(MctsSearch *pMctsSearch);
+
+/**
+ * Gets the action with the passed action index in the passed game.
+ * @param pGameState The game to get the action for.
+ * @param nActionIndex The index of the action.
+ * @param nBoughtCargoMask The cargo bought this turn, where bit `i` belongs to the cargo with cargo index `i`.
+ * @param nSoldCargoMask The cargo sold this turn, where bit `i` belongs to the cargo with cargo index `i`.
+ * @param[out] pAction The action.
+ * @pre @p nActionIndex must have an integer value within the range of `0` and the number of action indices minus one.
+ * @returns `1` if the action is valid and allowed by the search or `0` if it is not.
+ */
+int getMctsAction(const GameState *pGameState, int nActionIndex, int nBoughtCargoMask, int nSoldCargoMask,
+                  GameAction *pAction);
+
+/**
+ * Chooses an action by searching until the time or rollout budget runs out. Every rollout plays a copy of the game to
+ * the end with the greedy policy, after replacing the copy's random number generator so that the search never sees
+ * the game's real future.
+ * @param[in,out] pMctsSearch The search to use, whose rollout count, transposition count, and search time are
+ * increased.
+ * @param pGameState The game to choose an action for.
+ * @returns A valid action.
+ * @note The search remembers the cargo traded this turn, so every action it chooses must be applied to the game.
+ */
+GameAction chooseMctsAction(MctsSearch *pMctsSearch, const GameState *pGameState);
+
+#endif  // CCPROG1_MCTS_H_
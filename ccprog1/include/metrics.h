@@ -0,0 +1,171 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_METRICS_H_
+#define CCPROG1_METRICS_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "trading.h"
+
+#define TURN_METRICS_COUNTER 0
+#define BUY_METRICS_COUNTER 1
+#define SELL_METRICS_COUNTER 2
+#define UPGRADE_METRICS_COUNTER 3
+#define DEPARTURE_METRICS_COUNTER 4
+#define POSTPONED_DEPARTURE_METRICS_COUNTER 5
+#define STORM_METRICS_COUNTER 6
+#define FRAME_METRICS_COUNTER 7
+#define EMITTED_BYTE_METRICS_COUNTER 8
+#define METRICS_COUNTER_COUNT 9
+
+#define RENDER_METRICS_HISTOGRAM 0
+#define INPUT_WAIT_METRICS_HISTOGRAM 1
+#define METRICS_HISTOGRAM_COUNT 2
+
+#define METRICS_HISTOGRAM_SUB_BUCKET_BITS 4
+#define METRICS_HISTOGRAM_SUB_BUCKET_COUNT (1 << METRICS_HISTOGRAM_SUB_BUCKET_BITS)
+#define METRICS_HISTOGRAM_BUCKET_COUNT \
+  ((64 - METRICS_HISTOGRAM_SUB_BUCKET_BITS + 1) * METRICS_HISTOGRAM_SUB_BUCKET_COUNT)
+
+#define TEXT_METRICS_FORMAT_ID 'T'
+#define JSON_METRICS_FORMAT_ID 'J'
+
+/**
+ * A histogram of nanosecond durations in the style of an HDR histogram: values below the sub-bucket count are counted
+ * exactly, and every power of two above that is split into the same number of linear sub-buckets, which keeps every
+ * value within about 6% of its bucket's bounds.
+ */
+typedef struct {
+  uint64_t nBucketCounts[METRICS_HISTOGRAM_BUCKET_COUNT];
+  uint64_t nCount;
+  uint64_t nSum;
+  uint64_t nMinimum;
+  uint64_t nMaximum;
+} MetricsHistogram;
+
+/**
+ * A copy of every counter and histogram of a process, which lets another process add them up with its own and write
+ * them out.
+ */
+typedef struct {
+  uint64_t nCounters[METRICS_COUNTER_COUNT];
+  uint64_t nTradeCounts[PORT_COUNT][CARGO_COUNT];
+  MetricsHistogram histograms[METRICS_HISTOGRAM_COUNT];
+} MetricsSnapshot;
+
+/**
+ * Enables or disables recording metrics, which is disabled by default so that simulations pay nothing for them.
+ * @param bIsEnabled Whether or not to record metrics.
+ */
+void setMetricsRecording(int bIsEnabled);
+
+/**
+ * Checks whether metrics are being recorded, which callers use to skip measuring durations that would not be kept.
+ * @returns `1` if metrics are being recorded or `0` if they are not.
+ */
+int isMetricsRecording(void);
+
+/**
+ * Adds the passed amount to a counter if metrics are being recorded.
+ * @param nCounterId The ID of the counter.
+ * @param nAmount The amount to add.
+ */
+void addMetricsCounter(int nCounterId, uint64_t nAmount);
+
+/**
+ * Counts a trade at the passed port of the passed cargo if metrics are being recorded.
+ * @param cPortId The ID of the port.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cPortId must have a character value of `T`, `M`, `P`, or `S`.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
+ */
+void countMetricsTrade(char cPortId, char cCargoId);
+
+/**
+ * Records a value in a histogram if metrics are being recorded.
+ * @param nHistogramId The ID of the histogram.
+ * @param nValue The value to record, in nanoseconds.
+ */
+void recordMetricsHistogram(int nHistogramId, uint64_t nValue);
+
+/**
+ * Gets the value of a counter.
+ * @param nCounterId The ID of the counter.
+ * @returns The value of the counter.
+ */
+uint64_t getMetricsCounter(int nCounterId);
+
+/**
+ * Gets the value below which the passed percentage of a histogram's values fall.
+ * @param nHistogramId The ID of the histogram.
+ * @param nPercentile The percentage of values, from `0` to `100`.
+ * @returns The highest value of the bucket that holds the percentile, or `0` if the histogram is empty.
+ */
+uint64_t getMetricsHistogramPercentile(int nHistogramId, double nPercentile);
+
+/**
+ * Copies every counter and histogram of this process.
+ * @param[out] pMetricsSnapshot The copy.
+ */
+void copyMetrics(MetricsSnapshot *pMetricsSnapshot);
+
+/**
+ * Adds the counters and histograms of a copy to those of another, which an empty copy that is all zeroes can start as.
+ * @param[in,out] pTotalSnapshot The copy to add to.
+ * @param pMetricsSnapshot The copy to add.
+ */
+void addMetricsSnapshot(MetricsSnapshot *pTotalSnapshot, const MetricsSnapshot *pMetricsSnapshot);
+
+/**
+ * Writes every counter and histogram of a copy to the passed file.
+ * @param pFile The file to write to.
+ * @param pMetricsSnapshot The copy to write.
+ * @param cFormatId The ID of the format, which is either `TEXT_METRICS_FORMAT_ID` or `JSON_METRICS_FORMAT_ID`.
+ */
+void writeMetricsSnapshot(FILE *pFile, const MetricsSnapshot *pMetricsSnapshot, char cFormatId);
+
+/**
+ * Writes every counter and histogram to the passed file.
+ * @param pFile The file to write to.
+ * @param cFormatId The ID of the format, which is either `TEXT_METRICS_FORMAT_ID` or `JSON_METRICS_FORMAT_ID`.
+ */
+void writeMetrics(FILE *pFile, char cFormatId);
+
+/**
+ * Sets where `dumpMetrics` writes the metrics to.
+ * @param strFilePath The path of the file to overwrite on every dump, or `-` for the standard error stream.
+ * @param cFormatId The ID of the format, which is either `TEXT_METRICS_FORMAT_ID` or `JSON_METRICS_FORMAT_ID`.
+ */
+void setMetricsDump(const char *strFilePath, char cFormatId);
+
+/** Writes the metrics to the place set by `setMetricsDump`, if any, which can be registered with `atexit`. */
+void dumpMetrics(void);
+
+/**
+ * Makes `SIGUSR1` request a dump of the metrics, which is carried out by the next call to `dumpRequestedMetrics`. The
+ * signal interrupts a blocked read instead of restarting it, so that a game waiting for input still dumps its metrics.
+ * @returns `0` if the signal handler was installed or `-1` if the platform has no such signal.
+ */
+int installMetricsDumpSignal(void);
+
+/** Dumps the metrics if a dump was requested by a signal since the last dump. */
+void dumpRequestedMetrics(void);
+
+#endif  // CCPROG1_METRICS_H_
@@ -0,0 +1,123 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_OUTPUT_H_
+#define CCPROG1_OUTPUT_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+#define TTY_OUTPUT_SINK_ID 'T'
+#define MEMORY_OUTPUT_SINK_ID 'M'
+#define FILE_OUTPUT_SINK_ID 'F'
+#define NULL_OUTPUT_SINK_ID 'N'
+
+#define OUTPUT_SINK_INITIAL_CAPACITY 65536
+#define OUTPUT_CONSOLE_FLUSH_SIZE 65536
+
+/**
+ * A destination for everything the game prints. The console sink buffers the output in memory and writes it to the
+ * standard output whenever it is flushed, the memory sink captures the output in a growable buffer, the file sink
+ * writes to a file, and the null sink discards the output before it is even formatted.
+ */
+typedef struct {
+  char cSinkId;
+  FILE *pFile;
+  char *pBuffer;
+  size_t nLength;
+  size_t nCapacity;
+} OutputSink;
+
+/**
+ * Sets up a sink that writes to the standard output.
+ * @param[out] pOutputSink The sink to set up.
+ */
+void openTtyOutputSink(OutputSink *pOutputSink);
+
+/**
+ * Sets up a sink that captures everything written to it in memory.
+ * @param[out] pOutputSink The sink to set up.
+ * @returns `0` if the sink was opened or `-1` if its buffer could not be allocated.
+ */
+int openMemoryOutputSink(OutputSink *pOutputSink);
+
+/**
+ * Sets up a sink that writes to the passed file, which is created or truncated.
+ * @param[out] pOutputSink The sink to set up.
+ * @param strFilePath The path of the file to write to.
+ * @returns `0` if the sink was opened or `-1` if the file could not be opened.
+ */
+int openFileOutputSink(OutputSink *pOutputSink, const char *strFilePath);
+
+/**
+ * Sets up a sink that discards everything written to it.
+ * @param[out] pOutputSink The sink to set up.
+ */
+void openNullOutputSink(OutputSink *pOutputSink);
+
+/**
+ * Flushes and closes the file of a file sink, writes out what a console sink has buffered, or frees the buffer of a
+ * memory sink.
+ * @param[in,out] pOutputSink The sink to close.
+ */
+void closeOutputSink(OutputSink *pOutputSink);
+
+/**
+ * Empties the buffer of a memory sink so that it can capture the next frame.
+ * @param[in,out] pOutputSink The sink to empty.
+ */
+void clearOutputSink(OutputSink *pOutputSink);
+
+/**
+ * Makes every screen and prompt write to the passed sink.
+ * @param pOutputSink The sink to write to, which must stay open while it is in use, or `NULL` for the standard output.
+ */
+void setOutputSink(OutputSink *pOutputSink);
+
+/**
+ * Checks whether the current sink discards everything written to it, so that output does not need to be built at all.
+ * @returns `1` if the current sink is a null sink or `0` if it is not.
+ */
+int isOutputDiscarded(void);
+
+/**
+ * Writes the passed bytes to the current sink. The console sink buffers them along with the prompts printed around
+ * them until the game waits for input, so that a screen and its prompts reach the console with a single write.
+ * @param pBytes The bytes to write.
+ * @param nByteCount The number of bytes to write.
+ * @returns `0` if every byte was written or `-1` if the sink could not be written to.
+ */
+int writeOutput(const char *pBytes, size_t nByteCount);
+
+/**
+ * Prints formatted text to the current sink, which accepts the same format as `printf`. Nothing is formatted if the
+ * current sink is a null sink.
+ * @param strFormat The format of the text.
+ */
+void printOutput(const char *strFormat, ...);
+
+/** Writes out any text that the current sink has buffered, which must be done before waiting for input. */
+void flushOutput(void);
+
+/**
+ * Gets the number of system calls that every console sink has written with so far.
+ * @returns The number of writes.
+ */
+long getConsoleWriteCount(void);
+
+#endif  // CCPROG1_OUTPUT_H_
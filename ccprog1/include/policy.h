@@ -0,0 +1,66 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_POLICY_H_
+#define CCPROG1_POLICY_H_
+
+#include "engine.h"
+#include "random.h"
+#include "solver.h"
+
+#define RANDOM_POLICY_ID 'R'
+#define GREEDY_POLICY_ID 'G'
+#define SOLVED_POLICY_ID 'D'
+
+/**
+ * Chooses a random action that the rules allow, which is never quitting.
+ * @param pGameState The game to choose an action for.
+ * @param[in,out] pRandomGenerator The policy's own random number generator.
+ * @returns A valid action.
+ */
+GameAction chooseRandomAction(const GameState *pGameState, RandomGenerator *pRandomGenerator);
+
+/**
+ * Chooses the port that the greedy policy sails to, which is wherever the carried cargo is expected to sell for the
+ * most, or wherever the best margin can be bought if the ship is empty.
+ * @param pGameState The game to choose a port for.
+ * @returns A valid navigation action.
+ */
+GameAction chooseGreedyNavigation(const GameState *pGameState);
+
+/**
+ * Chooses an action by selling cargo worth more here than anywhere else, buying the cargo with the best expected margin
+ * at another port, and sailing to wherever the carried cargo is expected to sell for the most.
+ * @param pGameState The game to choose an action for.
+ * @returns A valid action.
+ */
+GameAction chooseGreedyAction(const GameState *pGameState);
+
+/**
+ * Chooses an action using the passed policy.
+ * @param cPolicyId The ID of the policy.
+ * @param pGameState The game to choose an action for.
+ * @param[in,out] pRandomGenerator The policy's own random number generator.
+ * @param pSolvedPolicy The solved policy, which is only used by the `D` policy.
+ * @pre @p cPolicyId must have a character value of `R`, `G`, or `D`.
+ * @returns A valid action.
+ */
+GameAction choosePolicyAction(char cPolicyId, const GameState *pGameState, RandomGenerator *pRandomGenerator,
+                              const SolvedPolicy *pSolvedPolicy);
+
+#endif  // CCPROG1_POLICY_H_
@@ -46,43 +46,68 @@
 #define PANDAKAN_PORT_ID 'P'
 #define SAPA_PORT_ID 'S'
 
+/** Prints out the prompt for the player's preferred merchant ID, followed by the input marker. */
+void printMerchantIdPrompt(void);
+
+/**
+ * Checks the player's answer to the merchant ID prompt, printing out why it was rejected and the input marker again if
+ * it is not valid.
+ * @param nGivenMerchantId The answer, which is `INVALID_INTEGER_INPUT` if it was not an integer.
+ * @returns `1` if the answer is valid or `0` if it is not.
+ */
+int checkMerchantIdAnswer(int nGivenMerchantId);
+
+/** Prints out the prompt for the number of gold coins the player wants to start with, followed by the input marker. */
+void printInitialBalancePrompt(void);
+
+/**
+ * Checks the player's answer to the initial balance prompt, printing out why it was rejected and the input marker again
+ * if it is not valid.
+ * @param nGivenInitialBalance The answer, which is `INVALID_INTEGER_INPUT` if it was not an integer.
+ * @returns `1` if the answer is valid or `0` if it is not.
+ */
+int checkInitialBalanceAnswer(int nGivenInitialBalance);
+
+/** Prints out the prompt for the player's desired profit target, followed by the input marker. */
+void printProfitTargetPrompt(void);
+
 /**
- * Prompts the player to input their preferred merchant ID.
- * @returns An integer value within the range of `0` and `999`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * Checks the player's answer to the profit target prompt, printing out why it was rejected and the input marker again
+ * if it is not valid.
+ * @param nGivenProfitTarget The answer, which is `INVALID_INTEGER_INPUT` if it was not an integer.
+ * @returns `1` if the answer is valid or `0` if it is not.
  */
-int promptPlayerForMerchantId(void);
+int checkProfitTargetAnswer(int nGivenProfitTarget);
+
+/** Prints out the prompt for a confirmation of the player's prior decision, followed by the input marker. */
+void printConfirmationPrompt(void);
 
 /**
- * Prompts the player to input the number of gold coins they want to start with.
- * @returns An integer value greater than `0`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * Checks the player's answer to the confirmation prompt, printing out why it was rejected and the input marker again if
+ * it is not valid.
+ * @param cGivenBooleanId The answer in uppercase, which is `INVALID_CHARACTER_INPUT` if it was not a single character.
+ * @returns `1` if the answer is valid or `0` if it is not.
  */
-int promptPlayerForInitialBalance(void);
+int checkConfirmationAnswer(char cGivenBooleanId);
 
 /**
- * Prompts the player to input their desired profit target.
- * @returns An integer value greater than `20`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * Sets whether the continuation prompts are skipped, which scripted games do since their moves have no pauses.
+ * @param bIsSkipping `1` to skip the continuation prompts or `0` to show them.
  */
-int promptPlayerForProfitTarget(void);
+void setContinuationSkipping(int bIsSkipping);
 
 /**
- * Prompts the player to input a confirmation of their prior decision.
- * @returns `1` if the player confirms or `0` if they do not.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * Checks whether the continuation prompts are skipped.
+ * @returns `1` if the continuation prompts are skipped or `0` if they are shown.
  */
-int promptPlayerForConfirmation(void);
+int isContinuationSkipping(void);
 
-/** Prompts the player to press the enter or return key to continue the game. */
-void promptPlayerForContinuation(void);
+/** Prints out the prompt for the player to press the enter or return key, followed by the input marker. */
+void printContinuationPrompt(void);
 
 /**
- * Prompts the player to input the ID of the action they want to do.
+ * Prints out the prompt for the ID of the action the player wants to do, which only lists the actions they can afford,
+ * followed by the input marker.
  * @param nShipTotalCargoAmount The total amount of cargo carried by the ship.
  * @param nShipCargoLimit The maximum amount of cargo that the ship can carry.
  * @param nPlayerBalance The player's gold coin balance.
@@ -90,14 +115,29 @@ void promptPlayerForContinuation(void);
  * @param nRiceMarketPrice The market price of rice.
  * @param nSilkMarketPrice The market price of silk.
  * @param nGunMarketPrice The market price of guns.
- * @returns A character value of `B` for the buy screen, `S` for the sell screen, `U` for the ship upgrade screen, `N`
- * for the navigation screen, or `Q` for quitting the game.
  */
-char promptPlayerForActionId(int nShipTotalCargoAmount, int nShipCargoLimit, int nPlayerBalance,
-                             int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice);
+void printActionIdPrompt(int nShipTotalCargoAmount, int nShipCargoLimit, int nPlayerBalance, int nCoconutMarketPrice,
+                         int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice);
 
 /**
- * Prompts the player to input the ID of the cargo they want to trade.
+ * Checks the player's answer to the action prompt, printing out why it was rejected and the input marker again if it is
+ * not valid.
+ * @param cChosenActionId The answer in uppercase, which is `INVALID_CHARACTER_INPUT` if it was not a single character.
+ * @param nShipTotalCargoAmount The total amount of cargo carried by the ship.
+ * @param nShipCargoLimit The maximum amount of cargo that the ship can carry.
+ * @param nPlayerBalance The player's gold coin balance.
+ * @param nCoconutMarketPrice The market price of coconuts.
+ * @param nRiceMarketPrice The market price of rice.
+ * @param nSilkMarketPrice The market price of silk.
+ * @param nGunMarketPrice The market price of guns.
+ * @returns `1` if the answer is valid or `0` if it is not.
+ */
+int checkActionIdAnswer(char cChosenActionId, int nShipTotalCargoAmount, int nShipCargoLimit, int nPlayerBalance,
+                        int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice);
+
+/**
+ * Prints out the prompt for the ID of the cargo the player wants to trade, which only lists the cargo they can trade,
+ * followed by the input marker.
  * @param cTransactionTypeId The ID of the type of transaction to make.
  * @param nPlayerBalance The player's gold coin balance.
  * @param nCoconutMarketPrice The market price of coconuts.
@@ -109,15 +149,43 @@ char promptPlayerForActionId(int nShipTotalCargoAmount, int nShipCargoLimit, int
  * @param nShipSilkCargoAmount The amount of silk cargo carried by the ship.
  * @param nShipGunCargoAmount The amount of gun cargo carried by the ship.
  * @pre @p cTransactionTypeId must have a character value of either `B` or `S`.
- * @returns A character value of `C` for coconut, `R` for rice, `S` for silk, `G` for gun, or `X` for returning to the
- * main menu.
  */
-char promptPlayerForCargoId(char cTransactionTypeId, int nPlayerBalance, int nCoconutMarketPrice, int nRiceMarketPrice,
-                            int nSilkMarketPrice, int nGunMarketPrice, int nShipCoconutCargoAmount,
-                            int nShipRiceCargoAmount, int nShipSilkCargoAmount, int nShipGunCargoAmount);
+void printCargoIdPrompt(char cTransactionTypeId, int nPlayerBalance, int nCoconutMarketPrice, int nRiceMarketPrice,
+                        int nSilkMarketPrice, int nGunMarketPrice, int nShipCoconutCargoAmount,
+                        int nShipRiceCargoAmount, int nShipSilkCargoAmount, int nShipGunCargoAmount);
 
 /**
- * Prompts the player to input the amount of cargo they want to trade.
+ * Checks the player's answer to the cargo prompt, printing out why it was rejected and the input marker again if it is
+ * not valid.
+ * @param cChosenCargoId The answer in uppercase, which is `INVALID_CHARACTER_INPUT` if it was not a single character.
+ * @param cTransactionTypeId The ID of the type of transaction to make.
+ * @param nPlayerBalance The player's gold coin balance.
+ * @param nCoconutMarketPrice The market price of coconuts.
+ * @param nRiceMarketPrice The market price of rice.
+ * @param nSilkMarketPrice The market price of silk.
+ * @param nGunMarketPrice The market price of guns.
+ * @param nShipCoconutCargoAmount The amount of coconut cargo carried by the ship.
+ * @param nShipRiceCargoAmount The amount of rice cargo carried by the ship.
+ * @param nShipSilkCargoAmount The amount of silk cargo carried by the ship.
+ * @param nShipGunCargoAmount The amount of gun cargo carried by the ship.
+ * @pre @p cTransactionTypeId must have a character value of either `B` or `S`.
+ * @returns `1` if the answer is valid or `0` if it is not.
+ */
+int checkCargoIdAnswer(char cChosenCargoId, char cTransactionTypeId, int nPlayerBalance, int nCoconutMarketPrice,
+                       int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice, int nShipCoconutCargoAmount,
+                       int nShipRiceCargoAmount, int nShipSilkCargoAmount, int nShipGunCargoAmount);
+
+/**
+ * Prints out the prompt for the amount of cargo the player wants to trade, followed by the input marker.
+ * @param cTransactionTypeId The ID of the type of transaction to make.
+ * @pre @p cTransactionTypeId must have a character value of either `B` or `S`.
+ */
+void printCargoAmountPrompt(char cTransactionTypeId);
+
+/**
+ * Checks the player's answer to the cargo amount prompt, printing out why it was rejected and the input marker again if
+ * it is not valid.
+ * @param nGivenCargoAmount The answer, which is `INVALID_INTEGER_INPUT` if it was not an integer.
  * @param cTransactionTypeId The ID of the type of transaction to make.
  * @param nShipCargoLimit The maximum amount of cargo that the ship can carry.
  * @param cCargoId The ID of the traded cargo.
@@ -132,32 +200,42 @@ char promptPlayerForCargoId(char cTransactionTypeId, int nPlayerBalance, int nCo
  * @param nShipGunCargoAmount The amount of gun cargo carried by the ship.
  * @pre @p cTransactionTypeId must have a character value of either `B` or `S`.
  * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
- * @returns An integer value greater than `0`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * @returns `1` if the answer is valid or `0` if it is not.
  */
-int promptPlayerForCargoAmount(char cTransactionTypeId, int nShipCargoLimit, char cCargoId, int nPlayerBalance,
-                               int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice,
-                               int nShipCoconutCargoAmount, int nShipRiceCargoAmount, int nShipSilkCargoAmount,
-                               int nShipGunCargoAmount);
+int checkCargoAmountAnswer(int nGivenCargoAmount, char cTransactionTypeId, int nShipCargoLimit, char cCargoId,
+                           int nPlayerBalance, int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice,
+                           int nGunMarketPrice, int nShipCoconutCargoAmount, int nShipRiceCargoAmount,
+                           int nShipSilkCargoAmount, int nShipGunCargoAmount);
+
+/** Prints out the prompt for whether the player wants to upgrade their ship, followed by the input marker. */
+void printShipUpgradePrompt(void);
 
 /**
- * Prompts the player to input a confirmation on whether they want to upgrade their ship or not.
+ * Checks the player's answer to the ship upgrade prompt, printing out why it was rejected and the input marker again if
+ * it is not valid.
+ * @param cGivenBooleanId The answer in uppercase, which is `INVALID_CHARACTER_INPUT` if it was not a single character.
  * @param nShipCurrentCargoLimit The current maximum amount of cargo that the ship can carry.
  * @param nPlayerBalance The player's gold coin balance.
- * @returns `1` if the player wants to upgrade or `0` if they do not.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * @returns `1` if the answer is valid or `0` if it is not.
+ */
+int checkShipUpgradeAnswer(char cGivenBooleanId, int nShipCurrentCargoLimit, int nPlayerBalance);
+
+/**
+ * Prints out the prompt for the ID of the port the player wants to navigate to, which lists every port but the current
+ * one, followed by the input marker.
+ * @param cCurrentPortId The ID of the current port.
+ * @pre @p cCurrentPortId must have a character value of `T`, `M`, `P`, or `S`.
  */
-int promptPlayerForShipUpgrade(int nShipCurrentCargoLimit, int nPlayerBalance);
+void printPortIdPrompt(char cCurrentPortId);
 
 /**
- * Prompts the player to input the ID of the port they want to navigate to.
+ * Checks the player's answer to the port prompt, printing out why it was rejected and the input marker again if it is
+ * not valid.
+ * @param cChosenPortId The answer in uppercase, which is `INVALID_CHARACTER_INPUT` if it was not a single character.
  * @param cCurrentPortId The ID of the current port.
  * @pre @p cCurrentPortId must have a character value of `T`, `M`, `P`, or `S`.
- * @returns A character value of `T` for Tondo, `M` for Manila, `P` for Pandakan, `S` for Sapa, or `X` for returning to
- * the main menu.
+ * @returns `1` if the answer is valid or `0` if it is not.
  */
-char promptPlayerForPortId(char cCurrentPortId);
+int checkPortIdAnswer(char cChosenPortId, char cCurrentPortId);
 
 #endif  // CCPROG1_PROMPTS_H_
@@ -0,0 +1,100 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_RANDOM_H_
+#define CCPROG1_RANDOM_H_
+
+#include <stdint.h>
+
+#define PCG_MULTIPLIER 6364136223846793005ULL
+
+#define RANDOM_LOOKAHEAD_COUNT 4
+
+/** A PCG32 random number generator, which each game owns so that games can be reproduced and run in parallel. */
+typedef struct {
+  uint64_t nState;
+  uint64_t nIncrement;
+} RandomGenerator;
+
+/**
+ * The multipliers that jump a state ahead by the number of steps at each index, which is `PCG_MULTIPLIER` raised to
+ * that number.
+ */
+extern const uint64_t PCG_JUMP_MULTIPLIERS[RANDOM_LOOKAHEAD_COUNT + 1];
+
+/** The factors of the increment that are added when jumping a state ahead by the number of steps at each index. */
+extern const uint64_t PCG_JUMP_INCREMENT_FACTORS[RANDOM_LOOKAHEAD_COUNT + 1];
+
+/**
+ * Permutes a state into its random number, which is the output function of PCG32 (XSH-RR).
+ * @param nState The state to permute.
+ * @returns An integer value within the full range of `uint32_t`.
+ */
+static inline uint32_t permuteRandomState(uint64_t nState) {
+  uint32_t nXorShifted = (uint32_t)(((nState >> 18) ^ nState) >> 27);
+  uint32_t nRotation = (uint32_t)(nState >> 59);
+
+  return (nXorShifted >> nRotation) | (nXorShifted << ((0u - nRotation) & 31));
+}
+
+/**
+ * Seeds the passed random number generator, which always produces the same sequence for the same seed.
+ * @param[out] pRandomGenerator The random number generator to seed.
+ * @param nSeed The seed of the sequence.
+ */
+void seedRandomGenerator(RandomGenerator *pRandomGenerator, uint64_t nSeed);
+
+/**
+ * Parses a seed passed on the command line, which must be a decimal number that fits in 64 bits so that a mistyped seed
+ * is not silently played as another one.
+ * @param strSeed The text of the seed.
+ * @param[out] pSeed The seed.
+ * @returns `0` if the seed was parsed or `-1` if the text is not such a number.
+ */
+int parseRandomSeed(const char *strSeed, uint64_t *pSeed);
+
+/**
+ * Generates the next random number in the sequence.
+ * @param[in,out] pRandomGenerator The random number generator to advance.
+ * @returns An integer value within the full range of `uint32_t`.
+ */
+uint32_t generateRandomNumber(RandomGenerator *pRandomGenerator);
+
+/**
+ * Generates an unbiased random number below the passed bound using multiply-shift sampling.
+ * @param[in,out] pRandomGenerator The random number generator to advance.
+ * @param nBound The exclusive upper bound.
+ * @pre @p nBound must have a positive integer value.
+ * @returns An integer value within the range of `0` and `nBound - 1`.
+ */
+uint32_t generateBoundedRandomNumber(RandomGenerator *pRandomGenerator, uint32_t nBound);
+
+/**
+ * Generates an unbiased random number below each of the passed bounds, which gives exactly the same numbers as calling
+ * `generateBoundedRandomNumber` once per bound. Up to `RANDOM_LOOKAHEAD_COUNT` states are jumped to at once, so the
+ * draws do not wait on each other.
+ * @param[in,out] pRandomGenerator The random number generator to advance.
+ * @param pBounds The exclusive upper bound of each random number.
+ * @param[out] pRandomNumbers The generated random numbers.
+ * @param nCount The number of random numbers to generate.
+ * @pre Every bound in @p pBounds must have a positive integer value.
+ */
+void generateBoundedRandomNumbers(RandomGenerator *pRandomGenerator, const uint32_t *pBounds, uint32_t *pRandomNumbers,
+                                  int nCount);
+
+#endif  // CCPROG1_RANDOM_H_
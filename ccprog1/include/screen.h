@@ -0,0 +1,84 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_SCREEN_H_
+#define CCPROG1_SCREEN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SCREEN_MAX_ROWS 128
+#define SCREEN_MAX_COLUMNS 192
+
+#define SCREEN_MAXIMUM_REWRITTEN_CELL_COUNT 4
+
+/** A single character cell of the console, which holds one UTF-8 encoded glyph and the color it is drawn with. */
+typedef struct {
+  uint32_t nGlyph;
+  uint8_t nColorIndex;
+} ScreenCell;
+
+/**
+ * A model of the console that draws a frame by only updating the cells that differ from the previous frame. The front
+ * grid holds what the console currently shows and the back grid holds the frame being drawn.
+ */
+typedef struct {
+  ScreenCell *pFrontCells;
+  ScreenCell *pBackCells;
+  int nFrontEndRow;
+  int nFrontEndColumn;
+  int bIsFrontValid;
+  char *pOutput;
+  size_t nOutputLength;
+  size_t nOutputCapacity;
+} ScreenRenderer;
+
+/**
+ * Allocates the cell grids of a screen renderer. The first frame it renders clears the console and draws every cell.
+ * @param[out] pScreenRenderer The screen renderer to set up.
+ * @returns `0` if the screen renderer was created or `-1` if its grids could not be allocated.
+ */
+int createScreenRenderer(ScreenRenderer *pScreenRenderer);
+
+/**
+ * Frees the cell grids and output buffer of a screen renderer.
+ * @param[in,out] pScreenRenderer The screen renderer to destroy.
+ */
+void destroyScreenRenderer(ScreenRenderer *pScreenRenderer);
+
+/**
+ * Forgets what the console currently shows, so that the next frame clears the console and is drawn in full.
+ * @param[in,out] pScreenRenderer The screen renderer to reset.
+ */
+void resetScreenRenderer(ScreenRenderer *pScreenRenderer);
+
+/**
+ * Lays out the passed frame on the back grid and encodes the escape sequences that turn the front grid into it. The
+ * frame is anchored to the top left of the console, and everything after the end of the previous frame, such as the
+ * prompts printed below it, is cleared first. Text past the last row or column of the grid is dropped.
+ * @param[in,out] pScreenRenderer The screen renderer to draw with.
+ * @param pFrameBytes The frame, which may only contain text, newlines, and the color escape sequences of `console.h`.
+ * @param nFrameByteCount The number of bytes in the frame.
+ * @param[out] pOutputBytes The bytes to write to the console, which stay owned by the screen renderer.
+ * @param[out] nOutputByteCount The number of bytes to write to the console.
+ * @returns `0` if the frame was encoded or `-1` if the output buffer could not grow.
+ */
+int renderScreenFrame(ScreenRenderer *pScreenRenderer, const char *pFrameBytes, size_t nFrameByteCount,
+                      const char **pOutputBytes, size_t *nOutputByteCount);
+
+#endif  // CCPROG1_SCREEN_H_
@@ -0,0 +1,67 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_SCRIPTED_PLAYER_H_
+#define CCPROG1_SCRIPTED_PLAYER_H_
+
+#define SETUP_FRAME_KIND 0
+#define MENU_FRAME_KIND 1
+#define CARGO_FRAME_KIND 2
+#define AMOUNT_FRAME_KIND 3
+#define CONFIRMATION_FRAME_KIND 4
+#define CONTINUATION_FRAME_KIND 5
+#define PORT_FRAME_KIND 6
+#define UPGRADE_FRAME_KIND 7
+#define END_FRAME_KIND 8
+#define FRAME_KIND_COUNT 9
+
+#define SCRIPTED_ANSWER_SIZE 8
+
+/** A prompt that the game can end a frame with, along with the kind of frame it marks and the scripted answer. */
+typedef struct {
+  const char *strText;
+  int nFrameKind;
+  const char *strAnswer;
+} ScriptedPrompt;
+
+/**
+ * Gets the name of the passed kind of frame.
+ * @param nFrameKind The kind of frame.
+ * @returns The name of the kind of frame.
+ */
+const char *getFrameKindName(int nFrameKind);
+
+/**
+ * Finds the prompt that the frame ends with.
+ * @param strFrame The output of the frame.
+ * @param[out] strPromptText The position of the prompt in the frame.
+ * @returns The prompt, or `NULL` if the frame has none.
+ */
+const ScriptedPrompt *findScriptedPrompt(const char *strFrame, const char **strPromptText);
+
+/**
+ * Chooses the answer to the prompt that the frame ends with. Every day, the player buys and sells one unit of the first
+ * cargo offered, if they can, then sails to the first port offered.
+ * @param pPrompt The prompt to answer.
+ * @param strPromptText The prompt in the frame.
+ * @param[in,out] nDayStep How far the player is through the plan of the current day, which starts at `0`.
+ * @param[out] strAnswer The answer, which holds room for `SCRIPTED_ANSWER_SIZE` characters.
+ */
+void chooseScriptedAnswer(const ScriptedPrompt *pPrompt, const char *strPromptText, int *nDayStep, char *strAnswer);
+
+#endif  // CCPROG1_SCRIPTED_PLAYER_H_
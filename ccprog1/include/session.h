@@ -0,0 +1,85 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_SESSION_H_
+#define CCPROG1_SESSION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "engine.h"
+#include "journal.h"
+
+#define AWAIT_MERCHANT_ID_SESSION_STATE 0
+#define AWAIT_INITIAL_BALANCE_SESSION_STATE 1
+#define AWAIT_PROFIT_TARGET_SESSION_STATE 2
+#define AWAIT_ACTION_SESSION_STATE 3
+#define AWAIT_CARGO_SESSION_STATE 4
+#define AWAIT_AMOUNT_SESSION_STATE 5
+#define AWAIT_CONFIRMATION_SESSION_STATE 6
+#define AWAIT_UPGRADE_SESSION_STATE 7
+#define AWAIT_PORT_SESSION_STATE 8
+#define AWAIT_CONTINUATION_SESSION_STATE 9
+#define WEATHER_REPORT_SESSION_STATE 10
+#define GAME_OVER_SESSION_STATE 11
+
+/**
+ * A game that waits for its player's answers instead of reading them, so that any number of games can be played at
+ * once by feeding each of them its player's answers as they arrive. Its state is the prompt it waits on, which holds
+ * everything the turn needs to continue, so no stack is kept between answers.
+ */
+typedef struct {
+  GameState gameState;
+  GameAction action;
+  GameStepResult stepResult;
+  uint64_t nSeed;
+  int nSessionState;
+  int nPlayerMerchantId;
+  int nPlayerInitialBalance;
+  int nPlayerDepartureTurn;
+  ActionJournalWriter *pActionJournalWriter;
+} GameSession;
+
+/**
+ * Starts a new game by printing out its start screen and the first prompt to the current output sink.
+ * @param[out] pGameSession The game to start.
+ * @param nSeed The seed of the game's random number generator.
+ * @param[in,out] pActionJournalWriter The journal to record to, or `NULL` if the game is not being recorded.
+ */
+void startGameSession(GameSession *pGameSession, uint64_t nSeed, ActionJournalWriter *pActionJournalWriter);
+
+/**
+ * Resumes a saved game at the start of its current turn by printing out its main screen and the action prompt to the
+ * current output sink.
+ * @param[out] pGameSession The game to resume.
+ * @param pGameState The saved state of the game.
+ * @returns `1` if the game is already over or `0` if it is waiting on the player's action.
+ */
+int resumeGameSession(GameSession *pGameSession, const GameState *pGameState);
+
+/**
+ * Answers the prompt that the game is waiting on, printing out everything up to and including the next prompt to the
+ * current output sink. An invalid answer prints out why it was rejected and the same prompt's input marker again.
+ * @param[in,out] pGameSession The game to advance.
+ * @param pToken The first character of the answer.
+ * @param nTokenLength The number of characters in the answer.
+ * @returns `1` if the game is over or `0` if it is waiting on another answer.
+ */
+int feedGameSession(GameSession *pGameSession, const char *pToken, size_t nTokenLength);
+
+#endif  // CCPROG1_SESSION_H_
@@ -0,0 +1,147 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_SIMULATION_H_
+#define CCPROG1_SIMULATION_H_
+
+#include <stdint.h>
+
+#include "solver.h"
+
+#define SIMULATION_MINIMUM_PROFIT -100
+#define SIMULATION_EXACT_PROFIT_LIMIT 1000
+#define SIMULATION_PROFIT_DECADE_COUNT 6
+#define SIMULATION_PROFIT_BUCKET_COUNT \
+  (SIMULATION_EXACT_PROFIT_LIMIT - SIMULATION_MINIMUM_PROFIT + SIMULATION_PROFIT_DECADE_COUNT * 900)
+
+/**
+ * The aggregated results of many simulated games, which can be merged across workers. Profits below `1000` are
+ * counted exactly, while larger profits are counted with three significant digits.
+ */
+typedef struct {
+  long nGameCount;
+  long nWinCount;
+  long long nProfitSum;
+  int nMinimumProfit;
+  int nMaximumProfit;
+  long nProfitCounts[SIMULATION_PROFIT_BUCKET_COUNT];
+} SimulationSummary;
+
+/**
+ * Plays a complete game from start to finish using the passed policy.
+ * @param cPolicyId The ID of the policy that chooses every action.
+ * @param pSolvedPolicy The solved policy, which is only used by the `D` policy.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nSeed The seed of the game's random number generator.
+ * @pre @p cPolicyId must have a character value of `R`, `G`, or `D`.
+ * @returns The player's final profit percentage.
+ */
+int simulateGame(char cPolicyId, const SolvedPolicy *pSolvedPolicy, int nPlayerInitialBalance,
+                 int nPlayerProfitTarget, uint64_t nSeed);
+
+/**
+ * Clears the passed summary so that it has no recorded games.
+ * @param[out] pSimulationSummary The summary to clear.
+ */
+void resetSimulationSummary(SimulationSummary *pSimulationSummary);
+
+/**
+ * Records the final profit of a single game in the passed summary.
+ * @param[in,out] pSimulationSummary The summary to record in.
+ * @param nPlayerFinalProfit The player's final profit percentage.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ */
+void recordSimulatedGame(SimulationSummary *pSimulationSummary, int nPlayerFinalProfit, int nPlayerProfitTarget);
+
+/**
+ * Adds all games recorded in one summary to another.
+ * @param[in,out] pSimulationSummary The summary to add to.
+ * @param pOtherSimulationSummary The summary to add from.
+ */
+void mergeSimulationSummaries(SimulationSummary *pSimulationSummary, const SimulationSummary *pOtherSimulationSummary);
+
+/**
+ * Gets the final profit below which the passed percentage of the recorded games fall.
+ * @param pSimulationSummary The summary to inspect.
+ * @param nPercentile The percentile to get.
+ * @pre @p nPercentile must have an integer value within the range of `0` and `100`.
+ * @returns The profit percentage at the percentile, rounded down to three significant digits above `1000`.
+ */
+int getSimulationProfitPercentile(const SimulationSummary *pSimulationSummary, int nPercentile);
+
+/**
+ * Gets the index of the profit count that the passed profit is counted in.
+ * @param nPlayerProfit The player's profit percentage.
+ * @returns An integer value within the range of `0` and the number of profit counts minus one.
+ */
+int getSimulationProfitIndex(int nPlayerProfit);
+
+/**
+ * Gets the lowest profit counted in the profit count with the passed index.
+ * @param nProfitIndex The index of the profit count.
+ * @returns The profit percentage at the start of the profit count.
+ */
+int getSimulationIndexProfit(int nProfitIndex);
+
+/**
+ * Plays the passed number of games across the passed number of worker threads and aggregates their final profits.
+ * Game `i` is seeded with `nBaseSeed + i`, so the same arguments always give the same summary.
+ * @param[out] pSimulationSummary The summary of all games.
+ * @param cPolicyId The ID of the policy that chooses every action.
+ * @param pSolvedPolicy The solved policy, which is only used by the `D` policy.
+ * @param nGameCount The number of games to play.
+ * @param nWorkerCount The number of worker threads to use.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nBaseSeed The seed of the first game.
+ * @returns `0` if all games were played or `-1` if the workers could not be allocated.
+ */
+int runSimulation(SimulationSummary *pSimulationSummary, char cPolicyId, const SolvedPolicy *pSolvedPolicy,
+                  long nGameCount, int nWorkerCount, int nPlayerInitialBalance, int nPlayerProfitTarget,
+                  uint64_t nBaseSeed);
+
+/**
+ * Plays the passed number of games with the greedy policy in structure-of-arrays batches across the passed number of
+ * worker threads. Every game is seeded exactly like in `runSimulation`, so both give the same summary.
+ * @param[out] pSimulationSummary The summary of all games.
+ * @param nGameCount The number of games to play.
+ * @param nBatchSize The number of games that each worker advances together.
+ * @param nWorkerCount The number of worker threads to use.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nBaseSeed The seed of the first game.
+ * @returns `0` if all games were played or `-1` if the workers or their batches could not be allocated.
+ */
+int runBatchSimulation(SimulationSummary *pSimulationSummary, long nGameCount, int nBatchSize, int nWorkerCount,
+                       int nPlayerInitialBalance, int nPlayerProfitTarget, uint64_t nBaseSeed);
+
+/**
+ * Plays the passed number of games with the greedy policy both in batches and one at a time, and compares their final
+ * states.
+ * @param nGameCount The number of games to play.
+ * @param nBatchSize The number of games that are advanced together.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nBaseSeed The seed of the first game.
+ * @returns The number of games whose final states differ or `-1` if the batch could not be allocated.
+ */
+long verifyBatchSimulation(long nGameCount, int nBatchSize, int nPlayerInitialBalance, int nPlayerProfitTarget,
+                           uint64_t nBaseSeed);
+
+#endif  // CCPROG1_SIMULATION_H_
@@ -0,0 +1,139 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_SLAB_H_
+#define CCPROG1_SLAB_H_
+
+#include <stddef.h>
+
+#define SLAB_BLOCK_SLOT_COUNT 1024
+
+#define ARENA_CHUNK_SIZE 4096
+
+/**
+ * A pool of fixed-size slots that are carved out of large blocks, so that allocating and freeing a slot is a matter of
+ * popping and pushing a free list instead of going through the heap. Blocks are only freed when the pool is closed.
+ */
+typedef struct {
+  size_t nSlotSize;
+  void *pFreeSlot;
+  void **pBlocks;
+  int nBlockCount;
+  int nBlockCapacity;
+  long nUsedSlotCount;
+  long nMaximumUsedSlotCount;
+} SlabPool;
+
+/** A chunk of an arena, whose bytes follow its header in the same slab slot. */
+typedef struct ArenaChunk {
+  struct ArenaChunk *pNextChunk;
+  size_t nLength;
+  char pBytes[];
+} ArenaChunk;
+
+/**
+ * A bump arena that holds a session's bytes in a chain of chunks taken from a slab pool. Bytes are only ever appended
+ * to the last chunk and consumed from the first, and an empty arena holds no chunks at all.
+ */
+typedef struct {
+  ArenaChunk *pFirstChunk;
+  ArenaChunk *pLastChunk;
+  size_t nFirstChunkOffset;
+} SessionArena;
+
+/**
+ * Gets the size of the slots that a pool allocates for objects of the passed size.
+ * @param nObjectSize The size of every object in bytes.
+ * @returns The size of every slot in bytes.
+ */
+size_t getSlabSlotSize(size_t nObjectSize);
+
+/**
+ * Sets up an empty pool of slots of the passed size.
+ * @param[out] pSlabPool The pool to set up.
+ * @param nSlotSize The size of every slot in bytes.
+ */
+void openSlabPool(SlabPool *pSlabPool, size_t nSlotSize);
+
+/**
+ * Frees every block of the pool, along with every slot still in use.
+ * @param[in,out] pSlabPool The pool to close.
+ */
+void closeSlabPool(SlabPool *pSlabPool);
+
+/**
+ * Takes a slot from the pool, allocating a new block of `SLAB_BLOCK_SLOT_COUNT` slots if every slot is in use.
+ * @param[in,out] pSlabPool The pool to take from.
+ * @returns The slot, whose contents are undefined, or `NULL` if a new block could not be allocated.
+ */
+void *allocateSlabSlot(SlabPool *pSlabPool);
+
+/**
+ * Returns a slot to the pool.
+ * @param[in,out] pSlabPool The pool that the slot was taken from.
+ * @param pSlot The slot to return.
+ */
+void freeSlabSlot(SlabPool *pSlabPool, void *pSlot);
+
+/**
+ * Gets the number of slots that the pool has allocated, whether they are in use or not.
+ * @param pSlabPool The pool to inspect.
+ * @returns The number of slots.
+ */
+long getSlabSlotCount(const SlabPool *pSlabPool);
+
+/**
+ * Sets up an arena without any chunks, whose chunks are taken from a pool of `ARENA_CHUNK_SIZE` slots.
+ * @param[out] pSessionArena The arena to set up.
+ */
+void openSessionArena(SessionArena *pSessionArena);
+
+/**
+ * Appends the passed bytes to the arena, taking as many chunks from the pool as they need.
+ * @param[in,out] pSessionArena The arena to append to.
+ * @param[in,out] pChunkPool The pool of chunks.
+ * @param pBytes The bytes to append.
+ * @param nByteCount The number of bytes to append.
+ * @returns `0` if every byte was appended or `-1` if a chunk could not be allocated.
+ */
+int appendSessionArena(SessionArena *pSessionArena, SlabPool *pChunkPool, const char *pBytes, size_t nByteCount);
+
+/**
+ * Gets the bytes at the start of the arena that are held in a single chunk.
+ * @param pSessionArena The arena to inspect.
+ * @param[out] nByteCount The number of bytes, which is `0` if the arena is empty.
+ * @returns The first byte.
+ */
+const char *peekSessionArena(const SessionArena *pSessionArena, size_t *nByteCount);
+
+/**
+ * Consumes bytes from the start of the arena, returning every chunk that has been fully consumed to the pool.
+ * @param[in,out] pSessionArena The arena to consume from.
+ * @param[in,out] pChunkPool The pool of chunks.
+ * @param nByteCount The number of bytes to consume, which must be at most what the arena holds.
+ */
+void consumeSessionArena(SessionArena *pSessionArena, SlabPool *pChunkPool, size_t nByteCount);
+
+/**
+ * Empties the arena, returning every chunk it holds to the pool.
+ * @param[in,out] pSessionArena The arena to empty.
+ * @param[in,out] pChunkPool The pool of chunks.
+ */
+void resetSessionArena(SessionArena *pSessionArena, SlabPool *pChunkPool);
+
+#endif  // CCPROG1_SLAB_H_
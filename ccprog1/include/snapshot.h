@@ -0,0 +1,64 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_SNAPSHOT_H_
+#define CCPROG1_SNAPSHOT_H_
+
+#include <stdint.h>
+
+#include "engine.h"
+
+#define GAME_SNAPSHOT_VERSION 1
+#define GAME_SNAPSHOT_SIZE 68
+
+/**
+ * Encodes the passed game as a snapshot, a fixed-layout little-endian record that holds everything needed to resume
+ * the game, including the state of its random number generator, and ends with a checksum of the rest of the record.
+ * @param pGameState The game to encode.
+ * @param[out] pSnapshotBytes The `GAME_SNAPSHOT_SIZE` bytes of the snapshot.
+ * @returns `0` if the game was encoded or `-1` if one of its values does not fit in the snapshot's layout.
+ */
+int encodeGameSnapshot(const GameState *pGameState, uint8_t *pSnapshotBytes);
+
+/**
+ * Decodes a snapshot written by `encodeGameSnapshot`.
+ * @param pSnapshotBytes The `GAME_SNAPSHOT_SIZE` bytes of the snapshot.
+ * @param[out] pGameState The resumed game.
+ * @returns `0` if the game was decoded or `-1` if the snapshot has another version, a wrong checksum, or a game that
+ * the engine could not have reached.
+ */
+int decodeGameSnapshot(const uint8_t *pSnapshotBytes, GameState *pGameState);
+
+/**
+ * Saves the passed game to a snapshot file, which is written next to its final path and then renamed over it so that
+ * an interrupted save never leaves a partial snapshot behind.
+ * @param pGameState The game to save.
+ * @param strFilePath The path of the file to write.
+ * @returns `0` if the game was saved or `-1` if it could not be encoded or written.
+ */
+int saveGameSnapshot(const GameState *pGameState, const char *strFilePath);
+
+/**
+ * Loads a game saved by `saveGameSnapshot` with a single read.
+ * @param[out] pGameState The resumed game.
+ * @param strFilePath The path of the file to read.
+ * @returns `0` if the game was loaded or `-1` if the file could not be read or is not a valid snapshot.
+ */
+int loadGameSnapshot(GameState *pGameState, const char *strFilePath);
+
+#endif  // CCPROG1_SNAPSHOT_H_
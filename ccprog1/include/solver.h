@@ -0,0 +1,96 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_SOLVER_H_
+#define CCPROG1_SOLVER_H_
+
+#include "engine.h"
+#include "trading.h"
+
+#define SOLVER_DAY_COUNT (MAXIMUM_PLAYER_TURNS + 1)
+#define SOLVER_TIER_COUNT 4
+#define SOLVER_AMOUNT_STEP 10
+#define SOLVER_AMOUNT_BUCKET_COUNT (TIER_FOUR_SHIP_CARGO_LIMIT / SOLVER_AMOUNT_STEP + 1)
+#define SOLVER_HOLDING_COUNT (1 + CARGO_COUNT * SOLVER_AMOUNT_BUCKET_COUNT)
+#define SOLVER_BALANCE_STEPS_PER_OCTAVE 4
+#define SOLVER_BALANCE_OCTAVE_COUNT 24
+#define SOLVER_BALANCE_BUCKET_COUNT (SOLVER_BALANCE_STEPS_PER_OCTAVE * (SOLVER_BALANCE_OCTAVE_COUNT + 1) + 1)
+#define SOLVER_VALUE_COUNT \
+  ((long)SOLVER_DAY_COUNT * PORT_COUNT * SOLVER_TIER_COUNT * SOLVER_HOLDING_COUNT * SOLVER_BALANCE_BUCKET_COUNT)
+
+/**
+ * The expected final balance of every state at the start of every day, before that day's market prices are known,
+ * which is all that is needed to play optimally by looking one day ahead. A state is the port, the ship tier, a single
+ * carried cargo with its amount in steps of `SOLVER_AMOUNT_STEP`, and the balance in `SOLVER_BALANCE_STEPS_PER_OCTAVE`
+ * even steps per doubling. Storms are folded into the chance of a postponed departure on each day, since the weather
+ * never depends on the player.
+ */
+typedef struct {
+  float nDepartureFailureChances[MAXIMUM_PLAYER_TURNS];
+  float *pValues;
+} SolvedPolicy;
+
+/**
+ * Computes the expected final balance of every state by dynamic programming from the last day back to the first,
+ * where each day's states are computed in parallel.
+ * @param[out] pSolvedPolicy The policy to compute, which must be destroyed afterwards.
+ * @param nWorkerCount The number of worker threads to use.
+ * @returns `0` if the policy was computed or `-1` if it could not be allocated.
+ */
+int solveGame(SolvedPolicy *pSolvedPolicy, int nWorkerCount);
+
+/**
+ * Frees the values of the passed policy.
+ * @param[in,out] pSolvedPolicy The policy to free.
+ */
+void destroySolvedPolicy(SolvedPolicy *pSolvedPolicy);
+
+/**
+ * Writes the passed policy to a binary file, which stores floats in the machine's own byte order.
+ * @param pSolvedPolicy The policy to write.
+ * @param strFilePath The path of the file to write.
+ * @returns `0` if the policy was written or `-1` if it could not be.
+ */
+int saveSolvedPolicy(const SolvedPolicy *pSolvedPolicy, const char *strFilePath);
+
+/**
+ * Reads a policy written by `saveSolvedPolicy`.
+ * @param[out] pSolvedPolicy The policy to read, which must be destroyed afterwards.
+ * @param strFilePath The path of the file to read.
+ * @returns `0` if the policy was read or `-1` if the file could not be read or has other dimensions.
+ */
+int loadSolvedPolicy(SolvedPolicy *pSolvedPolicy, const char *strFilePath);
+
+/**
+ * Gets the expected final balance of a new game when it is played with the passed policy.
+ * @param pSolvedPolicy The policy to inspect.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @returns The expected final balance, interpolated between the nearest balance steps.
+ */
+double getSolvedExpectedBalance(const SolvedPolicy *pSolvedPolicy, int nPlayerInitialBalance);
+
+/**
+ * Chooses the action with the highest expected final balance, which compares every sale, upgrade, and purchase at the
+ * current market prices against the values of the next day.
+ * @param pSolvedPolicy The policy to play with.
+ * @param pGameState The game to choose an action for.
+ * @returns A valid action.
+ */
+GameAction chooseSolvedAction(const SolvedPolicy *pSolvedPolicy, const GameState *pGameState);
+
+#endif  // CCPROG1_SOLVER_H_
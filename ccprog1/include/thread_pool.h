@@ -0,0 +1,48 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_THREAD_POOL_H_
+#define CCPROG1_THREAD_POOL_H_
+
+/**
+ * A function that runs a single task.
+ * @param pContext The context shared by all tasks.
+ * @param nTaskIndex The index of the task to run.
+ * @param nWorkerIndex The index of the worker running the task, which can be used to index per-worker results.
+ */
+typedef void (*ThreadPoolTask)(void *pContext, long nTaskIndex, int nWorkerIndex);
+
+/**
+ * Runs the passed number of tasks across the passed number of worker threads. Each worker starts with an equal share
+ * of the tasks and steals half of another worker's remaining share once it runs out, so uneven tasks still keep every
+ * core busy.
+ * @param nTaskCount The number of tasks to run.
+ * @param nWorkerCount The number of worker threads to use.
+ * @param task The function that runs a single task.
+ * @param pContext The context passed to every task.
+ * @returns `0` if all tasks were run or `-1` if the thread pool could not be allocated.
+ */
+int runThreadPoolTasks(long nTaskCount, int nWorkerCount, ThreadPoolTask task, void *pContext);
+
+/**
+ * Gets the number of processors available to the program.
+ * @returns A positive integer value.
+ */
+int getProcessorCount(void);
+
+#endif  // CCPROG1_THREAD_POOL_H_
@@ -0,0 +1,69 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_TRACE_H_
+#define CCPROG1_TRACE_H_
+
+#define TRACE_BUFFER_CAPACITY 4096
+
+/*
+ * Tracing is compiled in by defining `TIDES_TRACE`, which `make trace` does. Otherwise, the macros expand to nothing
+ * and none of the functions below exist, so tracing costs nothing in normal builds.
+ */
+#ifdef TIDES_TRACE
+
+/**
+ * Marks the start of a traced span on the calling thread.
+ * @param strName The name of the span, which must be a string literal.
+ */
+#define TRACE_BEGIN(strName) recordTraceEvent((strName), 'B')
+
+/**
+ * Marks the end of the innermost traced span on the calling thread.
+ * @param strName The name of the span, which must match the name it was started with.
+ */
+#define TRACE_END(strName) recordTraceEvent((strName), 'E')
+
+/**
+ * Opens the file that traced spans are written to as Chrome trace-event JSON. Spans are discarded until it is opened.
+ * @param strFilePath The path of the file to write.
+ * @returns `0` if the file was opened or `-1` if it could not be.
+ */
+int openTraceFile(const char *strFilePath);
+
+/**
+ * Appends an event to the calling thread's ring buffer, which is written to the trace file whenever it fills up.
+ * @param strName The name of the span, which must outlive the trace.
+ * @param cPhase The Chrome trace-event phase, which is either `B` for the start of a span or `E` for its end.
+ */
+void recordTraceEvent(const char *strName, char cPhase);
+
+/** Writes the events buffered by the calling thread to the trace file, which threads must do before they exit. */
+void flushTraceEvents(void);
+
+/** Writes the events buffered by the calling thread to the trace file, then closes it. */
+void closeTraceFile(void);
+
+#else
+
+#define TRACE_BEGIN(strName) ((void)0)
+#define TRACE_END(strName) ((void)0)
+
+#endif
+
+#endif  // CCPROG1_TRACE_H_
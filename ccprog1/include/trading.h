@@ -19,6 +19,8 @@
 #ifndef CCPROG1_TRADING_H_
 #define CCPROG1_TRADING_H_
 
+#include "random.h"
+
 #define TONDO_MINIMUM_COCONUT_PRICE 4
 #define TONDO_MAXIMUM_COCONUT_PRICE 24
 #define TONDO_MINIMUM_RICE_PRICE 1
@@ -55,6 +57,9 @@
 #define SAPA_MINIMUM_GUN_PRICE 204
 #define SAPA_MAXIMUM_GUN_PRICE 301
 
+#define PORT_COUNT 4
+#define CARGO_COUNT 4
+
 #define BUY_TRANSACTION_TYPE_ID 'B'
 #define SELL_TRANSACTION_TYPE_ID 'S'
 
@@ -67,13 +72,53 @@
 #define TIER_THREE_SHIP_UPGRADE_COST 1750
 #define TIER_FOUR_SHIP_UPGRADE_COST 2500
 
+/** The IDs of all ports, ordered by their port index. */
+extern const char PORT_IDS[PORT_COUNT];
+
+/** The IDs of all cargo, ordered by their cargo index. */
+extern const char CARGO_IDS[CARGO_COUNT];
+
+/** The minimum market price of each cargo in each port, indexed by port index and then by cargo index. */
+extern const int MINIMUM_CARGO_PRICES[PORT_COUNT][CARGO_COUNT];
+
+/** The number of possible market prices of each cargo in each port, indexed by port index and then by cargo index. */
+extern const uint32_t CARGO_PRICE_RANGES[PORT_COUNT][CARGO_COUNT];
+
+/**
+ * Gets the index of the passed port within the list of all ports.
+ * @param cPortId The ID of the port.
+ * @pre @p cPortId must have a character value of `T`, `M`, `P`, or `S`.
+ * @returns An integer value within the range of `0` and `3`.
+ */
+int getPortIndex(char cPortId);
+
+/**
+ * Gets the index of the passed cargo within the list of all cargo.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
+ * @returns An integer value within the range of `0` and `3`.
+ */
+int getCargoIndex(char cCargoId);
+
+/**
+ * Generates a random market price for every cargo within the price ranges of the passed port.
+ * @param[in,out] pRandomGenerator The game's random number generator.
+ * @param nPortIndex The index of the port.
+ * @param[out] nCargoPrices The market price of each cargo, ordered by cargo index.
+ * @pre @p nPortIndex must have an integer value within the range of `0` and `3`.
+ */
+void generateCargoPrices(RandomGenerator *pRandomGenerator, int nPortIndex, int nCargoPrices[CARGO_COUNT]);
+
 /**
- * Generates a random price within the passed minimum and maximum prices.
- * @param nMinimumPrice The minimum allowed price.
- * @param nMaximumPrice The maximum allowed price.
- * @returns An integer value within the range of `nMinimumPrice` and `nMaximumPrice`.
+ * Gets the minimum and maximum market prices of the passed cargo in the passed port.
+ * @param cPortId The ID of the port.
+ * @param cCargoId The ID of the cargo.
+ * @param[out] nMinimumPrice The minimum market price.
+ * @param[out] nMaximumPrice The maximum market price.
+ * @pre @p cPortId must have a character value of `T`, `M`, `P`, or `S`.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
  */
-int generateRandomPrice(int nMinimumPrice, int nMaximumPrice);
+void getCargoPriceRange(char cPortId, char cCargoId, int *nMinimumPrice, int *nMaximumPrice);
 
 /**
  * Subtracts or adds the cargo's cost to the player's balance and cargo to the ship's storage based on the transaction
@@ -0,0 +1,140 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CCPROG1_TRANSPOSITION_H_
+#define CCPROG1_TRANSPOSITION_H_
+
+#include <stdint.h>
+
+#include "engine.h"
+#include "trading.h"
+
+#define TRANSPOSITION_BUCKET_SIZE 4
+#define TRANSPOSITION_ALIGNMENT 64
+
+/**
+ * The part of a game's state that decides its future, packed into 24 bytes so it can be hashed and compared as three
+ * words. The random generator, initial balance, and profit target are left out, since a search treats the generator
+ * as chance and keeps the other two fixed. The port index is stored in bits `0` to `1` of `nPortAndShipTier`, the ship
+ * tier in bits `2` to `3`, and whether the player is quitting in bit `4`.
+ */
+typedef struct {
+  int32_t nPlayerBalance;
+  uint16_t nShipCargoAmounts[CARGO_COUNT];
+  uint16_t nMarketPrices[CARGO_COUNT];
+  uint8_t nPlayerTurns;
+  uint8_t nPortAndShipTier;
+  int8_t nStormTurnDuration;
+  uint8_t nStormWindSignalNumber;
+} PackedGameState;
+
+/** The search result stored for a single state, whose action index is only meaningful to the search that stored it. */
+typedef struct {
+  float nValue;
+  uint16_t nDepth;
+  uint8_t nActionIndex;
+} TranspositionEntry;
+
+/**
+ * A fixed-size hash table of search results shared by any number of threads without locks. Each slot stores its data
+ * next to the state's hash XORed with that data, so a slot torn by two threads writing at once no longer matches any
+ * hash and simply reads as a miss. Slots are grouped into buckets of one cache line, and a full bucket replaces the
+ * entry from the oldest search generation first and the shallowest entry second.
+ */
+typedef struct {
+  uint64_t *pSlots;
+  uint64_t nBucketMask;
+  uint8_t nGeneration;
+  long nHitCount;
+  long nMissCount;
+  long nStoreCount;
+  long nReplacementCount;
+} TranspositionTable;
+
+/**
+ * Packs the decision-relevant state of the passed game.
+ * @param pGameState The game to pack.
+ * @param[out] pPackedGameState The packed state.
+ */
+void packGameState(const GameState *pGameState, PackedGameState *pPackedGameState);
+
+/**
+ * Hashes the passed packed state.
+ * @param pPackedGameState The packed state to hash.
+ * @returns A 64-bit hash whose bits are all equally mixed.
+ */
+uint64_t hashPackedGameState(const PackedGameState *pPackedGameState);
+
+/**
+ * Checks whether both packed states are the same.
+ * @param pFirstPackedGameState The first packed state.
+ * @param pSecondPackedGameState The second packed state.
+ * @returns `1` if the states are the same or `0` if they are not.
+ */
+int isPackedGameStateEqual(const PackedGameState *pFirstPackedGameState,
+                           const PackedGameState *pSecondPackedGameState);
+
+/**
+ * Allocates an empty table that holds at most the passed number of entries, rounded down to a power of two buckets.
+ * @param[out] pTranspositionTable The table to allocate.
+ * @param nEntryCount The maximum number of entries.
+ * @returns `0` if the table was allocated or `-1` if it could not be.
+ */
+int createTranspositionTable(TranspositionTable *pTranspositionTable, long nEntryCount);
+
+/**
+ * Frees the slots of the passed table.
+ * @param[in,out] pTranspositionTable The table to free.
+ */
+void destroyTranspositionTable(TranspositionTable *pTranspositionTable);
+
+/**
+ * Empties the passed table and resets its counters.
+ * @param[in,out] pTranspositionTable The table to empty.
+ * @note This must not be called while other threads use the table.
+ */
+void clearTranspositionTable(TranspositionTable *pTranspositionTable);
+
+/**
+ * Starts a new search generation, which makes every entry stored so far the first to be replaced.
+ * @param[in,out] pTranspositionTable The table whose generation to advance.
+ * @note This must not be called while other threads use the table.
+ */
+void advanceTranspositionGeneration(TranspositionTable *pTranspositionTable);
+
+/**
+ * Looks up the entry of the state with the passed hash.
+ * @param[in,out] pTranspositionTable The table to look in, whose hit or miss count is incremented.
+ * @param nHash The hash of the state.
+ * @param[out] pTranspositionEntry The entry of the state, which is only set if it was found.
+ * @returns `1` if the entry was found or `0` if it was not.
+ */
+int probeTranspositionTable(TranspositionTable *pTranspositionTable, uint64_t nHash,
+                            TranspositionEntry *pTranspositionEntry);
+
+/**
+ * Stores the entry of the state with the passed hash. An existing entry of the same state from the current generation
+ * is only overwritten by an entry of at least its depth.
+ * @param[in,out] pTranspositionTable The table to store in, whose store and replacement counts are incremented.
+ * @param nHash The hash of the state.
+ * @param transpositionEntry The entry to store.
+ */
+void storeTranspositionEntry(TranspositionTable *pTranspositionTable, uint64_t nHash,
+                             TranspositionEntry transpositionEntry);
+
+#endif  // CCPROG1_TRANSPOSITION_H_
@@ -19,7 +19,10 @@
 #ifndef CCPROG1_WEATHER_H_
 #define CCPROG1_WEATHER_H_
 
+#include "random.h"
+
 #define MAXIMUM_STORM_TURN_DURATION 10
+#define MAXIMUM_WIND_SIGNAL_NUMBER 5
 
 #define DEFAULT_POSTPONED_DEPARTURE_CHANCE 0
 #define SIGNAL_THREE_STORM_POSTPONED_DEPARTURE_CHANCE 1
@@ -28,19 +31,21 @@
 
 /**
  * Generates a random boolean based on the passed chance of returning a `true`.
+ * @param[in,out] pRandomGenerator The game's random number generator.
  * @param nTruePercentChance The percentage chance of this function returning `1`.
  * @pre @p nTruePercentChance must have a positive integer value greater than or equal to  `1` and less than or equal to
  * `100`.
  * @returns `1` if `true` or `0` if `false`.
  */
-int generateRandomBool(int nTrueChance);
+int generateRandomBool(RandomGenerator *pRandomGenerator, int nTruePercentChance);
 
 /**
  * Generates a random duration in turns for a storm within the passed minimum and constant maximum turn duration.
+ * @param[in,out] pRandomGenerator The game's random number generator.
  * @param nMinimumTurnDuration The minimum allowed duration in turns.
  * @returns An integer value within the range of `nMinimumTurnDuration` and `10`.
  */
-int generateRandomStormTurnDuration(int nMinimumTurnDuration);
+int generateRandomStormTurnDuration(RandomGenerator *pRandomGenerator, int nMinimumTurnDuration);
 
 /**
  * Sets the wind signal number of the storm to the given new wind signal number and sets its debuffs.
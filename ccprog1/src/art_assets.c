@@ -0,0 +1,357 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "art_assets.h"
+
+#include "console.h"
+#include "frame.h"
+#include "output.h"
+
+/** Defines an art asset whose byte count is computed at compile time, excluding the terminating null character. */
+#define ART_ASSET(strName, strBytes) {sizeof(strBytes) - 1, strBytes, strName}
+
+// clang-format off
+static const ArtAsset artAssets[ART_ASSET_COUNT] = {
+  [SEPARATOR_ART_ASSET] = ART_ASSET("separator",
+    "\n\n\n"
+    "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━"
+    "\n\n\n\n"),
+  [GAME_TITLE_ART_ASSET] = ART_ASSET("game title",
+    "     ███      ▄█  ████████▄     ▄████████    ▄████████       ▄██████▄     ▄████████        ▄▄▄▄███▄▄▄▄      ▄████████ ███▄▄▄▄    ▄█   ▄█          ▄████████\n"
+    " ▀█████████▄ ███  ███   ▀███   ███    ███   ███    ███      ███    ███   ███    ███      ▄██▀▀▀███▀▀▀██▄   ███    ███ ███▀▀▀██▄ ███  ███         ███    ███\n"
+    "    ▀███▀▀██ ███▌ ███    ███   ███    █▀    ███    █▀       ███    ███   ███    █▀       ███   ███   ███   ███    ███ ███   ███ ███▌ ███         ███    ███\n"
+    "     ███   ▀ ███▌ ███    ███  ▄███▄▄▄       ███             ███    ███  ▄███▄▄▄          ███   ███   ███   ███    ███ ███   ███ ███▌ ███         ███    ███\n"
+    "     ███     ███▌ ███    ███ ▀▀███▀▀▀     ▀███████████      ███    ███ ▀▀███▀▀▀          ███   ███   ███ ▀███████████ ███   ███ ███▌ ███       ▀███████████\n"
+    "     ███     ███  ███    ███   ███    █▄           ███      ███    ███   ███             ███   ███   ███   ███    ███ ███   ███ ███  ███         ███    ███\n"
+    "     ███     ███  ███   ▄███   ███    ███    ▄█    ███      ███    ███   ███             ███   ███   ███   ███    ███ ███   ███ ███  ███▌    ▄   ███    ███\n"
+    "    ▄████▀   █▀   ████████▀    ██████████  ▄████████▀        ▀██████▀    ███              ▀█   ███   █▀    ███    █▀   ▀█   █▀  █▀   █████▄▄██   ███    █▀\n"
+    "                                                                                                                                     ▀\n"),
+  [GAME_SUBTITLE_ART_ASSET] = ART_ASSET("game subtitle",
+    "                                    ▗▄▖     ▗▖  ▗▖▗▄▄▄▖▗▄▄▖  ▗▄▄▖▗▖ ▗▖ ▗▄▖ ▗▖  ▗▖▗▄▄▄▖▗▄▄▖    ▗▄▄▄▖ ▗▖ ▗▖▗▄▄▄▖ ▗▄▄▖▗▄▄▄▖\n"
+    "                                   ▐▌ ▐▌    ▐▛▚▞▜▌▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▐▌▐▛▚▖▐▌  █ ▐▌       ▐▌ ▐▌ ▐▌ ▐▌▐▌   ▐▌     █\n"
+    "                                   ▐▛▀▜▌    ▐▌  ▐▌▐▛▀▀▘▐▛▀▚▖▐▌   ▐▛▀▜▌▐▛▀▜▌▐▌ ▝▜▌  █  ▝▀▚▖    ▐▌ ▐▌ ▐▌ ▐▌▐▛▀▀▘ ▝▀▚▖  █\n"
+    "                                   ▐▌ ▐▌    ▐▌  ▐▌▐▙▄▄▖▐▌ ▐▌▝▚▄▄▖▐▌ ▐▌▐▌ ▐▌▐▌  ▐▌  █ ▗▄▄▞▘    ▐▙▄▟▙▖▝▚▄▞▘▐▙▄▄▖▗▄▄▞▘  █\n"),
+  [TIER_ONE_SHIP_ART_ASSET] = ART_ASSET("tier one ship",
+    "                                                               ~~~\n"
+    "                                                          ~~~~     ~~~~        |\n"
+    "                                                               ~~~            /|\n"
+    "                                                                             / |\\\n"
+    "                                                                            /  | \\\n"
+    "                                                                           /   |  \\\n"
+    "                                                                          /    |   \\\n"
+    "                                                                         /     |____\\\n"
+    "                                                                   _____/______|_________\n"
+    "                                                                    \\__________________/\n"
+    "                                                            ~~..             ...~~~.           ....~~~...\n"),
+  [TIER_TWO_SHIP_ART_ASSET] = ART_ASSET("tier two ship",
+    "                                                          ~~~\n"
+    "                                                     ~~~~     ~~~~       |\n"
+    "                                                          ~~~          -----        |\n"
+    "                                                                       )___(        |\\\n"
+    "                                                                         |          | \\\n"
+    "                                                                      -------       |  \\\n"
+    "                                                                     /       \\      |   \\\n"
+    "                                                                    /_________\\     |____\\\n"
+    "                                                              ___________|__________|_________\n"
+    "                                                               \\____________________________/\n"
+    "                                                       ~~..             ...~~~.           ....~~~...     ..~\n"),
+  [TIER_THREE_SHIP_ART_ASSET] = ART_ASSET("tier three ship",
+    "                                                      ~~~             |\n"
+    "                                                 ~~~~     ~~~~      -----              |\n"
+    "                                                      ~~~           )___(            -----\n"
+    "                                                                      |              )___(\n"
+    "                                                                  ---------            |\n"
+    "                                                                 /         \\        -------\n"
+    "                                                                /           \\      /       \\\n"
+    "                                                               /_____________\\    /_________\\\n"
+    "                                                          ____________|________________|__________\n"
+    "                                                           \\_                                  _/\n"
+    "                                                             \\________________________________/\n"
+    "                                                   ~~..             ...~~~.           ....~~~...     ..~\n"),
+  [TIER_FOUR_SHIP_ART_ASSET] = ART_ASSET("tier four ship",
+    "                                                   ~~~             |\n"
+    "                                              ~~~~     ~~~~      -----                    |\n"
+    "                                                   ~~~           )___(                  -----\n"
+    "                                                                   |                    )___(\n"
+    "                                                               ---------                  |\n"
+    "                                                              /         \\              -------\n"
+    "                                                             /___________\\            /       \\\n"
+    "                                                                   |                 /_________\\\n"
+    "                                                            ---------------               |\n"
+    "                                                           /               \\        -------------\n"
+    "                                                          /                 \\      /             \\\n"
+    "                                                         /___________________\\    /_______________\\\n"
+    "                                                       ____________|______________________|__________\n"
+    "                                                        \\_                                        _/\n"
+    "                                                          \\______________________________________/\n"
+    "                                                   ~~..             ...~~~.           ....~~~...     ..~\n"),
+  [TONDO_BANNER_ART_ASSET] = ART_ASSET("Tondo banner",
+    "                                                        ████████  ██████  ███    ██ ██████   ██████\n"
+    "                                                           ██    ██    ██ ████   ██ ██   ██ ██    ██\n"
+    "                                                           ██    ██    ██ ██ ██  ██ ██   ██ ██    ██\n"
+    "                                                           ██    ██    ██ ██  ██ ██ ██   ██ ██    ██\n"
+    "                                                           ██     ██████  ██   ████ ██████   ██████\n"),
+  [MANILA_BANNER_ART_ASSET] = ART_ASSET("Manila banner",
+    "                                                      ███    ███  █████  ███    ██ ██ ██       █████\n"
+    "                                                      ████  ████ ██   ██ ████   ██ ██ ██      ██   ██\n"
+    "                                                      ██ ████ ██ ███████ ██ ██  ██ ██ ██      ███████\n"
+    "                                                      ██  ██  ██ ██   ██ ██  ██ ██ ██ ██      ██   ██\n"
+    "                                                      ██      ██ ██   ██ ██   ████ ██ ███████ ██   ██\n"),
+  [PANDAKAN_BANNER_ART_ASSET] = ART_ASSET("Pandakan banner",
+    "                                            ██████   █████  ███    ██ ██████   █████  ██   ██  █████  ███    ██\n"
+    "                                            ██   ██ ██   ██ ████   ██ ██   ██ ██   ██ ██  ██  ██   ██ ████   ██\n"
+    "                                            ██████  ███████ ██ ██  ██ ██   ██ ███████ █████   ███████ ██ ██  ██\n"
+    "                                            ██      ██   ██ ██  ██ ██ ██   ██ ██   ██ ██  ██  ██   ██ ██  ██ ██\n"
+    "                                            ██      ██   ██ ██   ████ ██████  ██   ██ ██   ██ ██   ██ ██   ████\n"),
+  [SAPA_BANNER_ART_ASSET] = ART_ASSET("Sapa banner",
+    "                                                                   ███████  █████  ██████   █████\n"
+    "                                                                   ██      ██   ██ ██   ██ ██   ██\n"
+    "                                                                   ███████ ███████ ██████  ███████\n"
+    "                                                                        ██ ██   ██ ██      ██   ██\n"
+    "                                                                   ███████ ██   ██ ██      ██   ██\n"),
+  [COCONUTS_BOUGHT_BANNER_ART_ASSET] = ART_ASSET("coconuts bought banner",
+    "                                         ▗▄▄▖ ▗▄▖  ▗▄▄▖ ▗▄▖ ▗▖  ▗▖▗▖ ▗▖▗▄▄▄▖ ▗▄▄▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
+    "                                        ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌ ▐▌  █  ▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
+    "                                        ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▝▜▌▐▌ ▐▌  █   ▝▀▚▖    ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
+    "                                        ▝▚▄▄▖▝▚▄▞▘▝▚▄▄▖▝▚▄▞▘▐▌  ▐▌▝▚▄▞▘  █  ▗▄▄▞▘    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n"),
+  [COCONUTS_SOLD_BANNER_ART_ASSET] = ART_ASSET("coconuts sold banner",
+    "                                              ▗▄▄▖ ▗▄▖  ▗▄▄▖ ▗▄▖ ▗▖  ▗▖▗▖ ▗▖▗▄▄▄▖ ▗▄▄▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
+    "                                             ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌ ▐▌  █  ▐▌       ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
+    "                                             ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▝▜▌▐▌ ▐▌  █   ▝▀▚▖     ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
+    "                                             ▝▚▄▄▖▝▚▄▞▘▝▚▄▄▖▝▚▄▞▘▐▌  ▐▌▝▚▄▞▘  █  ▗▄▄▞▘    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n"),
+  [RICE_BOUGHT_BANNER_ART_ASSET] = ART_ASSET("rice bought banner",
+    "                                                   ▗▄▄▖ ▗▄▄▄▖ ▗▄▄▖▗▄▄▄▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
+    "                                                   ▐▌ ▐▌  █  ▐▌   ▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
+    "                                                   ▐▛▀▚▖  █  ▐▌   ▐▛▀▀▘    ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
+    "                                                   ▐▌ ▐▌▗▄█▄▖▝▚▄▄▖▐▙▄▄▖    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n"),
+  [RICE_SOLD_BANNER_ART_ASSET] = ART_ASSET("rice sold banner",
+    "                                                        ▗▄▄▖ ▗▄▄▄▖ ▗▄▄▖▗▄▄▄▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
+    "                                                        ▐▌ ▐▌  █  ▐▌   ▐▌       ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
+    "                                                        ▐▛▀▚▖  █  ▐▌   ▐▛▀▀▘     ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
+    "                                                        ▐▌ ▐▌▗▄█▄▖▝▚▄▄▖▐▙▄▄▖    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n"),
+  [SILK_BOUGHT_BANNER_ART_ASSET] = ART_ASSET("silk bought banner",
+    "                                                    ▗▄▄▖▗▄▄▄▖▗▖   ▗▖ ▗▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
+    "                                                   ▐▌     █  ▐▌   ▐▌▗▞▘    ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
+    "                                                    ▝▀▚▖  █  ▐▌   ▐▛▚▖     ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
+    "                                                   ▗▄▄▞▘▗▄█▄▖▐▙▄▄▖▐▌ ▐▌    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n"),
+  [SILK_SOLD_BANNER_ART_ASSET] = ART_ASSET("silk sold banner",
+    "                                                         ▗▄▄▖▗▄▄▄▖▗▖   ▗▖ ▗▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
+    "                                                        ▐▌     █  ▐▌   ▐▌▗▞▘    ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
+    "                                                         ▝▀▚▖  █  ▐▌   ▐▛▚▖      ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
+    "                                                        ▗▄▄▞▘▗▄█▄▖▐▙▄▄▖▐▌ ▐▌    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n"),
+  [GUNS_BOUGHT_BANNER_ART_ASSET] = ART_ASSET("guns bought banner",
+    "                                                   ▗▄▄▖▗▖ ▗▖▗▖  ▗▖ ▗▄▄▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
+    "                                                  ▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
+    "                                                  ▐▌▝▜▌▐▌ ▐▌▐▌ ▝▜▌ ▝▀▚▖    ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
+    "                                                  ▝▚▄▞▘▝▚▄▞▘▐▌  ▐▌▗▄▄▞▘    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n"),
+  [GUNS_SOLD_BANNER_ART_ASSET] = ART_ASSET("guns sold banner",
+    "                                                        ▗▄▄▖▗▖ ▗▖▗▖  ▗▖ ▗▄▄▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
+    "                                                       ▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌       ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
+    "                                                       ▐▌▝▜▌▐▌ ▐▌▐▌ ▝▜▌ ▝▀▚▖     ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
+    "                                                       ▝▚▄▞▘▝▚▄▞▘▐▌  ▐▌▗▄▄▞▘    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n"),
+  [SHIP_UPGRADE_MENU_BANNER_ART_ASSET] = ART_ASSET("ship upgrade menu banner",
+    "                                                 ▗▄▄▖▗▖ ▗▖▗▄▄▄▖▗▄▄▖     ▗▖ ▗▖▗▄▄▖  ▗▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▄ ▗▄▄▄▖\n"
+    "                                                ▐▌   ▐▌ ▐▌  █  ▐▌ ▐▌    ▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌  █▐▌\n"
+    "                                                 ▝▀▚▖▐▛▀▜▌  █  ▐▛▀▘     ▐▌ ▐▌▐▛▀▘ ▐▌▝▜▌▐▛▀▚▖▐▛▀▜▌▐▌  █▐▛▀▀▘\n"
+    "                                                ▗▄▄▞▘▐▌ ▐▌▗▄█▄▖▐▌       ▝▚▄▞▘▐▌   ▝▚▄▞▘▐▌ ▐▌▐▌ ▐▌▐▙▄▄▀▐▙▄▄▖\n"),
+  [SHIP_UPGRADED_BANNER_ART_ASSET] = ART_ASSET("ship upgraded banner",
+    "                                               ▗▄▄▖▗▖ ▗▖▗▄▄▄▖▗▄▄▖     ▗▖ ▗▖▗▄▄▖  ▗▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▄ ▗▄▄▄▖▗▄▄▄\n"
+    "                                              ▐▌   ▐▌ ▐▌  █  ▐▌ ▐▌    ▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌  █▐▌   ▐▌  █\n"
+    "                                               ▝▀▚▖▐▛▀▜▌  █  ▐▛▀▘     ▐▌ ▐▌▐▛▀▘ ▐▌▝▜▌▐▛▀▚▖▐▛▀▜▌▐▌  █▐▛▀▀▘▐▌  █\n"
+    "                                              ▗▄▄▞▘▐▌ ▐▌▗▄█▄▖▐▌       ▝▚▄▞▘▐▌   ▝▚▄▞▘▐▌ ▐▌▐▌ ▐▌▐▙▄▄▀▐▙▄▄▖▐▙▄▄▀\n"),
+  [NAVIGATION_BANNER_ART_ASSET] = ART_ASSET("navigation banner",
+    "                                                    ▗▖  ▗▖ ▗▄▖ ▗▖  ▗▖▗▄▄▄▖ ▗▄▄▖ ▗▄▖▗▄▄▄▖▗▄▄▄▖ ▗▄▖ ▗▖  ▗▖\n"
+    "                                                    ▐▛▚▖▐▌▐▌ ▐▌▐▌  ▐▌  █  ▐▌   ▐▌ ▐▌ █    █  ▐▌ ▐▌▐▛▚▖▐▌\n"
+    "                                                    ▐▌ ▝▜▌▐▛▀▜▌▐▌  ▐▌  █  ▐▌▝▜▌▐▛▀▜▌ █    █  ▐▌ ▐▌▐▌ ▝▜▌\n"
+    "                                                    ▐▌  ▐▌▐▌ ▐▌ ▝▚▞▘ ▗▄█▄▖▝▚▄▞▘▐▌ ▐▌ █  ▗▄█▄▖▝▚▄▞▘▐▌  ▐▌\n"),
+  [TONDO_MAP_ART_ASSET] = ART_ASSET("Tondo map",
+    "                                           You are here!\n"
+    "                                                 ↓\n"
+    "                                               Tondo\n"
+    "                                                 ◯\n" COLOR_BLUE
+    "                                                 ║\n"
+    "                                                 ║\n"
+    "                                                 ║     "   COLOR_DEFAULT "Manila" COLOR_BLUE    "       ╔╗                    "                                    "╔╗\n"
+    "                                                 ╚═══════" COLOR_DEFAULT   "◯"    COLOR_BLUE "══════════╝║       "    COLOR_DEFAULT "Pandakan" COLOR_BLUE     "     ║╚═══════╗\n"
+    "                                                         " COLOR_DEFAULT   "↑"    COLOR_BLUE "           ╚══════════" COLOR_DEFAULT    "◯"     COLOR_BLUE "═════════╝       ╔╝    " COLOR_DEFAULT "Sapa" COLOR_BLUE "\n"
+    "                                                                                                  "                                                                        "╚══════" COLOR_DEFAULT "◯\n"),
+  [MANILA_MAP_ART_ASSET] = ART_ASSET("Manila map",
+    "                                               Tondo\n"
+    "                                                 ◯\n" COLOR_BLUE
+    "                                                 ║\n"
+    "                                                 ║\n"
+    "                                                 ║     "   COLOR_DEFAULT "Manila" COLOR_BLUE       "       ╔╗                    "                                    "╔╗\n"
+    "                                                 ╚═══════" COLOR_DEFAULT   "◯"    COLOR_BLUE    "══════════╝║       "    COLOR_DEFAULT "Pandakan" COLOR_BLUE     "     ║╚═══════╗\n"
+    "                                                         " COLOR_DEFAULT   "↑"    COLOR_BLUE    "           ╚══════════" COLOR_DEFAULT    "◯"     COLOR_BLUE "═════════╝       ╔╝    " COLOR_DEFAULT "Sapa\n"
+    "                                                   "                 "You are here!" COLOR_BLUE "                                  "                                          "╚══════" COLOR_DEFAULT "◯\n"),
+  [PANDAKAN_MAP_ART_ASSET] = ART_ASSET("Pandakan map",
+    "                                               Tondo\n"
+    "                                                 ◯\n" COLOR_BLUE
+    "                                                 ║\n"
+    "                                                 ║\n"
+    "                                                 ║     "   COLOR_DEFAULT "Manila" COLOR_BLUE    "       ╔╗                    "                                    "╔╗\n"
+    "                                                 ╚═══════" COLOR_DEFAULT   "◯"    COLOR_BLUE "══════════╝║       "    COLOR_DEFAULT "Pandakan" COLOR_BLUE     "     ║╚═══════╗\n"
+    "                                                         " COLOR_DEFAULT   "↑"    COLOR_BLUE "           ╚══════════" COLOR_DEFAULT    "◯"     COLOR_BLUE "═════════╝       ╔╝    " COLOR_DEFAULT "Sapa" COLOR_BLUE "\n"
+    "                                                                                "                                                      "↑"     COLOR_BLUE "                 ╚══════" COLOR_DEFAULT "◯\n"
+    "                                                                          "                                                      "You are here!\n"),
+  [SAPA_MAP_ART_ASSET] = ART_ASSET("Sapa map",
+    "                                               Tondo\n"
+    "                                                 ◯\n" COLOR_BLUE
+    "                                                 ║\n"
+    "                                                 ║\n"
+    "                                                 ║     "   COLOR_DEFAULT "Manila" COLOR_BLUE    "       ╔╗                    "                                    "╔╗\n"
+    "                                                 ╚═══════" COLOR_DEFAULT   "◯"    COLOR_BLUE "══════════╝║       "    COLOR_DEFAULT "Pandakan" COLOR_BLUE     "     ║╚═══════╗\n"
+    "                                                         " COLOR_DEFAULT   "↑"    COLOR_BLUE "           ╚══════════" COLOR_DEFAULT    "◯"     COLOR_BLUE "═════════╝       ╔╝    " COLOR_DEFAULT "Sapa" COLOR_BLUE "\n"
+    "                                                                                                  "                                                                        "╚══════" COLOR_DEFAULT "◯\n"
+    "                                                                                                         "                                                                                         "↑\n"
+    "                                                                                                   "                                                                                         "You are here!\n"),
+  [DEPARTED_BANNER_ART_ASSET] = ART_ASSET("departed banner",
+    "                                               ▗▄▄▄ ▗▄▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▖▗▄▄▄▖▗▄▄▄▖▗▄▄▄     ▗▄▄▖  ▗▄▖ ▗▄▄▖▗▄▄▄▖\n"
+    "                                               ▐▌  █▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌ █  ▐▌   ▐▌  █    ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌ █\n"
+    "                                               ▐▌  █▐▛▀▀▘▐▛▀▘ ▐▛▀▜▌▐▛▀▚▖ █  ▐▛▀▀▘▐▌  █    ▐▛▀▘ ▐▌ ▐▌▐▛▀▚▖ █\n"
+    "                                               ▐▙▄▄▀▐▙▄▄▖▐▌   ▐▌ ▐▌▐▌ ▐▌ █  ▐▙▄▄▖▐▙▄▄▀    ▐▌   ▝▚▄▞▘▐▌ ▐▌ █\n"),
+  [DEPARTURE_POSTPONED_BANNER_ART_ASSET] = ART_ASSET("departure postponed banner",
+    "                               ▗▄▄▄ ▗▄▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▖▗▄▄▄▖▗▖ ▗▖▗▄▄▖ ▗▄▄▄▖    ▗▄▄▖  ▗▄▖  ▗▄▄▖▗▄▄▄▖▗▄▄▖  ▗▄▖ ▗▖  ▗▖▗▄▄▄▖▗▄▄▄ \n"
+    "                               ▐▌  █▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌ █  ▐▌ ▐▌▐▌ ▐▌▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌     █  ▐▌ ▐▌▐▌ ▐▌▐▛▚▖▐▌▐▌   ▐▌  █\n"
+    "                               ▐▌  █▐▛▀▀▘▐▛▀▘ ▐▛▀▜▌▐▛▀▚▖ █  ▐▌ ▐▌▐▛▀▚▖▐▛▀▀▘    ▐▛▀▘ ▐▌ ▐▌ ▝▀▚▖  █  ▐▛▀▘ ▐▌ ▐▌▐▌ ▝▜▌▐▛▀▀▘▐▌  █\n"
+    "                               ▐▙▄▄▀▐▙▄▄▖▐▌   ▐▌ ▐▌▐▌ ▐▌ █  ▝▚▄▞▘▐▌ ▐▌▐▙▄▄▖    ▐▌   ▝▚▄▞▘▗▄▄▞▘  █  ▐▌   ▝▚▄▞▘▐▌  ▐▌▐▙▄▄▖▐▙▄▄▀\n"),
+  [WEATHER_REPORT_BANNER_ART_ASSET] = ART_ASSET("weather report banner",
+    COLOR_BLUE "                                            ▗▖ ▗▖▗▄▄▄▖ ▗▄▖▗▄▄▄▖▗▖ ▗▖▗▄▄▄▖▗▄▄▖     ▗▄▄▖ ▗▄▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▖▗▄▄▄▖\n"
+    "                                            ▐▌ ▐▌▐▌   ▐▌ ▐▌ █  ▐▌ ▐▌▐▌   ▐▌ ▐▌    ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌ █\n"
+    "                                            ▐▌ ▐▌▐▛▀▀▘▐▛▀▜▌ █  ▐▛▀▜▌▐▛▀▀▘▐▛▀▚▖    ▐▛▀▚▖▐▛▀▀▘▐▛▀▘ ▐▌ ▐▌▐▛▀▚▖ █\n"
+    "                                            ▐▙█▟▌▐▙▄▄▖▐▌ ▐▌ █  ▐▌ ▐▌▐▙▄▄▖▐▌ ▐▌    ▐▌ ▐▌▐▙▄▄▖▐▌   ▝▚▄▞▘▐▌ ▐▌ █\n" COLOR_DEFAULT),
+  [SIGNAL_ONE_CARD_ART_ASSET] = ART_ASSET("signal no. 1 card",
+    "                                          .----------------.\n"
+    "                                         | .--------------. |\n"
+    "                                         | |     __       | |\n"
+    "                                         | |    /  |      | |\n"
+    "                                         | |    `| |      | |        Tropical Depression (TD)\n"
+    "                                         | |     | |      | |        <= 61 km/h\n"
+    "                                         | |    _| |_     | |        Minimal to minor threat to life and property.\n"
+    "                                         | |   |_____|    | |\n"
+    "                                         | |              | |\n"
+    "                                         | '--------------' |\n"
+    "                                          '----------------'\n"),
+  [SIGNAL_TWO_CARD_ART_ASSET] = ART_ASSET("signal no. 2 card",
+    COLOR_CYAN "                                          .----------------.\n"
+    "                                         | .--------------. |\n"
+    "                                         | |    _____     | |\n"
+    "                                         | |   / ___ `.   | |\n"
+    "                                         | |  |_/___) |   | |        Tropical Storm (TS)\n"
+    "                                         | |   .'____.'   | |        62 - 88 km/h\n"
+    "                                         | |  / /____     | |        Minor to moderate threat to life and property.\n"
+    "                                         | |  |_______|   | |\n"
+    "                                         | |              | |\n"
+    "                                         | '--------------' |\n"
+    "                                          '----------------'\n" COLOR_DEFAULT),
+  [SIGNAL_THREE_CARD_ART_ASSET] = ART_ASSET("signal no. 3 card",
+    COLOR_YELLOW "                                       .----------------.\n"
+    "                                      | .--------------. |\n"
+    "                                      | |    ______    | |\n"
+    "                                      | |   / ____ `.  | |\n"
+    "                                      | |   `'  __) |  | |        Severe Tropical Storm (STS)\n"
+    "                                      | |   _  |__ '.  | |        89 - 117 km/h\n"
+    "                                      | |  | \\____) |  | |        Moderate to significant threat to life and property.\n"
+    "                                      | |   \\______.'  | |\n"
+    "                                      | |              | |\n"
+    "                                      | '--------------' |\n"
+    "                                       '----------------'\n" COLOR_DEFAULT),
+  [SIGNAL_FOUR_CARD_ART_ASSET] = ART_ASSET("signal no. 4 card",
+    COLOR_RED "                                        .----------------.\n"
+    "                                       | .--------------. |\n"
+    "                                       | |   _    _     | |\n"
+    "                                       | |  | |  | |    | |\n"
+    "                                       | |  | |__| |_   | |        Typhoon (TY)\n"
+    "                                       | |  |____   _|  | |        118 - 184 km/h\n"
+    "                                       | |      _| |_   | |        Significant to severe threat to life and property.\n"
+    "                                       | |     |_____|  | |\n"
+    "                                       | |              | |\n"
+    "                                       | '--------------' |\n"
+    "                                        '----------------'\n" COLOR_DEFAULT),
+  [SIGNAL_FIVE_CARD_ART_ASSET] = ART_ASSET("signal no. 5 card",
+    COLOR_PURPLE "                                               .----------------.\n"
+    "                                              | .--------------. |\n"
+    "                                              | |   _______    | |\n"
+    "                                              | |  |  _____|   | |\n"
+    "                                              | |  | |____     | |        Super Typhoon (STY)\n"
+    "                                              | |  '_.____''.  | |        >= 185 km/h\n"
+    "                                              | |  | \\____) |  | |        Extreme threat to life and property.\n"
+    "                                              | |   \\______.'  | |\n"
+    "                                              | |              | |\n"
+    "                                              | '--------------' |\n"
+    "                                               '----------------'\n" COLOR_DEFAULT),
+  [VICTORY_BANNER_ART_ASSET] = ART_ASSET("victory banner",
+    COLOR_YELLOW "                                              ██╗   ██╗ ██████╗ ██╗   ██╗    ██╗    ██╗ ██████╗ ███╗   ██╗██╗\n"
+    "                                              ╚██╗ ██╔╝██╔═══██╗██║   ██║    ██║    ██║██╔═══██╗████╗  ██║██║\n"
+    "                                               ╚████╔╝ ██║   ██║██║   ██║    ██║ █╗ ██║██║   ██║██╔██╗ ██║██║\n"
+    "                                                ╚██╔╝  ██║   ██║██║   ██║    ██║███╗██║██║   ██║██║╚██╗██║╚═╝\n"
+    "                                                 ██║   ╚██████╔╝╚██████╔╝    ╚███╔███╔╝╚██████╔╝██║ ╚████║██╗\n"
+    "                                                 ╚═╝    ╚═════╝  ╚═════╝      ╚══╝╚══╝  ╚═════╝ ╚═╝  ╚═══╝╚═╝\n"),
+  [VICTORY_TROPHY_ART_ASSET] = ART_ASSET("victory trophy",
+    "                                                                       ___________\n"
+    "                                                                      '._==_==_=_.'\n"
+    "                                                                      .-\\:      /-.\n"
+    "                                                                      | (|:.    ) |\n"
+    "                                                                      '-|:.     |-'\n"
+    "                                                                        \\::.    /\n"
+    "                                                                         '::. .'\n"
+    "                                                                           ) (\n"
+    "                                                                         _.' '._\n"
+    "                                                                        `\"\"\"\"\"\"\"`\n" COLOR_DEFAULT),
+  [DEFEAT_BANNER_ART_ASSET] = ART_ASSET("defeat banner",
+    COLOR_RED "                                            ██╗   ██╗ ██████╗ ██╗   ██╗    ██╗      ██████╗ ███████╗████████╗██╗\n"
+    "                                            ╚██╗ ██╔╝██╔═══██╗██║   ██║    ██║     ██╔═══██╗██╔════╝╚══██╔══╝██║\n"
+    "                                             ╚████╔╝ ██║   ██║██║   ██║    ██║     ██║   ██║███████╗   ██║   ██║\n"
+    "                                              ╚██╔╝  ██║   ██║██║   ██║    ██║     ██║   ██║╚════██║   ██║   ╚═╝\n"
+    "                                               ██║   ╚██████╔╝╚██████╔╝    ███████╗╚██████╔╝███████║   ██║   ██╗\n"
+    "                                               ╚═╝    ╚═════╝  ╚═════╝     ╚══════╝ ╚═════╝ ╚══════╝   ╚═╝   ╚═╝\n" COLOR_DEFAULT),
+};
+// clang-format on
+
+static long nArtAssetUseCounts[ART_ASSET_COUNT];
+
+/**
+ * Gets the passed art asset, which includes any color escape sequences it is drawn with.
+ * @param nArtAssetIndex The index of the art asset.
+ * @pre @p nArtAssetIndex must be less than `ART_ASSET_COUNT`.
+ * @returns The art asset, which is stored in read-only memory.
+ */
+const ArtAsset *getArtAsset(int nArtAssetIndex) { return &artAssets[nArtAssetIndex]; }
+
+/**
+ * Copies the passed art asset into the open frame and counts it towards the asset's usage, unless the output is
+ * discarded.
+ * @param nArtAssetIndex The index of the art asset.
+ * @pre @p nArtAssetIndex must be less than `ART_ASSET_COUNT`.
+ * @pre A frame must be open.
+ */
+void appendArtAsset(int nArtAssetIndex) {
+  if (isOutputDiscarded()) return;
+
+  appendFrameBytes(artAssets[nArtAssetIndex].pBytes, artAssets[nArtAssetIndex].nByteCount);
+
+  nArtAssetUseCounts[nArtAssetIndex]++;
+}
+
+/**
+ * Gets the number of times the passed art asset has been appended to a frame.
+ * @param nArtAssetIndex The index of the art asset.
+ * @pre @p nArtAssetIndex must be less than `ART_ASSET_COUNT`.
+ * @returns A non-negative integer value.
+ */
+long getArtAssetUseCount(int nArtAssetIndex) { return nArtAssetUseCounts[nArtAssetIndex]; }
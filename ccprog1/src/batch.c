@@ -0,0 +1,556 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "batch.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "prompts.h"
+#include "random.h"
+#include "weather.h"
+
+#if CARGO_COUNT > RANDOM_LOOKAHEAD_COUNT
+#error "Market prices are drawn by jumping ahead once per cargo, which needs a jump for every cargo."
+#endif
+
+static const int32_t POSTPONED_DEPARTURE_CHANCES[MAXIMUM_WIND_SIGNAL_NUMBER + 1] = {
+  DEFAULT_POSTPONED_DEPARTURE_CHANCE,           DEFAULT_POSTPONED_DEPARTURE_CHANCE,
+  DEFAULT_POSTPONED_DEPARTURE_CHANCE,           SIGNAL_THREE_STORM_POSTPONED_DEPARTURE_CHANCE,
+  SIGNAL_FOUR_STORM_POSTPONED_DEPARTURE_CHANCE, SIGNAL_FIVE_STORM_POSTPONED_DEPARTURE_CHANCE};
+
+/**
+ * Allocates a zeroed array aligned for vector loads.
+ * @param nSize The size of the array in bytes.
+ * @returns A pointer to the array or `NULL` if it could not be allocated.
+ */
+static void *allocateBatchArray(size_t nSize) {
+  void *pArray;
+
+  if (posix_memalign(&pArray, BATCH_ALIGNMENT, nSize) != 0) return NULL;
+
+  memset(pArray, 0, nSize);
+
+  return pArray;
+}
+
+/**
+ * Allocates the aligned arrays of a batch that can hold the passed number of games.
+ * @param[out] pGameBatch The batch to allocate.
+ * @param nGameCount The number of games in the batch.
+ * @returns `0` if the batch was allocated or `-1` if it could not be.
+ */
+int createGameBatch(GameBatch *pGameBatch, int nGameCount) {
+  size_t nIntegerArraySize = sizeof(int32_t) * nGameCount;
+  size_t nStateArraySize = sizeof(uint64_t) * nGameCount;
+
+  memset(pGameBatch, 0, sizeof(GameBatch));
+
+  pGameBatch->nGameCount = nGameCount;
+  pGameBatch->pPlayerBalances = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pShipCargoLimits = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pPortIndices = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pStormTurnDurations = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pIsNewStorms = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pStormWindSignalNumbers = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pPostponedDepartureChances = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pRandomStates = allocateBatchArray(nStateArraySize);
+  pGameBatch->pRandomIncrements = allocateBatchArray(nStateArraySize);
+  pGameBatch->pDrawMasks = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pFixupMasks = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pBounds = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pLowBits = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pRandomNumbers = allocateBatchArray(nIntegerArraySize);
+  pGameBatch->pTargetPortIndices = allocateBatchArray(nIntegerArraySize);
+
+  int bIsAllocated = pGameBatch->pPlayerBalances && pGameBatch->pShipCargoLimits && pGameBatch->pPortIndices &&
+                     pGameBatch->pStormTurnDurations && pGameBatch->pIsNewStorms &&
+                     pGameBatch->pStormWindSignalNumbers && pGameBatch->pPostponedDepartureChances &&
+                     pGameBatch->pRandomStates && pGameBatch->pRandomIncrements && pGameBatch->pDrawMasks &&
+                     pGameBatch->pFixupMasks && pGameBatch->pBounds && pGameBatch->pLowBits &&
+                     pGameBatch->pRandomNumbers && pGameBatch->pTargetPortIndices;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+    pGameBatch->pShipCargoAmounts[nCargoIndex] = allocateBatchArray(nIntegerArraySize);
+    pGameBatch->pMarketPrices[nCargoIndex] = allocateBatchArray(nIntegerArraySize);
+
+    if (!pGameBatch->pShipCargoAmounts[nCargoIndex] || !pGameBatch->pMarketPrices[nCargoIndex]) bIsAllocated = 0;
+  }
+
+  if (!bIsAllocated) {
+    destroyGameBatch(pGameBatch);
+
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * Frees the arrays of the passed batch.
+ * @param[in,out] pGameBatch The batch to free.
+ */
+void destroyGameBatch(GameBatch *pGameBatch) {
+  free(pGameBatch->pPlayerBalances);
+  free(pGameBatch->pShipCargoLimits);
+  free(pGameBatch->pPortIndices);
+  free(pGameBatch->pStormTurnDurations);
+  free(pGameBatch->pIsNewStorms);
+  free(pGameBatch->pStormWindSignalNumbers);
+  free(pGameBatch->pPostponedDepartureChances);
+  free(pGameBatch->pRandomStates);
+  free(pGameBatch->pRandomIncrements);
+  free(pGameBatch->pDrawMasks);
+  free(pGameBatch->pFixupMasks);
+  free(pGameBatch->pBounds);
+  free(pGameBatch->pLowBits);
+  free(pGameBatch->pRandomNumbers);
+  free(pGameBatch->pTargetPortIndices);
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+    free(pGameBatch->pShipCargoAmounts[nCargoIndex]);
+    free(pGameBatch->pMarketPrices[nCargoIndex]);
+  }
+
+  memset(pGameBatch, 0, sizeof(GameBatch));
+}
+
+/**
+ * Generates a bounded random number for every game whose draw mask is set, leaving the generators of the other games
+ * untouched. The rare draws that multiply-shift sampling must reject are redrawn afterwards one game at a time, so
+ * every game consumes exactly the same numbers as `generateBoundedRandomNumber`.
+ * @param[in,out] pGameBatch The batch whose draw masks, bounds, and random numbers to use.
+ */
+static void drawBatchRandomNumbers(GameBatch *pGameBatch) {
+  int nGameCount = pGameBatch->nGameCount;
+  uint64_t *restrict pRandomStates = pGameBatch->pRandomStates;
+  const uint64_t *restrict pRandomIncrements = pGameBatch->pRandomIncrements;
+  const int32_t *restrict pDrawMasks = pGameBatch->pDrawMasks;
+  const uint32_t *restrict pBounds = pGameBatch->pBounds;
+  int32_t *restrict pFixupMasks = pGameBatch->pFixupMasks;
+  uint32_t *restrict pLowBits = pGameBatch->pLowBits;
+  uint32_t *restrict pRandomNumbers = pGameBatch->pRandomNumbers;
+  int bHasFixups = 0;
+
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    uint64_t nOldState = pRandomStates[nGameIndex];
+    uint64_t nProduct = (uint64_t)permuteRandomState(nOldState) * pBounds[nGameIndex];
+
+    pRandomStates[nGameIndex] =
+      pDrawMasks[nGameIndex] ? nOldState * PCG_MULTIPLIER + pRandomIncrements[nGameIndex] : nOldState;
+    pRandomNumbers[nGameIndex] = (uint32_t)(nProduct >> 32);
+    pLowBits[nGameIndex] = (uint32_t)nProduct;
+    pFixupMasks[nGameIndex] = pDrawMasks[nGameIndex] & ((uint32_t)nProduct < pBounds[nGameIndex]);
+    bHasFixups |= pFixupMasks[nGameIndex];
+  }
+
+  if (!bHasFixups) return;
+
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    if (!pFixupMasks[nGameIndex]) continue;
+
+    RandomGenerator randomGenerator = {pRandomStates[nGameIndex], pRandomIncrements[nGameIndex]};
+    uint32_t nBound = pBounds[nGameIndex];
+    uint32_t nThreshold = (0u - nBound) % nBound;
+
+    while (pLowBits[nGameIndex] < nThreshold) {
+      uint64_t nProduct = (uint64_t)generateRandomNumber(&randomGenerator) * nBound;
+
+      pLowBits[nGameIndex] = (uint32_t)nProduct;
+      pRandomNumbers[nGameIndex] = (uint32_t)(nProduct >> 32);
+    }
+
+    pRandomStates[nGameIndex] = randomGenerator.nState;
+  }
+}
+
+/**
+ * Sets up every game of the batch exactly like `initializeGame`, where game `i` is seeded with `nBaseSeed + i`.
+ * @param[in,out] pGameBatch The batch to set up.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nBaseSeed The seed of the first game.
+ */
+void initializeGameBatch(GameBatch *pGameBatch, int nPlayerInitialBalance, int nPlayerProfitTarget,
+                         uint64_t nBaseSeed) {
+  pGameBatch->nPlayerTurns = 0;
+  pGameBatch->nPlayerInitialBalance = nPlayerInitialBalance;
+  pGameBatch->nPlayerProfitTarget = nPlayerProfitTarget;
+
+  for (int nPortIndex = 0; nPortIndex < PORT_COUNT; nPortIndex++) {
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      int nMinimumPrice;
+      int nMaximumPrice;
+      int nBestDoubledExpectedPrice = 0;
+
+      getCargoPriceRange(PORT_IDS[nPortIndex], CARGO_IDS[nCargoIndex], &nMinimumPrice, &nMaximumPrice);
+
+      for (int nOtherPortIndex = 0; nOtherPortIndex < PORT_COUNT; nOtherPortIndex++) {
+        int nOtherMinimumPrice;
+        int nOtherMaximumPrice;
+
+        if (nOtherPortIndex == nPortIndex) continue;
+
+        getCargoPriceRange(PORT_IDS[nOtherPortIndex], CARGO_IDS[nCargoIndex], &nOtherMinimumPrice,
+                           &nOtherMaximumPrice);
+
+        if (nOtherMinimumPrice + nOtherMaximumPrice > nBestDoubledExpectedPrice) {
+          nBestDoubledExpectedPrice = nOtherMinimumPrice + nOtherMaximumPrice;
+        }
+      }
+
+      pGameBatch->nDoubledExpectedPrices[nPortIndex][nCargoIndex] = nMinimumPrice + nMaximumPrice;
+      pGameBatch->nBestDoubledExpectedPrices[nPortIndex][nCargoIndex] = nBestDoubledExpectedPrice;
+    }
+  }
+
+  for (int nGameIndex = 0; nGameIndex < pGameBatch->nGameCount; nGameIndex++) {
+    RandomGenerator randomGenerator;
+
+    seedRandomGenerator(&randomGenerator, nBaseSeed + nGameIndex);
+
+    pGameBatch->pPlayerBalances[nGameIndex] = nPlayerInitialBalance;
+    pGameBatch->pShipCargoLimits[nGameIndex] = TIER_ONE_SHIP_CARGO_LIMIT;
+    pGameBatch->pPortIndices[nGameIndex] = getPortIndex(INITIAL_PORT_ID);
+    pGameBatch->pStormTurnDurations[nGameIndex] = 0;
+    pGameBatch->pIsNewStorms[nGameIndex] = 0;
+    pGameBatch->pStormWindSignalNumbers[nGameIndex] = 0;
+    pGameBatch->pPostponedDepartureChances[nGameIndex] = DEFAULT_POSTPONED_DEPARTURE_CHANCE;
+    pGameBatch->pRandomStates[nGameIndex] = randomGenerator.nState;
+    pGameBatch->pRandomIncrements[nGameIndex] = randomGenerator.nIncrement;
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      pGameBatch->pShipCargoAmounts[nCargoIndex][nGameIndex] = 0;
+    }
+  }
+
+  generateBatchMarketPrices(pGameBatch);
+}
+
+/**
+ * Generates new market prices for every game based on the price ranges of its current port. Each game jumps straight
+ * to the states of all its cargo draws, so the whole batch is generated in a single vectorized pass.
+ * @param[in,out] pGameBatch The batch whose market prices to generate.
+ */
+void generateBatchMarketPrices(GameBatch *pGameBatch) {
+  int nGameCount = pGameBatch->nGameCount;
+  const int32_t *restrict pPortIndices = pGameBatch->pPortIndices;
+  uint64_t *restrict pRandomStates = pGameBatch->pRandomStates;
+  const uint64_t *restrict pRandomIncrements = pGameBatch->pRandomIncrements;
+  int32_t *restrict pFixupMasks = pGameBatch->pFixupMasks;
+  int32_t *restrict pCoconutMarketPrices = pGameBatch->pMarketPrices[0];
+  int32_t *restrict pRiceMarketPrices = pGameBatch->pMarketPrices[1];
+  int32_t *restrict pSilkMarketPrices = pGameBatch->pMarketPrices[2];
+  int32_t *restrict pGunMarketPrices = pGameBatch->pMarketPrices[3];
+  int bHasFixups = 0;
+
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    int nPortIndex = pPortIndices[nGameIndex];
+    uint64_t nState = pRandomStates[nGameIndex];
+    uint64_t nIncrement = pRandomIncrements[nGameIndex];
+    int32_t nMarketPrices[CARGO_COUNT];
+    int32_t bMayReject = 0;
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      uint64_t nJumpedState =
+        PCG_JUMP_MULTIPLIERS[nCargoIndex] * nState + PCG_JUMP_INCREMENT_FACTORS[nCargoIndex] * nIncrement;
+      uint32_t nBound = CARGO_PRICE_RANGES[nPortIndex][nCargoIndex];
+      uint64_t nProduct = (uint64_t)permuteRandomState(nJumpedState) * nBound;
+
+      nMarketPrices[nCargoIndex] = MINIMUM_CARGO_PRICES[nPortIndex][nCargoIndex] + (int32_t)(nProduct >> 32);
+      bMayReject |= (uint32_t)nProduct < nBound;
+    }
+
+    pCoconutMarketPrices[nGameIndex] = nMarketPrices[0];
+    pRiceMarketPrices[nGameIndex] = nMarketPrices[1];
+    pSilkMarketPrices[nGameIndex] = nMarketPrices[2];
+    pGunMarketPrices[nGameIndex] = nMarketPrices[3];
+    pRandomStates[nGameIndex] =
+      bMayReject ? nState
+                 : PCG_JUMP_MULTIPLIERS[CARGO_COUNT] * nState + PCG_JUMP_INCREMENT_FACTORS[CARGO_COUNT] * nIncrement;
+    pFixupMasks[nGameIndex] = bMayReject;
+    bHasFixups |= bMayReject;
+  }
+
+  if (!bHasFixups) return;
+
+  // The rare games whose draws may be rejected still hold their old states, so they are simply drawn again in order.
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    if (!pFixupMasks[nGameIndex]) continue;
+
+    RandomGenerator randomGenerator = {pRandomStates[nGameIndex], pRandomIncrements[nGameIndex]};
+    int nMarketPrices[CARGO_COUNT];
+
+    generateCargoPrices(&randomGenerator, pPortIndices[nGameIndex], nMarketPrices);
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      pGameBatch->pMarketPrices[nCargoIndex][nGameIndex] = nMarketPrices[nCargoIndex];
+    }
+
+    pRandomStates[nGameIndex] = randomGenerator.nState;
+  }
+}
+
+/**
+ * Applies the trades and upgrades that the greedy policy makes before sailing to every game of the batch.
+ * @param[in,out] pGameBatch The batch to trade in.
+ */
+void tradeBatchGreedily(GameBatch *pGameBatch) {
+  int bIsLastTurn = pGameBatch->nPlayerTurns == MAXIMUM_PLAYER_TURNS - 1;
+  int bCanUpgrade = pGameBatch->nPlayerTurns < MAXIMUM_PLAYER_TURNS / 2;
+
+  for (int nGameIndex = 0; nGameIndex < pGameBatch->nGameCount; nGameIndex++) {
+    int nPortIndex = pGameBatch->pPortIndices[nGameIndex];
+    int nPlayerBalance = pGameBatch->pPlayerBalances[nGameIndex];
+    int nShipCargoLimit = pGameBatch->pShipCargoLimits[nGameIndex];
+    int nShipCargoAmounts[CARGO_COUNT];
+    int nMarketPrices[CARGO_COUNT];
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      nShipCargoAmounts[nCargoIndex] = pGameBatch->pShipCargoAmounts[nCargoIndex][nGameIndex];
+      nMarketPrices[nCargoIndex] = pGameBatch->pMarketPrices[nCargoIndex][nGameIndex];
+
+      if (nShipCargoAmounts[nCargoIndex] > 0 &&
+          (bIsLastTurn ||
+           nMarketPrices[nCargoIndex] * 2 >= pGameBatch->nBestDoubledExpectedPrices[nPortIndex][nCargoIndex])) {
+        nPlayerBalance += nMarketPrices[nCargoIndex] * nShipCargoAmounts[nCargoIndex];
+        nShipCargoAmounts[nCargoIndex] = 0;
+      }
+    }
+
+    if (!bIsLastTurn) {
+      int nShipUpgradeCost;
+      int nShipNewCargoLimit;
+
+      while (bCanUpgrade && getShipUpgrade(nShipCargoLimit, &nShipUpgradeCost, &nShipNewCargoLimit) &&
+             nPlayerBalance >= nShipUpgradeCost * 2) {
+        nPlayerBalance -= nShipUpgradeCost;
+        nShipCargoLimit = nShipNewCargoLimit;
+      }
+
+      for (int nBuyCount = 0; nBuyCount < CARGO_COUNT; nBuyCount++) {
+        int nShipFreeCargoSpace = nShipCargoLimit - nShipCargoAmounts[0] - nShipCargoAmounts[1] -
+                                  nShipCargoAmounts[2] - nShipCargoAmounts[3];
+        long nBestExpectedGain = 0;
+        int nBestCargoIndex = 0;
+        int nBestCargoAmount = 0;
+
+        for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+          int nCargoAmount = nPlayerBalance / nMarketPrices[nCargoIndex];
+
+          if (nCargoAmount > nShipFreeCargoSpace) nCargoAmount = nShipFreeCargoSpace;
+
+          long nExpectedGain =
+            (long)(pGameBatch->nBestDoubledExpectedPrices[nPortIndex][nCargoIndex] - nMarketPrices[nCargoIndex] * 2) *
+            nCargoAmount;
+
+          if (nCargoAmount > 0 && nExpectedGain > nBestExpectedGain) {
+            nBestExpectedGain = nExpectedGain;
+            nBestCargoIndex = nCargoIndex;
+            nBestCargoAmount = nCargoAmount;
+          }
+        }
+
+        if (nBestExpectedGain <= 0) break;
+
+        nPlayerBalance -= nMarketPrices[nBestCargoIndex] * nBestCargoAmount;
+        nShipCargoAmounts[nBestCargoIndex] += nBestCargoAmount;
+      }
+    }
+
+    pGameBatch->pPlayerBalances[nGameIndex] = nPlayerBalance;
+    pGameBatch->pShipCargoLimits[nGameIndex] = nShipCargoLimit;
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      pGameBatch->pShipCargoAmounts[nCargoIndex][nGameIndex] = nShipCargoAmounts[nCargoIndex];
+    }
+  }
+}
+
+/**
+ * Chooses the port that the greedy policy sails to for every game of the batch.
+ * @param[in,out] pGameBatch The batch whose target port indices to set.
+ */
+void chooseBatchGreedyPorts(GameBatch *pGameBatch) {
+  for (int nGameIndex = 0; nGameIndex < pGameBatch->nGameCount; nGameIndex++) {
+    int nCurrentPortIndex = pGameBatch->pPortIndices[nGameIndex];
+    int nShipTotalCargoAmount = 0;
+    long nBestPortValue = -1;
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      nShipTotalCargoAmount += pGameBatch->pShipCargoAmounts[nCargoIndex][nGameIndex];
+    }
+
+    for (int nPortIndex = 0; nPortIndex < PORT_COUNT; nPortIndex++) {
+      long nPortValue = 0;
+
+      if (nPortIndex == nCurrentPortIndex) continue;
+
+      for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+        int nShipCargoAmount = pGameBatch->pShipCargoAmounts[nCargoIndex][nGameIndex];
+
+        if (nShipCargoAmount > 0) {
+          nPortValue += (long)pGameBatch->nDoubledExpectedPrices[nPortIndex][nCargoIndex] * nShipCargoAmount;
+        } else if (nShipTotalCargoAmount == 0) {
+          long nMargin = pGameBatch->nBestDoubledExpectedPrices[nPortIndex][nCargoIndex] -
+                         pGameBatch->nDoubledExpectedPrices[nPortIndex][nCargoIndex];
+
+          if (nMargin > nPortValue) nPortValue = nMargin;
+        }
+      }
+
+      if (nPortValue > nBestPortValue) {
+        nBestPortValue = nPortValue;
+        pGameBatch->pTargetPortIndices[nGameIndex] = nPortIndex;
+      }
+    }
+  }
+}
+
+/**
+ * Ends the turn of every game by sailing to its target port, advancing its weather, and generating its next market
+ * prices, which consumes random numbers in the same order as `stepGame`.
+ * @param[in,out] pGameBatch The batch to advance.
+ */
+void advanceBatchTurn(GameBatch *pGameBatch) {
+  int nGameCount = pGameBatch->nGameCount;
+  int32_t *pPortIndices = pGameBatch->pPortIndices;
+  const int32_t *pTargetPortIndices = pGameBatch->pTargetPortIndices;
+  int32_t *pStormTurnDurations = pGameBatch->pStormTurnDurations;
+  int32_t *pIsNewStorms = pGameBatch->pIsNewStorms;
+  int32_t *pStormWindSignalNumbers = pGameBatch->pStormWindSignalNumbers;
+  int32_t *pPostponedDepartureChances = pGameBatch->pPostponedDepartureChances;
+  int32_t *pDrawMasks = pGameBatch->pDrawMasks;
+  uint32_t *pBounds = pGameBatch->pBounds;
+  const uint32_t *pRandomNumbers = pGameBatch->pRandomNumbers;
+
+  // Departure, which every game attempts.
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    pDrawMasks[nGameIndex] = 1;
+    pBounds[nGameIndex] = 100;
+  }
+
+  drawBatchRandomNumbers(pGameBatch);
+
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    int bIsDepartureSuccessful =
+      (int32_t)pRandomNumbers[nGameIndex] + 1 <= 100 - pPostponedDepartureChances[nGameIndex];
+
+    pPortIndices[nGameIndex] = bIsDepartureSuccessful ? pTargetPortIndices[nGameIndex] : pPortIndices[nGameIndex];
+  }
+
+  pGameBatch->nPlayerTurns++;
+
+  // Storm formation, which only calm games roll for.
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    pDrawMasks[nGameIndex] = pStormTurnDurations[nGameIndex] == 0;
+    pStormTurnDurations[nGameIndex] = pStormTurnDurations[nGameIndex] == -1 ? 0 : pStormTurnDurations[nGameIndex];
+  }
+
+  drawBatchRandomNumbers(pGameBatch);
+
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    pDrawMasks[nGameIndex] = pDrawMasks[nGameIndex] & ((int32_t)pRandomNumbers[nGameIndex] + 1 <= 50);
+    pBounds[nGameIndex] = MAXIMUM_STORM_TURN_DURATION;
+  }
+
+  drawBatchRandomNumbers(pGameBatch);
+
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    int bIsStartingStorm = pDrawMasks[nGameIndex];
+
+    pStormTurnDurations[nGameIndex] =
+      bIsStartingStorm ? (int32_t)pRandomNumbers[nGameIndex] + 2 : pStormTurnDurations[nGameIndex];
+    pIsNewStorms[nGameIndex] = bIsStartingStorm ? 1 : pIsNewStorms[nGameIndex];
+    pStormWindSignalNumbers[nGameIndex] = bIsStartingStorm ? 1 : pStormWindSignalNumbers[nGameIndex];
+  }
+
+  // Storm progression, where only ongoing storms that are not new may strengthen.
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    int bIsStormActive = pStormTurnDurations[nGameIndex] > 0;
+    int nStormTurnDuration = pStormTurnDurations[nGameIndex] - bIsStormActive;
+    int bIsStormEnding = bIsStormActive & (nStormTurnDuration == 0);
+
+    pDrawMasks[nGameIndex] = bIsStormActive & !bIsStormEnding & !pIsNewStorms[nGameIndex] &
+                             (pStormWindSignalNumbers[nGameIndex] < MAXIMUM_WIND_SIGNAL_NUMBER);
+    pBounds[nGameIndex] = 100;
+    pStormTurnDurations[nGameIndex] = bIsStormEnding ? -1 : nStormTurnDuration;
+    pPostponedDepartureChances[nGameIndex] =
+      bIsStormEnding ? DEFAULT_POSTPONED_DEPARTURE_CHANCE : pPostponedDepartureChances[nGameIndex];
+    pIsNewStorms[nGameIndex] = bIsStormActive ? 0 : pIsNewStorms[nGameIndex];
+  }
+
+  drawBatchRandomNumbers(pGameBatch);
+
+  for (int nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    int bIsStrengthening = pDrawMasks[nGameIndex] & ((int32_t)pRandomNumbers[nGameIndex] + 1 <= 50);
+    int nStormWindSignalNumber = pStormWindSignalNumbers[nGameIndex] + bIsStrengthening;
+
+    pStormWindSignalNumbers[nGameIndex] = nStormWindSignalNumber;
+    pPostponedDepartureChances[nGameIndex] = bIsStrengthening ? POSTPONED_DEPARTURE_CHANCES[nStormWindSignalNumber]
+                                                              : pPostponedDepartureChances[nGameIndex];
+  }
+
+  if (pGameBatch->nPlayerTurns < MAXIMUM_PLAYER_TURNS) generateBatchMarketPrices(pGameBatch);
+}
+
+/**
+ * Plays every game of the batch to the end with the greedy policy.
+ * @param[in,out] pGameBatch The batch to play.
+ */
+void playBatchGreedily(GameBatch *pGameBatch) {
+  while (pGameBatch->nPlayerTurns < MAXIMUM_PLAYER_TURNS) {
+    tradeBatchGreedily(pGameBatch);
+    chooseBatchGreedyPorts(pGameBatch);
+    advanceBatchTurn(pGameBatch);
+  }
+}
+
+/**
+ * Copies a single game of the batch into a scalar game state.
+ * @param pGameBatch The batch to copy from.
+ * @param nGameIndex The index of the game.
+ * @param[out] pGameState The game state to copy to.
+ */
+void copyBatchGameState(const GameBatch *pGameBatch, int nGameIndex, GameState *pGameState) {
+  pGameState->nPlayerMerchantId = 0;
+  pGameState->nPlayerInitialBalance = pGameBatch->nPlayerInitialBalance;
+  pGameState->nPlayerBalance = pGameBatch->pPlayerBalances[nGameIndex];
+  pGameState->nPlayerProfitTarget = pGameBatch->nPlayerProfitTarget;
+  pGameState->nPlayerProfit = calculatePlayerProfit(pGameState->nPlayerBalance, pGameState->nPlayerInitialBalance);
+  pGameState->nPlayerTurns = pGameBatch->nPlayerTurns;
+  pGameState->bIsQuitting = 0;
+  pGameState->cCurrentPortId = PORT_IDS[pGameBatch->pPortIndices[nGameIndex]];
+  pGameState->nShipCargoLimit = pGameBatch->pShipCargoLimits[nGameIndex];
+  pGameState->nShipCoconutCargoAmount = pGameBatch->pShipCargoAmounts[0][nGameIndex];
+  pGameState->nShipRiceCargoAmount = pGameBatch->pShipCargoAmounts[1][nGameIndex];
+  pGameState->nShipSilkCargoAmount = pGameBatch->pShipCargoAmounts[2][nGameIndex];
+  pGameState->nShipGunCargoAmount = pGameBatch->pShipCargoAmounts[3][nGameIndex];
+  pGameState->nCoconutMarketPrice = pGameBatch->pMarketPrices[0][nGameIndex];
+  pGameState->nRiceMarketPrice = pGameBatch->pMarketPrices[1][nGameIndex];
+  pGameState->nSilkMarketPrice = pGameBatch->pMarketPrices[2][nGameIndex];
+  pGameState->nGunMarketPrice = pGameBatch->pMarketPrices[3][nGameIndex];
+  pGameState->nStormTurnDuration = pGameBatch->pStormTurnDurations[nGameIndex];
+  pGameState->bIsNewStorm = pGameBatch->pIsNewStorms[nGameIndex];
+  pGameState->nStormWindSignalNumber = pGameBatch->pStormWindSignalNumbers[nGameIndex];
+  pGameState->nPostponedDepartureChance = pGameBatch->pPostponedDepartureChances[nGameIndex];
+  pGameState->randomGenerator.nState = pGameBatch->pRandomStates[nGameIndex];
+  pGameState->randomGenerator.nIncrement = pGameBatch->pRandomIncrements[nGameIndex];
+}
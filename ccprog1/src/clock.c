@@ -0,0 +1,50 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "clock.h"
+
+#include <stdint.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/**
+ * Gets the current time of the monotonic clock, which everything that measures durations shares.
+ * @returns The number of nanoseconds since an arbitrary point in time.
+ */
+uint64_t getMonotonicNanoseconds(void) {
+#ifdef _WIN32
+  LARGE_INTEGER counter;
+  LARGE_INTEGER frequency;
+
+  QueryPerformanceCounter(&counter);
+  QueryPerformanceFrequency(&frequency);
+
+  return (uint64_t)(counter.QuadPart * (1e9 / frequency.QuadPart));
+#else
+  struct timespec currentTime;
+
+  clock_gettime(CLOCK_MONOTONIC, &currentTime);
+
+  return (uint64_t)currentTime.tv_sec * 1000000000u + (uint64_t)currentTime.tv_nsec;
+#endif
+}
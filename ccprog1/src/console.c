@@ -18,57 +18,75 @@
 
 #include "console.h"
 
-#include <stdio.h>
+#include "frame.h"
+#include "input.h"
+#include "output.h"
+
+/**
+ * Writes the passed ANSI escape sequence to the open frame, or straight to the output sink if no frame is open.
+ * @param strEscapeSequence The escape sequence to write.
+ */
+static void writeEscapeSequence(const char *strEscapeSequence) {
+  if (isFrameOpen()) {
+    appendFrameText(strEscapeSequence);
+  } else {
+    printOutput("%s", strEscapeSequence);
+  }
+}
 
 /** Resets the color of text output in the console using an ANSI escape sequence. */
-void resetConsoleColor(void) { printf(COLOR_DEFAULT); }
+void resetConsoleColor(void) { writeEscapeSequence(COLOR_DEFAULT); }
 
 /** Sets the color of text output in the console to red using an ANSI escape sequence. */
-void setConsoleColorToRed(void) { printf(COLOR_RED); }
+void setConsoleColorToRed(void) { writeEscapeSequence(COLOR_RED); }
 
 /** Sets the color of text output in the console to green using an ANSI escape sequence. */
-void setConsoleColorToGreen(void) { printf(COLOR_GREEN); }
+void setConsoleColorToGreen(void) { writeEscapeSequence(COLOR_GREEN); }
 
 /** Sets the color of text output in the console to yellow using an ANSI escape sequence. */
-void setConsoleColorToYellow(void) { printf(COLOR_YELLOW); }
+void setConsoleColorToYellow(void) { writeEscapeSequence(COLOR_YELLOW); }
 
 /** Sets the color of text output in the console to blue using an ANSI escape sequence. */
-void setConsoleColorToBlue(void) { printf(COLOR_BLUE); }
+void setConsoleColorToBlue(void) { writeEscapeSequence(COLOR_BLUE); }
 
 /** Sets the color of text output in the console to purple using an ANSI escape sequence. */
-void setConsoleColorToPurple(void) { printf(COLOR_PURPLE); }
+void setConsoleColorToPurple(void) { writeEscapeSequence(COLOR_PURPLE); }
 
 /** Sets the color of text output in the console to cyan using an ANSI escape sequence. */
-void setConsoleColorToCyan(void) { printf(COLOR_CYAN); }
+void setConsoleColorToCyan(void) { writeEscapeSequence(COLOR_CYAN); }
 
 /**
- * Prompts the player to input an integer into the console.
+ * Prints out the input marker that precedes the player's answer to a prompt.
  * @param nConsoleLeftPaddingSize The number of spaces to move the console cursor to the right.
- * @returns The first integer value inputted into the console..
  */
-int getIntegerInput(int nConsoleLeftPaddingSize) {
-  int nGivenInteger;
+void printInputMarker(int nConsoleLeftPaddingSize) {
+  printOutput("\n");
 
-  printf("\n");
+  printOutput("%*c%% ", nConsoleLeftPaddingSize, ' ');
+}
 
-  printf("%*c%% ", nConsoleLeftPaddingSize, ' ');
-  scanf(" %d", &nGivenInteger);
+/**
+ * Parses the passed answer to a prompt as an integer.
+ * @param pToken The first character of the answer.
+ * @param nTokenLength The number of characters in the answer.
+ * @returns The integer in the answer, or `INVALID_INTEGER_INPUT` if the answer was not an integer.
+ */
+int parseIntegerAnswer(const char *pToken, size_t nTokenLength) {
+  int nGivenInteger;
+
+  if (parseIntegerToken(pToken, nTokenLength, &nGivenInteger) != 0) return INVALID_INTEGER_INPUT;
 
   return nGivenInteger;
 }
 
 /**
- * Prompts the player to input a character into the console.
- * @param nConsoleLeftPaddingSize The number of spaces to move the console cursor to the right.
- * @returns The first character value inputted into the console.
+ * Parses the passed answer to a prompt as a single character.
+ * @param pToken The first character of the answer.
+ * @param nTokenLength The number of characters in the answer.
+ * @returns The character in the answer, or `INVALID_CHARACTER_INPUT` if it held more than one.
  */
-char getCharacterInput(int nConsoleLeftPaddingSize) {
-  char cGivenCharacter;
-
-  printf("\n");
-
-  printf("%*c%% ", nConsoleLeftPaddingSize, ' ');
-  scanf(" %c", &cGivenCharacter);
+char parseCharacterAnswer(const char *pToken, size_t nTokenLength) {
+  if (nTokenLength != 1) return INVALID_CHARACTER_INPUT;
 
-  return cGivenCharacter;
+  return pToken[0];
 }
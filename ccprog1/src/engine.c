@@ -0,0 +1,364 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "engine.h"
+
+#include "metrics.h"
+#include "prompts.h"
+#include "trace.h"
+#include "trading.h"
+#include "weather.h"
+
+/**
+ * Gets the ship's storage of the passed cargo.
+ * @param pGameState The game whose ship storage to get.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
+ * @returns A pointer to the amount of the cargo carried by the ship.
+ */
+static int *getShipCargoStorage(GameState *pGameState, char cCargoId) {
+  if (cCargoId == COCONUT_CARGO_ID) {
+    return &pGameState->nShipCoconutCargoAmount;
+  } else if (cCargoId == RICE_CARGO_ID) {
+    return &pGameState->nShipRiceCargoAmount;
+  } else if (cCargoId == SILK_CARGO_ID) {
+    return &pGameState->nShipSilkCargoAmount;
+  } else {
+    return &pGameState->nShipGunCargoAmount;
+  }
+}
+
+/**
+ * Calculates the player's profit percentage based on their current and initial balance.
+ * @param nPlayerBalance The player's gold coin balance.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @returns The player's profit percentage, truncated towards zero.
+ */
+int calculatePlayerProfit(int nPlayerBalance, int nPlayerInitialBalance) {
+  return ((nPlayerBalance - nPlayerInitialBalance) / (nPlayerInitialBalance * 1.0)) * 100;
+}
+
+/**
+ * Sets up a new game with the passed player settings and generates the market prices of the first port.
+ * @param[out] pGameState The game to set up.
+ * @param nPlayerMerchantId The player's merchant ID.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nSeed The seed of the game's random number generator.
+ */
+void initializeGame(GameState *pGameState, int nPlayerMerchantId, int nPlayerInitialBalance, int nPlayerProfitTarget,
+                    uint64_t nSeed) {
+  pGameState->nPlayerMerchantId = nPlayerMerchantId;
+  pGameState->nPlayerInitialBalance = nPlayerInitialBalance;
+  pGameState->nPlayerBalance = nPlayerInitialBalance;
+  pGameState->nPlayerProfitTarget = nPlayerProfitTarget;
+  pGameState->nPlayerProfit = 0;
+  pGameState->nPlayerTurns = 0;
+  pGameState->bIsQuitting = 0;
+  pGameState->cCurrentPortId = INITIAL_PORT_ID;
+  pGameState->nShipCargoLimit = TIER_ONE_SHIP_CARGO_LIMIT;
+  pGameState->nShipCoconutCargoAmount = 0;
+  pGameState->nShipRiceCargoAmount = 0;
+  pGameState->nShipSilkCargoAmount = 0;
+  pGameState->nShipGunCargoAmount = 0;
+  pGameState->nStormTurnDuration = 0;
+  pGameState->bIsNewStorm = 0;
+  pGameState->nStormWindSignalNumber = 0;
+  pGameState->nPostponedDepartureChance = DEFAULT_POSTPONED_DEPARTURE_CHANCE;
+
+  seedRandomGenerator(&pGameState->randomGenerator, nSeed);
+
+  generateMarketPrices(pGameState);
+}
+
+/**
+ * Generates new market prices for all cargo based on the price ranges of the current port.
+ * @param[in,out] pGameState The game whose market prices to generate.
+ * @pre @p pGameState must have a current port ID of `T`, `M`, `P`, or `S`.
+ */
+void generateMarketPrices(GameState *pGameState) {
+  int nMarketPrices[CARGO_COUNT];
+
+  TRACE_BEGIN("generateMarketPrices");
+  generateCargoPrices(&pGameState->randomGenerator, getPortIndex(pGameState->cCurrentPortId), nMarketPrices);
+  TRACE_END("generateMarketPrices");
+
+  pGameState->nCoconutMarketPrice = nMarketPrices[0];
+  pGameState->nRiceMarketPrice = nMarketPrices[1];
+  pGameState->nSilkMarketPrice = nMarketPrices[2];
+  pGameState->nGunMarketPrice = nMarketPrices[3];
+}
+
+/**
+ * Gets the total amount of cargo carried by the ship.
+ * @param pGameState The game to inspect.
+ * @returns The sum of all cargo amounts.
+ */
+int getShipTotalCargoAmount(const GameState *pGameState) {
+  return pGameState->nShipCoconutCargoAmount + pGameState->nShipRiceCargoAmount + pGameState->nShipSilkCargoAmount +
+         pGameState->nShipGunCargoAmount;
+}
+
+/**
+ * Gets the market price of the passed cargo.
+ * @param pGameState The game to inspect.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
+ * @returns The current market price of the cargo.
+ */
+int getCargoMarketPrice(const GameState *pGameState, char cCargoId) {
+  if (cCargoId == COCONUT_CARGO_ID) {
+    return pGameState->nCoconutMarketPrice;
+  } else if (cCargoId == RICE_CARGO_ID) {
+    return pGameState->nRiceMarketPrice;
+  } else if (cCargoId == SILK_CARGO_ID) {
+    return pGameState->nSilkMarketPrice;
+  } else {
+    return pGameState->nGunMarketPrice;
+  }
+}
+
+/**
+ * Gets the amount of the passed cargo carried by the ship.
+ * @param pGameState The game to inspect.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
+ * @returns The amount of the cargo carried by the ship.
+ */
+int getShipCargoAmount(const GameState *pGameState, char cCargoId) {
+  if (cCargoId == COCONUT_CARGO_ID) {
+    return pGameState->nShipCoconutCargoAmount;
+  } else if (cCargoId == RICE_CARGO_ID) {
+    return pGameState->nShipRiceCargoAmount;
+  } else if (cCargoId == SILK_CARGO_ID) {
+    return pGameState->nShipSilkCargoAmount;
+  } else {
+    return pGameState->nShipGunCargoAmount;
+  }
+}
+
+/**
+ * Gets the cost and new cargo limit of the ship's next upgrade.
+ * @param nShipCargoLimit The current maximum amount of cargo that the ship can carry.
+ * @param[out] nShipUpgradeCost The price of upgrading the ship.
+ * @param[out] nShipNewCargoLimit The upgraded maximum amount of cargo that the ship can carry.
+ * @returns `1` if the ship can still be upgraded or `0` if it is already in the highest tier.
+ */
+int getShipUpgrade(int nShipCargoLimit, int *nShipUpgradeCost, int *nShipNewCargoLimit) {
+  if (nShipCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT) {
+    *nShipUpgradeCost = TIER_TWO_SHIP_UPGRADE_COST;
+    *nShipNewCargoLimit = TIER_TWO_SHIP_CARGO_LIMIT;
+  } else if (nShipCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT) {
+    *nShipUpgradeCost = TIER_THREE_SHIP_UPGRADE_COST;
+    *nShipNewCargoLimit = TIER_THREE_SHIP_CARGO_LIMIT;
+  } else if (nShipCargoLimit == TIER_THREE_SHIP_CARGO_LIMIT) {
+    *nShipUpgradeCost = TIER_FOUR_SHIP_UPGRADE_COST;
+    *nShipNewCargoLimit = TIER_FOUR_SHIP_CARGO_LIMIT;
+  } else {
+    return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * Checks whether the passed action follows the rules of the game in its current state.
+ * @param pGameState The game to check against.
+ * @param action The action to check.
+ * @returns `1` if the action is allowed or `0` if it is not.
+ */
+int isGameActionValid(const GameState *pGameState, GameAction action) {
+  switch (action.cActionId) {
+    case BUY_ACTION_ID:
+    case SELL_ACTION_ID: {
+      if (action.cCargoId != COCONUT_CARGO_ID && action.cCargoId != RICE_CARGO_ID &&
+          action.cCargoId != SILK_CARGO_ID && action.cCargoId != GUN_CARGO_ID) {
+        return 0;
+      }
+
+      if (action.nCargoAmount < 1) return 0;
+
+      if (action.cActionId == BUY_ACTION_ID) {
+        return action.nCargoAmount <= pGameState->nShipCargoLimit - getShipTotalCargoAmount(pGameState) &&
+               pGameState->nPlayerBalance >= action.nCargoAmount * getCargoMarketPrice(pGameState, action.cCargoId);
+      }
+
+      return action.nCargoAmount <= getShipCargoAmount(pGameState, action.cCargoId);
+    }
+    case UPGRADE_ACTION_ID: {
+      int nShipUpgradeCost;
+      int nShipNewCargoLimit = pGameState->nShipCargoLimit;
+
+      return getShipUpgrade(pGameState->nShipCargoLimit, &nShipUpgradeCost, &nShipNewCargoLimit) &&
+             pGameState->nPlayerBalance >= nShipUpgradeCost;
+    }
+    case NAVIGATE_ACTION_ID: {
+      return (action.cPortId == TONDO_PORT_ID || action.cPortId == MANILA_PORT_ID ||
+              action.cPortId == PANDAKAN_PORT_ID || action.cPortId == SAPA_PORT_ID) &&
+             action.cPortId != pGameState->cCurrentPortId;
+    }
+    case QUIT_ACTION_ID: {
+      return 1;
+    }
+    default: {
+      return 0;
+    }
+  }
+}
+
+/**
+ * Checks whether the game has ended, either by exhausting all turns or by quitting.
+ * @param pGameState The game to inspect.
+ * @returns `1` if the game has ended or `0` if it has not.
+ */
+int isGameOver(const GameState *pGameState) {
+  return pGameState->nPlayerTurns >= MAXIMUM_PLAYER_TURNS || pGameState->bIsQuitting;
+}
+
+/**
+ * Advances the storm at the end of a turn by possibly forming a new one, strengthening the current one, or letting it
+ * dissipate.
+ * @param[in,out] pGameState The game whose weather to advance.
+ * @param[out] pStepResult The outcome to record the weather report in.
+ */
+static void advanceWeather(GameState *pGameState, GameStepResult *pStepResult) {
+  if (pGameState->nStormTurnDuration == -1) {
+    pGameState->nStormTurnDuration = 0;
+  } else if (pGameState->nStormTurnDuration == 0) {
+    int bStartStorm = generateRandomBool(&pGameState->randomGenerator, 50);
+
+    if (bStartStorm) {
+      pGameState->nStormTurnDuration = generateRandomStormTurnDuration(&pGameState->randomGenerator, 1) + 1;
+      pGameState->bIsNewStorm = 1;
+      pGameState->nStormWindSignalNumber = 1;
+
+      addMetricsCounter(STORM_METRICS_COUNTER, 1);
+    }
+  }
+
+  if (pGameState->nStormTurnDuration > 0) {
+    pGameState->nStormTurnDuration--;
+
+    int nStormOldWindSignalNumber = pGameState->nStormWindSignalNumber;
+
+    if (pGameState->nStormTurnDuration == 0) {
+      pGameState->nPostponedDepartureChance = DEFAULT_POSTPONED_DEPARTURE_CHANCE;
+
+      pGameState->nStormTurnDuration--;
+    } else if (!pGameState->bIsNewStorm && pGameState->nStormWindSignalNumber < MAXIMUM_WIND_SIGNAL_NUMBER) {
+      int bAdjustStormStrength = generateRandomBool(&pGameState->randomGenerator, 50);
+
+      if (bAdjustStormStrength) {
+        setStormStrength(&pGameState->nStormWindSignalNumber, pGameState->nStormWindSignalNumber + 1,
+                         &pGameState->nPostponedDepartureChance);
+      }
+    }
+
+    pStepResult->bHasWeatherReport = 1;
+    pStepResult->bIsNewStorm = pGameState->bIsNewStorm;
+    pStepResult->nStormOldWindSignalNumber = nStormOldWindSignalNumber;
+    pStepResult->nStormNewWindSignalNumber = pGameState->nStormWindSignalNumber;
+    pStepResult->nPostponedDepartureChance = pGameState->nPostponedDepartureChance;
+    pStepResult->nStormTurnDuration = pGameState->nStormTurnDuration;
+
+    pGameState->bIsNewStorm = 0;
+  }
+}
+
+/**
+ * Applies the passed action to the game. Navigating ends the turn, which also advances the weather and generates the
+ * next port's market prices.
+ * @param[in,out] pGameState The game to advance.
+ * @param action The action to apply.
+ * @returns The outcome of the action, whose status is `GAME_STEP_SUCCESS`, `GAME_STEP_INVALID_ACTION`, or
+ * `GAME_STEP_GAME_OVER`.
+ */
+GameStepResult stepGame(GameState *pGameState, GameAction action) {
+  GameStepResult stepResult = {0};
+
+  if (isGameOver(pGameState)) {
+    stepResult.nStatus = GAME_STEP_GAME_OVER;
+
+    return stepResult;
+  }
+
+  if (!isGameActionValid(pGameState, action)) {
+    stepResult.nStatus = GAME_STEP_INVALID_ACTION;
+
+    return stepResult;
+  }
+
+  switch (action.cActionId) {
+    case BUY_ACTION_ID:
+    case SELL_ACTION_ID: {
+      stepResult.nCargoPrice = getCargoMarketPrice(pGameState, action.cCargoId);
+
+      tradeCargo(action.cActionId, &pGameState->nPlayerBalance, stepResult.nCargoPrice, action.nCargoAmount,
+                 getShipCargoStorage(pGameState, action.cCargoId));
+
+      addMetricsCounter(action.cActionId == BUY_ACTION_ID ? BUY_METRICS_COUNTER : SELL_METRICS_COUNTER, 1);
+      countMetricsTrade(pGameState->cCurrentPortId, action.cCargoId);
+
+      break;
+    }
+    case UPGRADE_ACTION_ID: {
+      int nShipNewCargoLimit = pGameState->nShipCargoLimit;
+
+      getShipUpgrade(pGameState->nShipCargoLimit, &stepResult.nShipUpgradeCost, &nShipNewCargoLimit);
+
+      stepResult.nShipCargoLimitIncrease = nShipNewCargoLimit - pGameState->nShipCargoLimit;
+
+      upgradeShip(&pGameState->nPlayerBalance, stepResult.nShipUpgradeCost, &pGameState->nShipCargoLimit,
+                  nShipNewCargoLimit);
+
+      addMetricsCounter(UPGRADE_METRICS_COUNTER, 1);
+
+      break;
+    }
+    case NAVIGATE_ACTION_ID: {
+      stepResult.bIsDepartureSuccessful =
+        generateRandomBool(&pGameState->randomGenerator, 100 - pGameState->nPostponedDepartureChance);
+
+      if (stepResult.bIsDepartureSuccessful) pGameState->cCurrentPortId = action.cPortId;
+
+      pGameState->nPlayerTurns++;
+
+      addMetricsCounter(TURN_METRICS_COUNTER, 1);
+      addMetricsCounter(DEPARTURE_METRICS_COUNTER, 1);
+
+      if (!stepResult.bIsDepartureSuccessful) addMetricsCounter(POSTPONED_DEPARTURE_METRICS_COUNTER, 1);
+
+      advanceWeather(pGameState, &stepResult);
+
+      if (!isGameOver(pGameState)) generateMarketPrices(pGameState);
+
+      break;
+    }
+    case QUIT_ACTION_ID: {
+      pGameState->bIsQuitting = 1;
+
+      break;
+    }
+  }
+
+  pGameState->nPlayerProfit = calculatePlayerProfit(pGameState->nPlayerBalance, pGameState->nPlayerInitialBalance);
+
+  stepResult.nStatus = GAME_STEP_SUCCESS;
+
+  return stepResult;
+}
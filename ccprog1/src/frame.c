@@ -0,0 +1,233 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "frame.h"
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "clock.h"
+#include "metrics.h"
+#include "output.h"
+#include "screen.h"
+
+/** The frame being built, which is shared by every screen since they all draw to the same console. */
+typedef struct {
+  char *pBuffer;
+  size_t nLength;
+  size_t nCapacity;
+  int nDepth;
+  int bIsReporting;
+  int bIsDifferential;
+  uint64_t nBeginNanoseconds;
+  ScreenRenderer screenRenderer;
+  FrameStatistics statistics;
+} FrameBuilder;
+
+static FrameBuilder frameBuilder = {0};
+
+/**
+ * Writes out the frame built so far and records its statistics. Complete frames are drawn by the screen renderer if
+ * differential rendering is enabled, while a frame that is written out early is written as is.
+ * @returns `0` if the frame was written or `-1` if the output sink could not be written to.
+ */
+static int writeFrame(void) {
+  FrameStatistics *pStatistics = &frameBuilder.statistics;
+  const char *pOutputBytes = frameBuilder.pBuffer;
+  size_t nOutputByteCount = frameBuilder.nLength;
+  double nStartSeconds = getMonotonicNanoseconds() / 1e9;
+
+  // A frame that the screen renderer could not draw is written as is, which also makes it draw the next from scratch.
+  if (frameBuilder.bIsDifferential && frameBuilder.nDepth == 0) {
+    renderScreenFrame(&frameBuilder.screenRenderer, frameBuilder.pBuffer, frameBuilder.nLength, &pOutputBytes,
+                      &nOutputByteCount);
+  } else if (frameBuilder.bIsDifferential) {
+    resetScreenRenderer(&frameBuilder.screenRenderer);
+  }
+
+  int nStatus = writeOutput(pOutputBytes, nOutputByteCount);
+  double nEmitSeconds = getMonotonicNanoseconds() / 1e9 - nStartSeconds;
+
+  pStatistics->nFrameCount++;
+  pStatistics->nLastComposedSize = frameBuilder.nLength;
+  pStatistics->nLastFrameSize = nOutputByteCount;
+  pStatistics->nLastEmitSeconds = nEmitSeconds;
+  pStatistics->nTotalComposedSize += frameBuilder.nLength;
+  pStatistics->nTotalFrameSize += nOutputByteCount;
+  pStatistics->nTotalEmitSeconds += nEmitSeconds;
+
+  if (frameBuilder.bIsReporting) {
+    fprintf(stderr, "Frame %ld: %lu bytes (%lu composed) in %.1f us\n", pStatistics->nFrameCount,
+            (unsigned long)nOutputByteCount, (unsigned long)frameBuilder.nLength, nEmitSeconds * 1e6);
+  }
+
+  // The render time starts with the outermost frame, so it covers composing the frame as well as writing it.
+  if (isMetricsRecording()) {
+    addMetricsCounter(FRAME_METRICS_COUNTER, 1);
+    addMetricsCounter(EMITTED_BYTE_METRICS_COUNTER, nOutputByteCount);
+    recordMetricsHistogram(RENDER_METRICS_HISTOGRAM, getMonotonicNanoseconds() - frameBuilder.nBeginNanoseconds);
+  }
+
+  frameBuilder.nLength = 0;
+
+  return nStatus;
+}
+
+/**
+ * Makes room for the passed number of bytes at the end of the frame. If the buffer cannot grow, the frame built so far
+ * is written out early so that the output sink still gets everything, just in more than one write.
+ * @param nByteCount The number of bytes to make room for.
+ * @returns `0` if the bytes fit in the buffer or `-1` if they must be written straight to the output sink.
+ */
+static int reserveFrameCapacity(size_t nByteCount) {
+  if (frameBuilder.nLength + nByteCount <= frameBuilder.nCapacity) return 0;
+
+  size_t nNewCapacity = frameBuilder.nCapacity > 0 ? frameBuilder.nCapacity : FRAME_INITIAL_CAPACITY;
+
+  while (nNewCapacity < frameBuilder.nLength + nByteCount) nNewCapacity *= 2;
+
+  char *pNewBuffer = realloc(frameBuilder.pBuffer, nNewCapacity);
+
+  if (pNewBuffer == NULL) {
+    if (frameBuilder.nLength > 0) writeFrame();
+
+    return nByteCount <= frameBuilder.nCapacity ? 0 : -1;
+  }
+
+  frameBuilder.pBuffer = pNewBuffer;
+  frameBuilder.nCapacity = nNewCapacity;
+
+  return 0;
+}
+
+/**
+ * Starts building a frame. Frames can be nested, in which case the inner frame is appended to the outer one and only
+ * the outermost frame is emitted.
+ */
+void beginFrame(void) {
+  if (frameBuilder.nDepth == 0 && isMetricsRecording()) frameBuilder.nBeginNanoseconds = getMonotonicNanoseconds();
+
+  frameBuilder.nDepth++;
+}
+
+/**
+ * Checks whether a frame is being built.
+ * @returns `1` if text is currently appended to a frame or `0` if it is written straight to the console.
+ */
+int isFrameOpen(void) { return frameBuilder.nDepth > 0; }
+
+/**
+ * Appends the passed number of bytes to the open frame.
+ * @param pBytes The bytes to append.
+ * @param nByteCount The number of bytes to append.
+ * @pre A frame must be open.
+ */
+void appendFrameBytes(const char *pBytes, size_t nByteCount) {
+  if (isOutputDiscarded()) return;
+
+  if (reserveFrameCapacity(nByteCount) != 0) {
+    writeOutput(pBytes, nByteCount);
+
+    return;
+  }
+
+  memcpy(frameBuilder.pBuffer + frameBuilder.nLength, pBytes, nByteCount);
+  frameBuilder.nLength += nByteCount;
+}
+
+/**
+ * Appends the passed text to the open frame.
+ * @param strText The text to append.
+ * @pre A frame must be open.
+ */
+void appendFrameText(const char *strText) { appendFrameBytes(strText, strlen(strText)); }
+
+/**
+ * Appends formatted text to the open frame, which accepts the same format as `printf`.
+ * @param strFormat The format of the text.
+ * @pre A frame must be open.
+ */
+void appendFrameFormat(const char *strFormat, ...) {
+  if (isOutputDiscarded()) return;
+
+  va_list arguments;
+  va_list copiedArguments;
+
+  va_start(arguments, strFormat);
+  va_copy(copiedArguments, arguments);
+
+  char *pFreeBytes = frameBuilder.pBuffer != NULL ? frameBuilder.pBuffer + frameBuilder.nLength : NULL;
+  size_t nFreeByteCount = frameBuilder.nCapacity - frameBuilder.nLength;
+  int nTextLength = vsnprintf(pFreeBytes, nFreeByteCount, strFormat, arguments);
+
+  if (nTextLength >= 0 && (size_t)nTextLength < nFreeByteCount) {
+    frameBuilder.nLength += (size_t)nTextLength;
+  } else if (nTextLength >= 0 && reserveFrameCapacity((size_t)nTextLength + 1) == 0) {
+    // The terminating null character is written but not counted, so the next append overwrites it.
+    vsnprintf(frameBuilder.pBuffer + frameBuilder.nLength, (size_t)nTextLength + 1, strFormat, copiedArguments);
+    frameBuilder.nLength += (size_t)nTextLength;
+  }
+
+  va_end(copiedArguments);
+  va_end(arguments);
+}
+
+/**
+ * Ends the innermost frame. Ending the outermost frame writes the whole frame to the output sink with a single write.
+ * @returns `0` if the frame was written or is still nested or `-1` if the output sink could not be written to.
+ */
+int emitFrame(void) {
+  if (frameBuilder.nDepth == 0 || --frameBuilder.nDepth > 0 || isOutputDiscarded()) return 0;
+
+  return writeFrame();
+}
+
+/**
+ * Enables or disables differential rendering, which only redraws the cells of the console that differ from the
+ * previous frame instead of printing every frame below the last.
+ * @param bIsEnabled Whether or not to render frames differentially.
+ * @returns `0` if the setting was applied or `-1` if the screen renderer could not be allocated.
+ */
+int setFrameDifferentialRendering(int bIsEnabled) {
+  if (bIsEnabled && !frameBuilder.bIsDifferential && createScreenRenderer(&frameBuilder.screenRenderer) != 0) {
+    return -1;
+  }
+
+  if (!bIsEnabled && frameBuilder.bIsDifferential) destroyScreenRenderer(&frameBuilder.screenRenderer);
+
+  frameBuilder.bIsDifferential = bIsEnabled;
+
+  return 0;
+}
+
+/**
+ * Enables or disables reporting the size and time-to-emit of every frame to the standard error stream.
+ * @param bIsEnabled Whether or not to report every frame.
+ */
+void setFrameStatisticsReporting(int bIsEnabled) { frameBuilder.bIsReporting = bIsEnabled; }
+
+/**
+ * Gets the counters about the frames emitted so far.
+ * @returns The frame statistics, which stay owned by the frame builder.
+ */
+const FrameStatistics *getFrameStatistics(void) { return &frameBuilder.statistics; }
@@ -0,0 +1,219 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "input.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "clock.h"
+#include "metrics.h"
+#include "output.h"
+#include "trace.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+/** The buffered standard input, whose unread bytes lie between the begin and end indices. */
+typedef struct {
+  char strBuffer[INPUT_BUFFER_SIZE];
+  size_t nBeginIndex;
+  size_t nEndIndex;
+  int bIsEnded;
+  int nFileDescriptor;
+} InputReader;
+
+static InputReader inputReader = {{0}, 0, 0, 0, 0};
+
+/**
+ * Checks whether the passed character separates tokens.
+ * @param cCharacter The character to check.
+ * @returns `1` if the character is whitespace or `0` if it is not.
+ */
+static int isInputSeparator(char cCharacter) {
+  return cCharacter == ' ' || cCharacter == '\n' || cCharacter == '\r' || cCharacter == '\t' || cCharacter == '\v' ||
+         cCharacter == '\f';
+}
+
+/**
+ * Moves the unread bytes to the front of the buffer and reads as many new bytes as are available after them.
+ * @returns `0` if any bytes were read or `-1` if the input ended or could not be read.
+ */
+static int fillInputBuffer(void) {
+  size_t nUnreadByteCount = inputReader.nEndIndex - inputReader.nBeginIndex;
+
+  if (inputReader.bIsEnded || nUnreadByteCount == INPUT_BUFFER_SIZE) return -1;
+
+  memmove(inputReader.strBuffer, inputReader.strBuffer + inputReader.nBeginIndex, nUnreadByteCount);
+  inputReader.nBeginIndex = 0;
+  inputReader.nEndIndex = nUnreadByteCount;
+
+  // The player needs to see the prompt before the game waits for their answer.
+  flushOutput();
+
+  TRACE_BEGIN("waitForInput");
+
+  uint64_t nWaitStartNanoseconds = isMetricsRecording() ? getMonotonicNanoseconds() : 0;
+
+  while (1) {
+#ifdef _WIN32
+    int nResult = _read(inputReader.nFileDescriptor, inputReader.strBuffer + inputReader.nEndIndex,
+                        (unsigned int)(INPUT_BUFFER_SIZE - inputReader.nEndIndex));
+#else
+    ssize_t nResult = read(inputReader.nFileDescriptor, inputReader.strBuffer + inputReader.nEndIndex,
+                           INPUT_BUFFER_SIZE - inputReader.nEndIndex);
+#endif
+
+    // A signal may have interrupted the wait to request a dump of the metrics, which is done before waiting again.
+    if (nResult < 0 && errno == EINTR) {
+      dumpRequestedMetrics();
+
+      continue;
+    }
+
+    TRACE_END("waitForInput");
+
+    if (isMetricsRecording()) {
+      recordMetricsHistogram(INPUT_WAIT_METRICS_HISTOGRAM, getMonotonicNanoseconds() - nWaitStartNanoseconds);
+    }
+
+    if (nResult <= 0) {
+      inputReader.bIsEnded = 1;
+
+      return -1;
+    }
+
+    inputReader.nEndIndex += (size_t)nResult;
+
+    return 0;
+  }
+}
+
+/**
+ * Opens the passed file as the input in place of the standard input, discarding anything left unread.
+ * @param strFilePath The path of the file to read.
+ * @returns `0` if the file was opened or `-1` if it could not be.
+ */
+int openInputFile(const char *strFilePath) {
+#ifdef _WIN32
+  int nFileDescriptor = _open(strFilePath, _O_RDONLY | _O_BINARY);
+#else
+  int nFileDescriptor = open(strFilePath, O_RDONLY);
+#endif
+
+  if (nFileDescriptor < 0) return -1;
+
+  inputReader.nBeginIndex = 0;
+  inputReader.nEndIndex = 0;
+  inputReader.bIsEnded = 0;
+  inputReader.nFileDescriptor = nFileDescriptor;
+
+  return 0;
+}
+
+/**
+ * Checks whether another token is left in the input, reading more of it if the buffer only holds whitespace.
+ * @returns `1` if a token is left or `0` if the input has ended.
+ */
+int hasInputToken(void) {
+  while (1) {
+    while (inputReader.nBeginIndex < inputReader.nEndIndex &&
+           isInputSeparator(inputReader.strBuffer[inputReader.nBeginIndex])) {
+      inputReader.nBeginIndex++;
+    }
+
+    if (inputReader.nBeginIndex < inputReader.nEndIndex) return 1;
+
+    if (fillInputBuffer() != 0) return 0;
+  }
+}
+
+/**
+ * Reads the next whitespace-separated token from the input, which is the standard input unless a file was opened.
+ * Input is read in chunks of up to `INPUT_BUFFER_SIZE` bytes, so a pipe full of queued commands is drained with a
+ * single read. Any pending output is flushed before the reader waits for more input.
+ * @param[out] pToken The first character of the token, which stays valid until the next token is read.
+ * @param[out] nTokenLength The number of characters in the token.
+ * @returns `0` if a token was read or `-1` if the input ended first.
+ * @note A token longer than `INPUT_BUFFER_SIZE` bytes is cut into several tokens.
+ */
+int readInputToken(const char **pToken, size_t *nTokenLength) {
+  // Skips the whitespace before the token, which may span several reads.
+  if (!hasInputToken()) return -1;
+
+  size_t nScannedLength = 0;
+
+  // A token only ends at whitespace or the end of the input, so a token cut off by the end of the buffer waits for
+  // the rest of it to be read.
+  while (1) {
+    while (inputReader.nBeginIndex + nScannedLength < inputReader.nEndIndex &&
+           !isInputSeparator(inputReader.strBuffer[inputReader.nBeginIndex + nScannedLength])) {
+      nScannedLength++;
+    }
+
+    if (inputReader.nBeginIndex + nScannedLength < inputReader.nEndIndex || fillInputBuffer() != 0) break;
+  }
+
+  *pToken = inputReader.strBuffer + inputReader.nBeginIndex;
+  *nTokenLength = nScannedLength;
+  inputReader.nBeginIndex += nScannedLength;
+
+  return 0;
+}
+
+/**
+ * Parses the passed token as a decimal integer with an optional sign.
+ * @param pToken The first character of the token.
+ * @param nTokenLength The number of characters in the token.
+ * @param[out] nValue The parsed integer.
+ * @returns `0` if the whole token is an integer that fits in an `int` or `-1` if it is not.
+ */
+int parseIntegerToken(const char *pToken, size_t nTokenLength, int *nValue) {
+  size_t nCharacterIndex = 0;
+  int bIsNegative = 0;
+  long long nMagnitude = 0;
+
+  if (nTokenLength > 0 && (pToken[0] == '-' || pToken[0] == '+')) {
+    bIsNegative = pToken[0] == '-';
+    nCharacterIndex++;
+  }
+
+  if (nCharacterIndex == nTokenLength) return -1;
+
+  for (; nCharacterIndex < nTokenLength; nCharacterIndex++) {
+    if (pToken[nCharacterIndex] < '0' || pToken[nCharacterIndex] > '9') return -1;
+
+    nMagnitude = nMagnitude * 10 + (pToken[nCharacterIndex] - '0');
+
+    if (nMagnitude > (long long)INT_MAX + 1) return -1;
+  }
+
+  if (!bIsNegative && nMagnitude > INT_MAX) return -1;
+
+  *nValue = bIsNegative ? (int)-nMagnitude : (int)nMagnitude;
+
+  return 0;
+}
@@ -0,0 +1,713 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "journal.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "prompts.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define JOURNAL_FILE_SIGNATURE "TIDESAJ2"
+#define JOURNAL_INDEX_SIGNATURE "TIDESJX2"
+#define JOURNAL_SIGNATURE_SIZE 8
+#define JOURNAL_INDEX_ENTRY_SIZE 16
+#define JOURNAL_INDEX_FOOTER_SIZE (8 + JOURNAL_SIGNATURE_SIZE)
+#define JOURNAL_INITIAL_INDEX_CAPACITY 64
+#define JOURNAL_MAXIMUM_VARINT_SIZE 10
+#define JOURNAL_MAXIMUM_RECORD_SIZE (JOURNAL_MAXIMUM_VARINT_SIZE * 4)
+#define JOURNAL_MAXIMUM_KEYFRAME_SIZE (JOURNAL_MAXIMUM_VARINT_SIZE * 24)
+
+#define KEYFRAME_RECORD_ID 'K'
+
+/**
+ * Appends the passed integer to a record as a variable-length integer, which stores seven bits per byte and sets the
+ * high bit of every byte except the last.
+ * @param nValue The integer to append.
+ * @param[out] pRecord The record to append to.
+ * @param[in,out] nRecordSize The size of the record.
+ */
+static void appendVarint(uint64_t nValue, uint8_t *pRecord, size_t *nRecordSize) {
+  while (nValue >= 0x80) {
+    pRecord[(*nRecordSize)++] = (uint8_t)(nValue | 0x80);
+    nValue >>= 7;
+  }
+
+  pRecord[(*nRecordSize)++] = (uint8_t)nValue;
+}
+
+/**
+ * Appends the passed signed integer to a record, zigzag-encoded so that small negative values stay short.
+ * @param nValue The integer to append.
+ * @param[out] pRecord The record to append to.
+ * @param[in,out] nRecordSize The size of the record.
+ */
+static void appendSignedVarint(int nValue, uint8_t *pRecord, size_t *nRecordSize) {
+  appendVarint((uint32_t)((uint32_t)nValue << 1) ^ (nValue < 0 ? UINT32_MAX : 0), pRecord, nRecordSize);
+}
+
+/**
+ * Reads a variable-length integer from the passed journal.
+ * @param[in,out] pActionJournalReader The journal to read from.
+ * @param[out] nValue The integer that was read.
+ * @returns `0` if the integer was read or `-1` if the journal ends first or the integer is too long.
+ */
+static int readVarint(ActionJournalReader *pActionJournalReader, uint64_t *nValue) {
+  *nValue = 0;
+
+  for (int nShift = 0; nShift < JOURNAL_MAXIMUM_VARINT_SIZE * 7; nShift += 7) {
+    if (pActionJournalReader->nOffset >= pActionJournalReader->nRecordEndOffset) return -1;
+
+    uint8_t nByte = pActionJournalReader->pBytes[pActionJournalReader->nOffset++];
+
+    *nValue |= (uint64_t)(nByte & 0x7F) << nShift;
+
+    if ((nByte & 0x80) == 0) return 0;
+  }
+
+  return -1;
+}
+
+/**
+ * Reads a zigzag-encoded signed integer from the passed journal.
+ * @param[in,out] pActionJournalReader The journal to read from.
+ * @param[out] nValue The integer that was read.
+ * @returns `0` if the integer was read or `-1` if the journal ends first or the integer does not fit in an `int`.
+ */
+static int readSignedVarint(ActionJournalReader *pActionJournalReader, int *nValue) {
+  uint64_t nEncodedValue;
+
+  if (readVarint(pActionJournalReader, &nEncodedValue) != 0 || nEncodedValue > UINT32_MAX) return -1;
+
+  int nMagnitude = (int)(nEncodedValue >> 1);
+
+  *nValue = (nEncodedValue & 1) ? -nMagnitude - 1 : nMagnitude;
+
+  return 0;
+}
+
+/**
+ * Reads a character ID from the passed journal.
+ * @param[in,out] pActionJournalReader The journal to read from.
+ * @param[out] cId The ID that was read.
+ * @returns `0` if the ID was read or `-1` if the journal ends first or the value is not a character.
+ */
+static int readCharacterId(ActionJournalReader *pActionJournalReader, char *cId) {
+  uint64_t nValue;
+
+  if (readVarint(pActionJournalReader, &nValue) != 0 || nValue > UCHAR_MAX) return -1;
+
+  *cId = (char)nValue;
+
+  return 0;
+}
+
+/**
+ * Stores the passed integer in little-endian byte order, which keeps the index readable on any machine.
+ * @param nValue The integer to store.
+ * @param[out] pBytes The bytes to store the integer in.
+ * @param nByteCount The number of bytes to store, which is `4` or `8`.
+ */
+static void storeLittleEndian(uint64_t nValue, uint8_t *pBytes, int nByteCount) {
+  for (int nByteIndex = 0; nByteIndex < nByteCount; nByteIndex++) {
+    pBytes[nByteIndex] = (uint8_t)(nValue >> (nByteIndex * 8));
+  }
+}
+
+/**
+ * Loads an integer stored in little-endian byte order.
+ * @param pBytes The bytes that store the integer.
+ * @param nByteCount The number of bytes to load, which is `4` or `8`.
+ * @returns The loaded integer.
+ */
+static uint64_t loadLittleEndian(const uint8_t *pBytes, int nByteCount) {
+  uint64_t nValue = 0;
+
+  for (int nByteIndex = 0; nByteIndex < nByteCount; nByteIndex++) {
+    nValue |= (uint64_t)pBytes[nByteIndex] << (nByteIndex * 8);
+  }
+
+  return nValue;
+}
+
+/**
+ * Appends the full state of the passed game to a record as a keyframe, which is everything that `initializeGame` and
+ * `stepGame` read, including the state of the random number generator.
+ * @param pGameState The game to append.
+ * @param[out] pRecord The record to append to.
+ * @param[in,out] nRecordSize The size of the record.
+ */
+static void appendKeyframe(const GameState *pGameState, uint8_t *pRecord, size_t *nRecordSize) {
+  appendVarint(KEYFRAME_RECORD_ID, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nPlayerMerchantId, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nPlayerInitialBalance, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nPlayerBalance, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nPlayerProfitTarget, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nPlayerProfit, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nPlayerTurns, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->bIsQuitting, pRecord, nRecordSize);
+  appendVarint((unsigned char)pGameState->cCurrentPortId, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nShipCargoLimit, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nShipCoconutCargoAmount, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nShipRiceCargoAmount, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nShipSilkCargoAmount, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nShipGunCargoAmount, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nCoconutMarketPrice, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nRiceMarketPrice, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nSilkMarketPrice, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nGunMarketPrice, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nStormTurnDuration, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->bIsNewStorm, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nStormWindSignalNumber, pRecord, nRecordSize);
+  appendSignedVarint(pGameState->nPostponedDepartureChance, pRecord, nRecordSize);
+  appendVarint(pGameState->randomGenerator.nState, pRecord, nRecordSize);
+  appendVarint(pGameState->randomGenerator.nIncrement, pRecord, nRecordSize);
+}
+
+/**
+ * Reads the body of a keyframe, whose record ID has already been read, from the passed journal.
+ * @param[in,out] pActionJournalReader The journal to read from.
+ * @param[out] pGameState The game to restore.
+ * @returns `0` if the keyframe was read or `-1` if the journal ends first or the keyframe is corrupt.
+ */
+static int readKeyframe(ActionJournalReader *pActionJournalReader, GameState *pGameState) {
+  int bIsRead = readSignedVarint(pActionJournalReader, &pGameState->nPlayerMerchantId) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nPlayerInitialBalance) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nPlayerBalance) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nPlayerProfitTarget) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nPlayerProfit) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nPlayerTurns) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->bIsQuitting) == 0 &&
+                readCharacterId(pActionJournalReader, &pGameState->cCurrentPortId) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nShipCargoLimit) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nShipCoconutCargoAmount) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nShipRiceCargoAmount) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nShipSilkCargoAmount) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nShipGunCargoAmount) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nCoconutMarketPrice) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nRiceMarketPrice) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nSilkMarketPrice) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nGunMarketPrice) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nStormTurnDuration) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->bIsNewStorm) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nStormWindSignalNumber) == 0 &&
+                readSignedVarint(pActionJournalReader, &pGameState->nPostponedDepartureChance) == 0 &&
+                readVarint(pActionJournalReader, &pGameState->randomGenerator.nState) == 0 &&
+                readVarint(pActionJournalReader, &pGameState->randomGenerator.nIncrement) == 0;
+
+  return bIsRead ? 0 : -1;
+}
+
+/**
+ * Writes the passed record to the journal's file.
+ * @param[in,out] pActionJournalWriter The journal to write to.
+ * @param pRecord The record to write.
+ * @param nRecordSize The size of the record.
+ * @returns `0` if the record was written or `-1` if it could not be.
+ */
+static int writeJournalRecord(ActionJournalWriter *pActionJournalWriter, const uint8_t *pRecord, size_t nRecordSize) {
+  if (fwrite(pRecord, 1, nRecordSize, pActionJournalWriter->pFile) != nRecordSize) return -1;
+
+  pActionJournalWriter->nByteOffset += nRecordSize;
+
+  return pActionJournalWriter->bIsFlushingEveryRecord ? flushActionJournalWriter(pActionJournalWriter) : 0;
+}
+
+/**
+ * Adds the position of the next record to the index of the passed journal.
+ * @param[in,out] pActionJournalWriter The journal to add to.
+ * @param nTurn The turn that the record starts.
+ * @returns `0` if the position was added or `-1` if the index could not be grown.
+ */
+static int addJournalIndexEntry(ActionJournalWriter *pActionJournalWriter, int nTurn) {
+  if (pActionJournalWriter->nIndexEntryCount == pActionJournalWriter->nIndexEntryCapacity) {
+    long nNewCapacity = pActionJournalWriter->nIndexEntryCapacity > 0 ? pActionJournalWriter->nIndexEntryCapacity * 2
+                                                                      : JOURNAL_INITIAL_INDEX_CAPACITY;
+    JournalIndexEntry *pNewIndexEntries =
+      realloc(pActionJournalWriter->pIndexEntries, sizeof(JournalIndexEntry) * nNewCapacity);
+
+    if (pNewIndexEntries == NULL) return -1;
+
+    pActionJournalWriter->pIndexEntries = pNewIndexEntries;
+    pActionJournalWriter->nIndexEntryCapacity = nNewCapacity;
+  }
+
+  JournalIndexEntry *pIndexEntry = &pActionJournalWriter->pIndexEntries[pActionJournalWriter->nIndexEntryCount++];
+
+  pIndexEntry->nSessionIndex = (uint32_t)(pActionJournalWriter->nSessionCount - 1);
+  pIndexEntry->nTurn = (uint32_t)nTurn;
+  pIndexEntry->nOffset = pActionJournalWriter->nByteOffset;
+
+  return 0;
+}
+
+/**
+ * Creates or truncates the passed file and writes the signature of a journal to it.
+ * @param[out] pActionJournalWriter The journal to open.
+ * @param strFilePath The path of the file to write to.
+ * @param bIsFlushingEveryRecord `1` to write every record to the file as soon as it is appended, which interactive
+ * games do so that a crash keeps everything played up to it, or `0` to buffer the records.
+ * @returns `0` if the journal was opened or `-1` if the file could not be written to.
+ */
+int openActionJournalWriter(ActionJournalWriter *pActionJournalWriter, const char *strFilePath,
+                            int bIsFlushingEveryRecord) {
+  pActionJournalWriter->pFile = fopen(strFilePath, "wb");
+  pActionJournalWriter->bIsFlushingEveryRecord = bIsFlushingEveryRecord;
+  pActionJournalWriter->nByteOffset = JOURNAL_SIGNATURE_SIZE;
+  pActionJournalWriter->nSessionCount = 0;
+  pActionJournalWriter->nActionCount = 0;
+  pActionJournalWriter->nLastKeyframeTurn = 0;
+  pActionJournalWriter->pIndexEntries = NULL;
+  pActionJournalWriter->nIndexEntryCount = 0;
+  pActionJournalWriter->nIndexEntryCapacity = 0;
+
+  if (pActionJournalWriter->pFile == NULL) return -1;
+
+  if (fwrite(JOURNAL_FILE_SIGNATURE, 1, JOURNAL_SIGNATURE_SIZE, pActionJournalWriter->pFile) !=
+      JOURNAL_SIGNATURE_SIZE) {
+    fclose(pActionJournalWriter->pFile);
+    pActionJournalWriter->pFile = NULL;
+
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * Appends the index of the passed journal, then flushes and closes its file.
+ * @param[in,out] pActionJournalWriter The journal to close.
+ * @returns `0` if every record reached the file or `-1` if some could not be written.
+ */
+int closeActionJournalWriter(ActionJournalWriter *pActionJournalWriter) {
+  uint8_t nIndexBytes[JOURNAL_INDEX_FOOTER_SIZE];
+  int bIsWritten = 1;
+
+  for (long nEntryIndex = 0; nEntryIndex < pActionJournalWriter->nIndexEntryCount && bIsWritten; nEntryIndex++) {
+    const JournalIndexEntry *pIndexEntry = &pActionJournalWriter->pIndexEntries[nEntryIndex];
+
+    storeLittleEndian(pIndexEntry->nSessionIndex, nIndexBytes, 4);
+    storeLittleEndian(pIndexEntry->nTurn, nIndexBytes + 4, 4);
+    storeLittleEndian(pIndexEntry->nOffset, nIndexBytes + 8, 8);
+
+    bIsWritten =
+      fwrite(nIndexBytes, 1, JOURNAL_INDEX_ENTRY_SIZE, pActionJournalWriter->pFile) == JOURNAL_INDEX_ENTRY_SIZE;
+  }
+
+  storeLittleEndian((uint64_t)pActionJournalWriter->nIndexEntryCount, nIndexBytes, 8);
+  memcpy(nIndexBytes + 8, JOURNAL_INDEX_SIGNATURE, JOURNAL_SIGNATURE_SIZE);
+
+  if (bIsWritten) {
+    bIsWritten = fwrite(nIndexBytes, 1, JOURNAL_INDEX_FOOTER_SIZE, pActionJournalWriter->pFile) ==
+                 JOURNAL_INDEX_FOOTER_SIZE;
+  }
+
+  if (fclose(pActionJournalWriter->pFile) != 0) bIsWritten = 0;
+
+  free(pActionJournalWriter->pIndexEntries);
+  pActionJournalWriter->pFile = NULL;
+  pActionJournalWriter->pIndexEntries = NULL;
+  pActionJournalWriter->nIndexEntryCount = 0;
+  pActionJournalWriter->nIndexEntryCapacity = 0;
+
+  return bIsWritten ? 0 : -1;
+}
+
+/**
+ * Appends the start of a new game to the passed journal.
+ * @param[in,out] pActionJournalWriter The journal to append to.
+ * @param session The seed and player settings of the game.
+ * @returns `0` if the session was appended or `-1` if it could not be written.
+ */
+int recordJournalSession(ActionJournalWriter *pActionJournalWriter, JournalSession session) {
+  uint8_t nRecord[JOURNAL_MAXIMUM_RECORD_SIZE];
+  size_t nRecordSize = 0;
+
+  appendVarint(session.nSeed, nRecord, &nRecordSize);
+  appendSignedVarint(session.nPlayerMerchantId, nRecord, &nRecordSize);
+  appendSignedVarint(session.nPlayerInitialBalance, nRecord, &nRecordSize);
+  appendSignedVarint(session.nPlayerProfitTarget, nRecord, &nRecordSize);
+
+  pActionJournalWriter->nSessionCount++;
+  pActionJournalWriter->nLastKeyframeTurn = 0;
+
+  if (addJournalIndexEntry(pActionJournalWriter, 0) != 0) return -1;
+
+  return writeJournalRecord(pActionJournalWriter, nRecord, nRecordSize);
+}
+/**
+ * Appends an action applied to the current game to the passed journal. Only the fields that the action uses are
+ * written, so most actions take two to four bytes.
+ * @param[in,out] pActionJournalWriter The journal to append to.
+ * @param action The action to append.
+ * @returns `0` if the action was appended or `-1` if it could not be written.
+ */
+int recordJournalAction(ActionJournalWriter *pActionJournalWriter, GameAction action) {
+  uint8_t nRecord[JOURNAL_MAXIMUM_RECORD_SIZE];
+  size_t nRecordSize = 0;
+
+  appendVarint((unsigned char)action.cActionId, nRecord, &nRecordSize);
+
+  if (action.cActionId == BUY_ACTION_ID || action.cActionId == SELL_ACTION_ID) {
+    appendVarint((unsigned char)action.cCargoId, nRecord, &nRecordSize);
+    appendSignedVarint(action.nCargoAmount, nRecord, &nRecordSize);
+  } else if (action.cActionId == NAVIGATE_ACTION_ID) {
+    appendVarint((unsigned char)action.cPortId, nRecord, &nRecordSize);
+  }
+
+  pActionJournalWriter->nActionCount++;
+
+  return writeJournalRecord(pActionJournalWriter, nRecord, nRecordSize);
+}
+
+/**
+ * Appends the full state of the current game to the passed journal if it has reached a turn that is due for a
+ * keyframe, which is every `JOURNAL_KEYFRAME_TURN_INTERVAL` turns.
+ * @param[in,out] pActionJournalWriter The journal to append to.
+ * @param pGameState The game after its latest action.
+ * @returns `0` if the keyframe was appended or is not due or `-1` if it could not be written.
+ */
+int recordJournalKeyframe(ActionJournalWriter *pActionJournalWriter, const GameState *pGameState) {
+  uint8_t nRecord[JOURNAL_MAXIMUM_KEYFRAME_SIZE];
+  size_t nRecordSize = 0;
+
+  if (pGameState->nPlayerTurns <= pActionJournalWriter->nLastKeyframeTurn ||
+      pGameState->nPlayerTurns % JOURNAL_KEYFRAME_TURN_INTERVAL != 0 || isGameOver(pGameState)) {
+    return 0;
+  }
+
+  appendKeyframe(pGameState, nRecord, &nRecordSize);
+
+  pActionJournalWriter->nLastKeyframeTurn = pGameState->nPlayerTurns;
+
+  if (addJournalIndexEntry(pActionJournalWriter, pGameState->nPlayerTurns) != 0) return -1;
+
+  return writeJournalRecord(pActionJournalWriter, nRecord, nRecordSize);
+}
+
+/**
+ * Writes every buffered record of the passed journal to its file, so that a crash cannot lose them.
+ * @param[in,out] pActionJournalWriter The journal to flush.
+ * @returns `0` if the records were written or `-1` if they could not be.
+ */
+int flushActionJournalWriter(ActionJournalWriter *pActionJournalWriter) {
+  return fflush(pActionJournalWriter->pFile) == 0 ? 0 : -1;
+}
+
+/**
+ * Maps the passed journal into memory and checks its signature.
+ * @param[out] pActionJournalReader The journal to open.
+ * @param strFilePath The path of the file to read.
+ * @returns `0` if the journal was opened or `-1` if the file could not be mapped or is not a journal.
+ * @note Windows has no `mmap`, so the journal is read into memory there instead.
+ */
+int openActionJournalReader(ActionJournalReader *pActionJournalReader, const char *strFilePath) {
+  pActionJournalReader->pBytes = NULL;
+  pActionJournalReader->nByteCount = 0;
+  pActionJournalReader->nRecordEndOffset = 0;
+  pActionJournalReader->nOffset = JOURNAL_SIGNATURE_SIZE;
+  pActionJournalReader->pIndexBytes = NULL;
+  pActionJournalReader->nIndexEntryCount = 0;
+
+#ifdef _WIN32
+  FILE *pFile = fopen(strFilePath, "rb");
+
+  if (pFile == NULL) return -1;
+
+  uint8_t *pBytes = NULL;
+  long nFileSize = fseek(pFile, 0, SEEK_END) == 0 ? ftell(pFile) : -1;
+
+  if (nFileSize >= JOURNAL_SIGNATURE_SIZE && fseek(pFile, 0, SEEK_SET) == 0) pBytes = malloc((size_t)nFileSize);
+
+  if (pBytes != NULL && fread(pBytes, 1, (size_t)nFileSize, pFile) != (size_t)nFileSize) {
+    free(pBytes);
+    pBytes = NULL;
+  }
+
+  fclose(pFile);
+
+  if (pBytes == NULL) return -1;
+#else
+  int nFileDescriptor = open(strFilePath, O_RDONLY);
+  struct stat fileStatus;
+
+  if (nFileDescriptor < 0) return -1;
+
+  if (fstat(nFileDescriptor, &fileStatus) != 0 || fileStatus.st_size < JOURNAL_SIGNATURE_SIZE) {
+    close(nFileDescriptor);
+
+    return -1;
+  }
+
+  long nFileSize = (long)fileStatus.st_size;
+  void *pBytes = mmap(NULL, (size_t)nFileSize, PROT_READ, MAP_PRIVATE, nFileDescriptor, 0);
+
+  close(nFileDescriptor);
+
+  if (pBytes == MAP_FAILED) return -1;
+
+  posix_madvise(pBytes, (size_t)nFileSize, POSIX_MADV_SEQUENTIAL);
+#endif
+
+  pActionJournalReader->pBytes = pBytes;
+  pActionJournalReader->nByteCount = (size_t)nFileSize;
+
+  if (memcmp(pActionJournalReader->pBytes, JOURNAL_FILE_SIGNATURE, JOURNAL_SIGNATURE_SIZE) != 0) {
+    closeActionJournalReader(pActionJournalReader);
+
+    return -1;
+  }
+
+  pActionJournalReader->nRecordEndOffset = pActionJournalReader->nByteCount;
+
+  // The index is only found through its footer, since a journal that was not closed ends without one.
+  if (pActionJournalReader->nByteCount >= JOURNAL_SIGNATURE_SIZE + JOURNAL_INDEX_FOOTER_SIZE) {
+    const uint8_t *pFooterBytes = pActionJournalReader->pBytes + pActionJournalReader->nByteCount -
+                                  JOURNAL_INDEX_FOOTER_SIZE;
+    uint64_t nIndexEntryCount = loadLittleEndian(pFooterBytes, 8);
+    size_t nMaximumIndexEntryCount = (pActionJournalReader->nByteCount - JOURNAL_SIGNATURE_SIZE -
+                                      JOURNAL_INDEX_FOOTER_SIZE) / JOURNAL_INDEX_ENTRY_SIZE;
+
+    if (memcmp(pFooterBytes + 8, JOURNAL_INDEX_SIGNATURE, JOURNAL_SIGNATURE_SIZE) == 0 &&
+        nIndexEntryCount <= nMaximumIndexEntryCount) {
+      pActionJournalReader->pIndexBytes = pFooterBytes - nIndexEntryCount * JOURNAL_INDEX_ENTRY_SIZE;
+      pActionJournalReader->nIndexEntryCount = (long)nIndexEntryCount;
+      pActionJournalReader->nRecordEndOffset =
+        (size_t)(pActionJournalReader->pIndexBytes - pActionJournalReader->pBytes);
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Unmaps the passed journal.
+ * @param[in,out] pActionJournalReader The journal to close.
+ */
+void closeActionJournalReader(ActionJournalReader *pActionJournalReader) {
+  if (pActionJournalReader->pBytes != NULL) {
+#ifdef _WIN32
+    free((void *)pActionJournalReader->pBytes);
+#else
+    munmap((void *)pActionJournalReader->pBytes, pActionJournalReader->nByteCount);
+#endif
+  }
+
+  pActionJournalReader->pBytes = NULL;
+  pActionJournalReader->nByteCount = 0;
+  pActionJournalReader->nRecordEndOffset = 0;
+  pActionJournalReader->nOffset = 0;
+  pActionJournalReader->pIndexBytes = NULL;
+  pActionJournalReader->nIndexEntryCount = 0;
+}
+
+/**
+ * Moves the passed journal back to its first game, so that it can be replayed again.
+ * @param[in,out] pActionJournalReader The journal to rewind.
+ */
+void rewindActionJournalReader(ActionJournalReader *pActionJournalReader) {
+  pActionJournalReader->nOffset = JOURNAL_SIGNATURE_SIZE;
+}
+
+/**
+ * Reads the next action of the current game from the passed journal.
+ * @param[in,out] pActionJournalReader The journal to read from.
+ * @param[out] pAction The action that was read.
+ * @returns `0` if the action was read or `-1` if the journal ends first or the action is corrupt.
+ */
+static int readJournalAction(ActionJournalReader *pActionJournalReader, GameAction *pAction) {
+  GameAction action = {0};
+
+  if (readCharacterId(pActionJournalReader, &action.cActionId) != 0) return -1;
+
+  if (action.cActionId == BUY_ACTION_ID || action.cActionId == SELL_ACTION_ID) {
+    if (readCharacterId(pActionJournalReader, &action.cCargoId) != 0 ||
+        readSignedVarint(pActionJournalReader, &action.nCargoAmount) != 0) {
+      return -1;
+    }
+  } else if (action.cActionId == NAVIGATE_ACTION_ID) {
+    if (readCharacterId(pActionJournalReader, &action.cPortId) != 0) return -1;
+  }
+
+  *pAction = action;
+
+  return 0;
+}
+
+/**
+ * Reads the seed and player settings of the next game from the passed journal and starts the game.
+ * @param[in,out] pActionJournalReader The journal to read from.
+ * @param[out] pSession The seed and player settings of the game.
+ * @param[out] pGameState The game to start.
+ * @returns `0` if the game was started or `-1` if the journal ends first or the settings are corrupt.
+ */
+static int readJournalSession(ActionJournalReader *pActionJournalReader, JournalSession *pSession,
+                              GameState *pGameState) {
+  if (readVarint(pActionJournalReader, &pSession->nSeed) != 0 ||
+      readSignedVarint(pActionJournalReader, &pSession->nPlayerMerchantId) != 0 ||
+      readSignedVarint(pActionJournalReader, &pSession->nPlayerInitialBalance) != 0 ||
+      readSignedVarint(pActionJournalReader, &pSession->nPlayerProfitTarget) != 0) {
+    return -1;
+  }
+
+  initializeGame(pGameState, pSession->nPlayerMerchantId, pSession->nPlayerInitialBalance,
+                 pSession->nPlayerProfitTarget, pSession->nSeed);
+
+  return 0;
+}
+
+/**
+ * Replays the next recorded action of the current game. Keyframes along the way are checked against the replayed
+ * game, so a journal that no longer matches the engine is reported as malformed.
+ * @param[in,out] pActionJournalReader The journal to read from.
+ * @param[in,out] pGameState The game to advance.
+ * @returns `JOURNAL_READ_SUCCESS` if an action was applied, `JOURNAL_READ_END` if the game is already over, or
+ * `JOURNAL_READ_MALFORMED` if the journal is corrupt, ends in the middle of the game, or differs from the game.
+ */
+int replayJournalAction(ActionJournalReader *pActionJournalReader, GameState *pGameState) {
+  if (isGameOver(pGameState)) return JOURNAL_READ_END;
+
+  while (pActionJournalReader->nOffset < pActionJournalReader->nRecordEndOffset &&
+         pActionJournalReader->pBytes[pActionJournalReader->nOffset] == KEYFRAME_RECORD_ID) {
+    uint8_t nRecord[JOURNAL_MAXIMUM_KEYFRAME_SIZE];
+    size_t nRecordSize = 0;
+    size_t nKeyframeOffset = pActionJournalReader->nOffset;
+    GameState keyframeGameState;
+
+    pActionJournalReader->nOffset++;
+
+    if (readKeyframe(pActionJournalReader, &keyframeGameState) != 0) return JOURNAL_READ_MALFORMED;
+
+    // Re-encoding the replayed game compares every field without caring about the padding of the structure.
+    appendKeyframe(pGameState, nRecord, &nRecordSize);
+
+    if (nRecordSize != pActionJournalReader->nOffset - nKeyframeOffset ||
+        memcmp(nRecord, pActionJournalReader->pBytes + nKeyframeOffset, nRecordSize) != 0) {
+      return JOURNAL_READ_MALFORMED;
+    }
+  }
+
+  GameAction action;
+
+  if (readJournalAction(pActionJournalReader, &action) != 0) return JOURNAL_READ_MALFORMED;
+
+  stepGame(pGameState, action);
+
+  return JOURNAL_READ_SUCCESS;
+}
+
+/**
+ * Replays the next recorded game of the passed journal, applying its actions until the game is over.
+ * @param[in,out] pActionJournalReader The journal to read from.
+ * @param[out] pSession The seed and player settings of the game.
+ * @param[out] pGameState The game to replay, which holds its final state afterwards.
+ * @param[out] nActionCount The number of actions that were applied.
+ * @returns `JOURNAL_READ_SUCCESS` if a game was replayed, `JOURNAL_READ_END` if no games are left, or
+ * `JOURNAL_READ_MALFORMED` if the journal is corrupt or ends in the middle of a game, whose state is then as far as
+ * it was recorded.
+ */
+int replayJournalSession(ActionJournalReader *pActionJournalReader, JournalSession *pSession, GameState *pGameState,
+                         long *nActionCount) {
+  int nStatus;
+
+  *nActionCount = 0;
+
+  if (pActionJournalReader->nOffset >= pActionJournalReader->nRecordEndOffset) return JOURNAL_READ_END;
+
+  if (readJournalSession(pActionJournalReader, pSession, pGameState) != 0) return JOURNAL_READ_MALFORMED;
+
+  while ((nStatus = replayJournalAction(pActionJournalReader, pGameState)) == JOURNAL_READ_SUCCESS) {
+    (*nActionCount)++;
+  }
+
+  return nStatus == JOURNAL_READ_END ? JOURNAL_READ_SUCCESS : JOURNAL_READ_MALFORMED;
+}
+
+/**
+ * Restores the state of a recorded game at the start of the passed turn from the nearest keyframe before it, then
+ * replays the few actions after the keyframe. The journal is left at the next action, so the game can be stepped
+ * forwards with `replayJournalAction`, and backwards by seeking to an earlier turn.
+ * @param[in,out] pActionJournalReader The journal to seek through.
+ * @param nSessionIndex The index of the game, which is `0` for the first game of the journal.
+ * @param nTurn The turn to seek to, which stops at the end of the game if the game ended before it.
+ * @param[out] pGameState The restored game.
+ * @returns `0` if the game was restored or `-1` if the journal has no index, lacks the game, or is corrupt.
+ */
+int seekJournalTurn(ActionJournalReader *pActionJournalReader, long nSessionIndex, int nTurn, GameState *pGameState) {
+  long nLowIndex = 0;
+  long nHighIndex = pActionJournalReader->nIndexEntryCount;
+
+  // Finds the first entry after the passed turn, since the entries are sorted by session and then by turn.
+  while (nLowIndex < nHighIndex) {
+    long nMiddleIndex = nLowIndex + (nHighIndex - nLowIndex) / 2;
+    const uint8_t *pEntryBytes = pActionJournalReader->pIndexBytes + nMiddleIndex * JOURNAL_INDEX_ENTRY_SIZE;
+    long nEntrySessionIndex = (long)loadLittleEndian(pEntryBytes, 4);
+    long nEntryTurn = (long)loadLittleEndian(pEntryBytes + 4, 4);
+
+    if (nEntrySessionIndex < nSessionIndex || (nEntrySessionIndex == nSessionIndex && nEntryTurn <= nTurn)) {
+      nLowIndex = nMiddleIndex + 1;
+    } else {
+      nHighIndex = nMiddleIndex;
+    }
+  }
+
+  if (nLowIndex == 0) return -1;
+
+  const uint8_t *pEntryBytes = pActionJournalReader->pIndexBytes + (nLowIndex - 1) * JOURNAL_INDEX_ENTRY_SIZE;
+  uint64_t nEntryOffset = loadLittleEndian(pEntryBytes + 8, 8);
+
+  if ((long)loadLittleEndian(pEntryBytes, 4) != nSessionIndex ||
+      nEntryOffset >= pActionJournalReader->nRecordEndOffset) {
+    return -1;
+  }
+
+  pActionJournalReader->nOffset = (size_t)nEntryOffset;
+
+  if (loadLittleEndian(pEntryBytes + 4, 4) == 0) {
+    JournalSession session;
+
+    if (readJournalSession(pActionJournalReader, &session, pGameState) != 0) return -1;
+  } else {
+    char cRecordId;
+
+    if (readCharacterId(pActionJournalReader, &cRecordId) != 0 || cRecordId != KEYFRAME_RECORD_ID ||
+        readKeyframe(pActionJournalReader, pGameState) != 0) {
+      return -1;
+    }
+  }
+
+  while (pGameState->nPlayerTurns < nTurn) {
+    int nStatus = replayJournalAction(pActionJournalReader, pGameState);
+
+    if (nStatus == JOURNAL_READ_END) break;
+
+    if (nStatus == JOURNAL_READ_MALFORMED) return -1;
+  }
+
+  return 0;
+}
@@ -16,273 +16,304 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <ctype.h>
+#include <inttypes.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
-#include "console.h"
+#include "art_assets.h"
+#include "clock.h"
+#include "engine.h"
+#include "frame.h"
+#include "input.h"
+#include "journal.h"
+#include "metrics.h"
+#include "output.h"
 #include "prompts.h"
+#include "session.h"
+#include "snapshot.h"
 #include "text_graphics.h"
-#include "trading.h"
-#include "weather.h"
+#include "trace.h"
 
-#define MAXIMUM_PLAYER_TURNS 31
+static ActionJournalWriter *pOpenActionJournalWriter = NULL;
 
-int main(void) {
-  srand(time(NULL));
+/**
+ * Prints out the byte count of every art asset sent so far and how often it was sent to the standard error stream.
+ * @param nTotalFrameSize The number of bytes composed in all frames, which the art is compared against.
+ */
+static void printArtAssetStatistics(size_t nTotalFrameSize) {
+  size_t nTotalArtSize = 0;
 
-  printf("\n");
+  for (int nArtAssetIndex = 0; nArtAssetIndex < ART_ASSET_COUNT; nArtAssetIndex++) {
+    const ArtAsset *pArtAsset = getArtAsset(nArtAssetIndex);
+    long nUseCount = getArtAssetUseCount(nArtAssetIndex);
 
-  printf("Tides of Manila: A Merchant's Quest  Copyright (C) 2024  Louis Raphael V. Panaligan\n");
-  printf("This program comes with ABSOLUTELY NO WARRANTY.\n");
-  printf("This is free software, and you are welcome to redistribute it under certain conditions.\n");
+    if (nUseCount == 0) continue;
 
-  printGameStartScreen();
+    nTotalArtSize += pArtAsset->nByteCount * nUseCount;
 
-  int nPlayerMerchantId;
-  int nPlayerInitialBalance;
-  int nPlayerBalance;
-  int nPlayerProfitTarget;
+    fprintf(stderr, "  %-28s %5lu bytes x %3ld = %7lu bytes\n", pArtAsset->strName, (unsigned long)pArtAsset->nByteCount,
+            nUseCount, (unsigned long)(pArtAsset->nByteCount * nUseCount));
+  }
 
-  nPlayerMerchantId = promptPlayerForMerchantId();
+  fprintf(stderr, "Art: %lu bytes (%.1f%% of all composed frames)\n", (unsigned long)nTotalArtSize,
+          nTotalFrameSize > 0 ? nTotalArtSize * 100.0 / nTotalFrameSize : 0.0);
+}
 
-  printf("\n");
+/** Closes the journal that the game is recording to, if any, which runs when the game exits for any reason. */
+static void closeOpenActionJournal(void) {
+  if (pOpenActionJournalWriter != NULL && closeActionJournalWriter(pOpenActionJournalWriter) != 0) {
+    fprintf(stderr, "Could not write to the journal.\n");
+  }
 
-  nPlayerInitialBalance = promptPlayerForInitialBalance();
-  nPlayerBalance = nPlayerInitialBalance;
+  pOpenActionJournalWriter = NULL;
+}
 
-  printf("\n");
+/**
+ * Plays a started or resumed game by feeding it the player's answers one at a time until the player has quit or
+ * exhausted all turns.
+ * @param[in,out] pGameSession The game to play, which holds the final state once the game is over.
+ * @note The game ends if the input ends before the player is done.
+ */
+static void playGameSession(GameSession *pGameSession) {
+  const char *pToken;
+  size_t nTokenLength;
 
-  nPlayerProfitTarget = promptPlayerForProfitTarget();
+  while (pGameSession->nSessionState != GAME_OVER_SESSION_STATE) {
+    dumpRequestedMetrics();
 
-  int nPlayerTurns = 0;
-  int bIsQuitting = 0;
-  char cCurrentPortId = 'M';
-  int nPlayerProfit = 0;
-  int nShipCargoLimit = TIER_ONE_SHIP_CARGO_LIMIT;
-  int nShipCoconutCargoAmount = 0;
-  int nShipRiceCargoAmount = 0;
-  int nShipSilkCargoAmount = 0;
-  int nShipGunCargoAmount = 0;
-  int nStormTurnDuration = 0;
-  int bIsNewStorm;
-  int nStormWindSignalNumber;
-  int nPostponedDepartureChance = DEFAULT_POSTPONED_DEPARTURE_CHANCE;
+    if (readInputToken(&pToken, &nTokenLength) != 0) {
+      fprintf(stderr, "The input ended before the game did.\n");
 
-  while (nPlayerTurns < MAXIMUM_PLAYER_TURNS && !bIsQuitting) {
-    int nCoconutMarketPrice;
-    int nRiceMarketPrice;
-    int nSilkMarketPrice;
-    int nGunMarketPrice;
+      exit(1);
+    }
 
-    switch (cCurrentPortId) {
-      case 'T': {
-        nCoconutMarketPrice = generateRandomPrice(TONDO_MINIMUM_COCONUT_PRICE, TONDO_MAXIMUM_COCONUT_PRICE);
-        nRiceMarketPrice = generateRandomPrice(TONDO_MINIMUM_RICE_PRICE, TONDO_MAXIMUM_RICE_PRICE);
-        nSilkMarketPrice = generateRandomPrice(TONDO_MINIMUM_SILK_PRICE, TONDO_MAXIMUM_SILK_PRICE);
-        nGunMarketPrice = generateRandomPrice(TONDO_MINIMUM_GUN_PRICE, TONDO_MAXIMUM_GUN_PRICE);
+    feedGameSession(pGameSession, pToken, nTokenLength);
+  }
+}
 
-        break;
-      }
-      case 'M': {
-        nCoconutMarketPrice = generateRandomPrice(MANILA_MINIMUM_COCONUT_PRICE, MANILA_MAXIMUM_COCONUT_PRICE);
-        nRiceMarketPrice = generateRandomPrice(MANILA_MINIMUM_RICE_PRICE, MANILA_MAXIMUM_RICE_PRICE);
-        nSilkMarketPrice = generateRandomPrice(MANILA_MINIMUM_SILK_PRICE, MANILA_MAXIMUM_SILK_PRICE);
-        nGunMarketPrice = generateRandomPrice(MANILA_MINIMUM_GUN_PRICE, MANILA_MAXIMUM_GUN_PRICE);
+int main(int argc, char *argv[]) {
+  uint64_t nSeed = (uint64_t)time(NULL);
+  int bIsReportingFrames = 0;
+  int bIsRenderingDifferentially = 0;
+  const char *strOutputSinkName = "tty";
+  const char *strScriptFilePath = NULL;
+  const char *strJournalFilePath = NULL;
+  const char *strSaveFilePath = NULL;
+  const char *strResumeFilePath = NULL;
+  const char *strMetricsFilePath = NULL;
+  char cMetricsFormatId = TEXT_METRICS_FORMAT_ID;
+#ifdef TIDES_TRACE
+  const char *strTraceFilePath = "tides-trace.json";
+#endif
+
+  for (int nArgumentIndex = 1; nArgumentIndex < argc; nArgumentIndex++) {
+    if (strcmp(argv[nArgumentIndex], "--seed") == 0 && nArgumentIndex + 1 < argc &&
+        parseRandomSeed(argv[nArgumentIndex + 1], &nSeed) == 0) {
+      nArgumentIndex++;
+    } else if (strcmp(argv[nArgumentIndex], "--frame-stats") == 0) {
+      bIsReportingFrames = 1;
+    } else if (strcmp(argv[nArgumentIndex], "--diff-render") == 0) {
+      bIsRenderingDifferentially = 1;
+    } else if (strcmp(argv[nArgumentIndex], "--output") == 0 && nArgumentIndex + 1 < argc) {
+      strOutputSinkName = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--script") == 0 && nArgumentIndex + 1 < argc) {
+      strScriptFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--record") == 0 && nArgumentIndex + 1 < argc) {
+      strJournalFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--save") == 0 && nArgumentIndex + 1 < argc) {
+      strSaveFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--resume") == 0 && nArgumentIndex + 1 < argc) {
+      strResumeFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--metrics") == 0 && nArgumentIndex + 1 < argc) {
+      strMetricsFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--metrics-format") == 0 && nArgumentIndex + 1 < argc &&
+               strcmp(argv[nArgumentIndex + 1], "text") == 0) {
+      cMetricsFormatId = TEXT_METRICS_FORMAT_ID;
+      nArgumentIndex++;
+    } else if (strcmp(argv[nArgumentIndex], "--metrics-format") == 0 && nArgumentIndex + 1 < argc &&
+               strcmp(argv[nArgumentIndex + 1], "json") == 0) {
+      cMetricsFormatId = JSON_METRICS_FORMAT_ID;
+      nArgumentIndex++;
+#ifdef TIDES_TRACE
+    } else if (strcmp(argv[nArgumentIndex], "--trace") == 0 && nArgumentIndex + 1 < argc) {
+      strTraceFilePath = argv[++nArgumentIndex];
+#endif
+    } else {
+      fprintf(stderr,
+              "Usage: %s [--seed SEED] [--frame-stats] [--diff-render] [--output tty|null|FILE] [--script FILE|-]\n"
+              "       [--record FILE] [--save FILE] [--resume FILE] [--metrics FILE|-] [--metrics-format text|json]\n",
+              argv[0]);
+
+      return 1;
+    }
+  }
 
-        break;
-      }
-      case 'P': {
-        nCoconutMarketPrice = generateRandomPrice(PANDAKAN_MINIMUM_COCONUT_PRICE, PANDAKAN_MAXIMUM_COCONUT_PRICE);
-        nRiceMarketPrice = generateRandomPrice(PANDAKAN_MINIMUM_RICE_PRICE, PANDAKAN_MAXIMUM_RICE_PRICE);
-        nSilkMarketPrice = generateRandomPrice(PANDAKAN_MINIMUM_SILK_PRICE, PANDAKAN_MAXIMUM_SILK_PRICE);
-        nGunMarketPrice = generateRandomPrice(PANDAKAN_MINIMUM_GUN_PRICE, PANDAKAN_MAXIMUM_GUN_PRICE);
+  if (strMetricsFilePath != NULL) {
+    setMetricsRecording(1);
+    setMetricsDump(strMetricsFilePath, cMetricsFormatId);
+    installMetricsDumpSignal();
 
-        break;
-      }
-      case 'S': {
-        nCoconutMarketPrice = generateRandomPrice(SAPA_MINIMUM_COCONUT_PRICE, SAPA_MAXIMUM_COCONUT_PRICE);
-        nRiceMarketPrice = generateRandomPrice(SAPA_MINIMUM_RICE_PRICE, SAPA_MAXIMUM_RICE_PRICE);
-        nSilkMarketPrice = generateRandomPrice(SAPA_MINIMUM_SILK_PRICE, SAPA_MAXIMUM_SILK_PRICE);
-        nGunMarketPrice = generateRandomPrice(SAPA_MINIMUM_GUN_PRICE, SAPA_MAXIMUM_GUN_PRICE);
+    // The game also exits when the input ends mid-game, which must still dump the metrics it has gathered.
+    atexit(dumpMetrics);
+  }
 
-        break;
-      }
-    }
+#ifdef TIDES_TRACE
+  if (openTraceFile(strTraceFilePath) != 0) {
+    fprintf(stderr, "Could not open the trace %s.\n", strTraceFilePath);
 
-    int bIsNavigating = 0;
+    return 1;
+  }
 
-    while (!bIsNavigating && !bIsQuitting) {
-      nPlayerProfit = ((nPlayerBalance - nPlayerInitialBalance) / (nPlayerInitialBalance * 1.0)) * 100;
+  // The game also exits when the input ends mid-game, which must still leave the trace with its buffered spans.
+  atexit(closeTraceFile);
+#endif
 
-      int nShipTotalCargoAmount =
-        nShipCoconutCargoAmount + nShipRiceCargoAmount + nShipSilkCargoAmount + nShipGunCargoAmount;
+  // A journal replays its games from their seeds, which a resumed game no longer has.
+  if (strJournalFilePath != NULL && strResumeFilePath != NULL) {
+    fprintf(stderr, "A resumed game cannot be recorded.\n");
 
-      printMainScreen(nPlayerTurns, cCurrentPortId, nPlayerMerchantId, nPlayerBalance, nPlayerProfit,
-                      nPlayerProfitTarget, nShipTotalCargoAmount, nShipCargoLimit, nShipCoconutCargoAmount,
-                      nShipRiceCargoAmount, nShipSilkCargoAmount, nShipGunCargoAmount, nCoconutMarketPrice,
-                      nRiceMarketPrice, nSilkMarketPrice, nGunMarketPrice);
+    return 1;
+  }
 
-      char cChosenActionId =
-        promptPlayerForActionId(nShipTotalCargoAmount, nShipCargoLimit, nPlayerBalance, nCoconutMarketPrice,
-                                nRiceMarketPrice, nSilkMarketPrice, nGunMarketPrice);
+  GameState resumedGameState;
 
-      printf("\n");
+  if (strResumeFilePath != NULL && loadGameSnapshot(&resumedGameState, strResumeFilePath) != 0) {
+    fprintf(stderr, "Could not load the saved game %s.\n", strResumeFilePath);
 
-      if (cChosenActionId == 'B' || cChosenActionId == 'S') {
-        char cChosenCargoId = promptPlayerForCargoId(
-          cChosenActionId, nPlayerBalance, nShipCoconutCargoAmount, nRiceMarketPrice, nSilkMarketPrice, nGunMarketPrice,
-          nShipCoconutCargoAmount, nShipRiceCargoAmount, nShipSilkCargoAmount, nShipGunCargoAmount);
+    return 1;
+  }
 
-        if (cChosenCargoId != 'X') {
-          printf("\n");
+  OutputSink outputSink;
 
-          int nCargoAmount = promptPlayerForCargoAmount(
-            cChosenActionId, nShipCargoLimit - nShipTotalCargoAmount, cChosenCargoId, nPlayerBalance,
-            nCoconutMarketPrice, nRiceMarketPrice, nSilkMarketPrice, nGunMarketPrice, nShipCoconutCargoAmount,
-            nShipRiceCargoAmount, nShipSilkCargoAmount, nShipGunCargoAmount);
+  if (strcmp(strOutputSinkName, "tty") == 0) {
+    openTtyOutputSink(&outputSink);
+  } else if (strcmp(strOutputSinkName, "null") == 0) {
+    openNullOutputSink(&outputSink);
+  } else if (openFileOutputSink(&outputSink, strOutputSinkName) != 0) {
+    fprintf(stderr, "Could not open the output file %s.\n", strOutputSinkName);
 
-          printf("\n");
+    return 1;
+  }
 
-          int bIsConfirmed = promptPlayerForConfirmation();
+  if (strScriptFilePath != NULL && strcmp(strScriptFilePath, "-") != 0 && openInputFile(strScriptFilePath) != 0) {
+    fprintf(stderr, "Could not open the script %s.\n", strScriptFilePath);
+    closeOutputSink(&outputSink);
 
-          if (bIsConfirmed) {
-            int nCargoPrice;
-            int *nShipCargoAmount;
+    return 1;
+  }
 
-            if (cChosenCargoId == 'C') {
-              nCargoPrice = nCoconutMarketPrice;
-              nShipCargoAmount = &nShipCoconutCargoAmount;
-            } else if (cChosenCargoId == 'R') {
-              nCargoPrice = nRiceMarketPrice;
-              nShipCargoAmount = &nShipRiceCargoAmount;
-            } else if (cChosenCargoId == 'S') {
-              nCargoPrice = nSilkMarketPrice;
-              nShipCargoAmount = &nShipSilkCargoAmount;
-            } else {
-              nCargoPrice = nGunMarketPrice;
-              nShipCargoAmount = &nShipGunCargoAmount;
-            }
+  static ActionJournalWriter actionJournalWriter;
+  ActionJournalWriter *pActionJournalWriter = NULL;
 
-            tradeCargo(cChosenActionId, &nPlayerBalance, nCargoPrice, nCargoAmount, nShipCargoAmount);
+  if (strJournalFilePath != NULL) {
+    // Interactive games flush every action so that a crash keeps everything played up to it.
+    if (openActionJournalWriter(&actionJournalWriter, strJournalFilePath, strScriptFilePath == NULL) != 0) {
+      fprintf(stderr, "Could not open the journal %s.\n", strJournalFilePath);
+      closeOutputSink(&outputSink);
 
-            printTransactionScreen(cChosenActionId, cChosenCargoId, nCargoAmount, nCargoPrice);
+      return 1;
+    }
 
-            promptPlayerForContinuation();
-          }
-        }
-      } else if (cChosenActionId == 'U') {
-        printShipUpgradeMenu(nShipCargoLimit);
+    pActionJournalWriter = &actionJournalWriter;
+    pOpenActionJournalWriter = pActionJournalWriter;
 
-        int bIsUpgrading = promptPlayerForShipUpgrade(nShipCargoLimit, nPlayerBalance);
+    // The game also exits when the input ends mid-game, which must still leave the journal with its index.
+    atexit(closeOpenActionJournal);
+  }
 
-        if (bIsUpgrading) {
-          int nShipUpgradeCost;
-          int nShipNewCargoLimit;
-          int nShipCargoLimitIncrease;
+  setOutputSink(&outputSink);
+  setContinuationSkipping(strScriptFilePath != NULL);
+  setFrameStatisticsReporting(bIsReportingFrames);
 
-          if (nShipCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT) {
-            nShipUpgradeCost = TIER_TWO_SHIP_UPGRADE_COST;
-            nShipNewCargoLimit = TIER_TWO_SHIP_CARGO_LIMIT;
-            nShipCargoLimitIncrease = nShipNewCargoLimit - nShipCargoLimit;
-          } else if (nShipCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT) {
-            nShipUpgradeCost = TIER_THREE_SHIP_UPGRADE_COST;
-            nShipNewCargoLimit = TIER_THREE_SHIP_CARGO_LIMIT;
-            nShipCargoLimitIncrease = nShipNewCargoLimit - nShipCargoLimit;
-          } else {
-            nShipUpgradeCost = TIER_FOUR_SHIP_UPGRADE_COST;
-            nShipNewCargoLimit = TIER_FOUR_SHIP_CARGO_LIMIT;
-            nShipCargoLimitIncrease = nShipNewCargoLimit - nShipCargoLimit;
-          }
+  if (setFrameDifferentialRendering(bIsRenderingDifferentially) != 0) {
+    fprintf(stderr, "Could not allocate the screen renderer.\n");
 
-          upgradeShip(&nPlayerBalance, nShipUpgradeCost, &nShipCargoLimit, nShipNewCargoLimit);
+    return 1;
+  }
 
-          printShipUpgradeScreen(nShipCargoLimitIncrease, nShipUpgradeCost);
+  printOutput("\n");
 
-          promptPlayerForContinuation();
-        }
-      } else if (cChosenActionId == 'N') {
-        printNavigationMenu(cCurrentPortId, nPlayerTurns);
+  printOutput("Tides of Manila: A Merchant's Quest  Copyright (C) 2024  Louis Raphael V. Panaligan\n");
+  printOutput("This program comes with ABSOLUTELY NO WARRANTY.\n");
+  printOutput("This is free software, and you are welcome to redistribute it under certain conditions.\n");
 
-        char cChosenPortId = promptPlayerForPortId(cCurrentPortId);
+  static GameSession gameSession;
+  GameState *pGameState = &gameSession.gameState;
+  OutputSink nullOutputSink;
+  long nSessionCount = 0;
+  double nStartSeconds = getMonotonicNanoseconds() / 1e9;
 
-        if (cChosenPortId != 'X') {
-          printf("\n");
+  openNullOutputSink(&nullOutputSink);
 
-          int bIsConfirmed = promptPlayerForConfirmation();
+  // A script may hold many sessions back to back, which are played until it runs out, showing only their end screens.
+  do {
+    uint64_t nSessionSeed = nSeed + (uint64_t)nSessionCount;
 
-          if (bIsConfirmed) {
-            int bIsSuccessful = generateRandomBool(100 - nPostponedDepartureChance);
+    if (strResumeFilePath != NULL && nSessionCount == 0) {
+      printOutput("Resumed game: %s\n", strResumeFilePath);
+    } else {
+      printOutput("Game seed: %" PRIu64 "\n", nSessionSeed);
+    }
 
-            if (bIsSuccessful) {
-              cCurrentPortId = cChosenPortId;
-
-              printNavigationScreen(bIsSuccessful, cCurrentPortId, nPlayerTurns);
-            } else {
-              printNavigationScreen(bIsSuccessful, cChosenPortId, nPlayerTurns);
-            }
+    if (strScriptFilePath != NULL) setOutputSink(&nullOutputSink);
 
-            promptPlayerForContinuation();
-
-            nPlayerTurns++;
-            bIsNavigating = 1;
-          }
-        }
-      } else {
-        bIsQuitting = 1;
-      }
+    if (strResumeFilePath != NULL && nSessionCount == 0) {
+      resumeGameSession(&gameSession, &resumedGameState);
+    } else {
+      startGameSession(&gameSession, nSessionSeed, pActionJournalWriter);
     }
 
-    if (!bIsQuitting) {
-      if (nStormTurnDuration == -1) {
-        nStormTurnDuration = 0;
-      } else if (nStormTurnDuration == 0) {
-        int bStartStorm = generateRandomBool(50);
-
-        if (bStartStorm) {
-          nStormTurnDuration = generateRandomStormTurnDuration(1) + 1;
-          bIsNewStorm = 1;
-          nStormWindSignalNumber = 1;
-        }
-      }
-
-      if (nStormTurnDuration > 0) {
-        nStormTurnDuration--;
+    playGameSession(&gameSession);
 
-        int nStormOldWindSignalNumber = nStormWindSignalNumber;
+    setOutputSink(&outputSink);
 
-        if (nStormTurnDuration == 0) {
-          nPostponedDepartureChance = 0;
+    printGameEndScreen(pGameState->nPlayerProfit, pGameState->nPlayerProfitTarget, pGameState->nPlayerBalance,
+                       pGameState->nPlayerInitialBalance, pGameState->nPlayerTurns);
 
-          nStormTurnDuration--;
-        } else if (!bIsNewStorm && (nStormWindSignalNumber < 5)) {
-          int bAdjustStormStrength = generateRandomBool(50);
+    // Quitting before the last turn suspends the game instead of throwing it away.
+    if (strSaveFilePath != NULL && pGameState->bIsQuitting && pGameState->nPlayerTurns < MAXIMUM_PLAYER_TURNS) {
+      GameState savedGameState = *pGameState;
 
-          if (bAdjustStormStrength) {
-            int nStormNewWindSignalNumber;
+      savedGameState.bIsQuitting = 0;
 
-            if (nStormWindSignalNumber < 5) {
-              nStormNewWindSignalNumber = nStormWindSignalNumber + 1;
-            } else {
-              nStormNewWindSignalNumber = nStormWindSignalNumber - 1;
-            }
+      if (saveGameSnapshot(&savedGameState, strSaveFilePath) == 0) {
+        printOutput("Game saved: %s\n", strSaveFilePath);
+      } else {
+        fprintf(stderr, "Could not save the game to %s.\n", strSaveFilePath);
+      }
+    }
 
-            setStormStrength(&nStormWindSignalNumber, nStormNewWindSignalNumber, &nPostponedDepartureChance);
-          }
-        }
+    nSessionCount++;
+  } while (strScriptFilePath != NULL && hasInputToken());
 
-        printWeatherReportScreen(bIsNewStorm, nStormOldWindSignalNumber, nStormWindSignalNumber,
-                                 nPostponedDepartureChance, nStormTurnDuration);
+  if (strScriptFilePath != NULL) {
+    double nElapsedSeconds = getMonotonicNanoseconds() / 1e9 - nStartSeconds;
 
-        if (bIsNewStorm) bIsNewStorm = 0;
+    fprintf(stderr, "Sessions: %ld in %.3f s (%.0f sessions/s)\n", nSessionCount, nElapsedSeconds,
+            nElapsedSeconds > 0 ? nSessionCount / nElapsedSeconds : 0.0);
+  }
 
-        promptPlayerForContinuation();
-      }
-    }
+  // The end screen is still buffered by the console sink, and its write must be counted as well.
+  flushOutput();
+
+  if (bIsReportingFrames) {
+    const FrameStatistics *pFrameStatistics = getFrameStatistics();
+    long nFrameCount = pFrameStatistics->nFrameCount > 0 ? pFrameStatistics->nFrameCount : 1;
+
+    fprintf(stderr, "Frames: %ld | Console writes: %ld | Emit: %.3f ms (%.1f us per frame)\n",
+            pFrameStatistics->nFrameCount, getConsoleWriteCount(), pFrameStatistics->nTotalEmitSeconds * 1e3,
+            pFrameStatistics->nTotalEmitSeconds * 1e6 / nFrameCount);
+    fprintf(stderr, "Bytes: %lu written (%.0f per frame) | %lu composed (%.0f per frame)\n",
+            (unsigned long)pFrameStatistics->nTotalFrameSize, (double)pFrameStatistics->nTotalFrameSize / nFrameCount,
+            (unsigned long)pFrameStatistics->nTotalComposedSize,
+            (double)pFrameStatistics->nTotalComposedSize / nFrameCount);
+    printArtAssetStatistics(pFrameStatistics->nTotalComposedSize);
   }
 
-  printGameEndScreen(nPlayerProfit, nPlayerProfitTarget, nPlayerBalance, nPlayerInitialBalance, nPlayerTurns);
+  closeOutputSink(&outputSink);
 
   return 0;
 }
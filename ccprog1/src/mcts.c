@@ -0,0 +1,525 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "mcts.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "clock.h"
+#include "policy.h"
+#include "prompts.h"
+#include "thread_pool.h"
+
+#define MCTS_INITIAL_NODE_CAPACITY 4096
+#define MCTS_MAXIMUM_DEPTH 256
+
+/** The shared arguments of a single decision. */
+typedef struct {
+  MctsSearch *pMctsSearch;
+  const GameState *pRootGameState;
+  uint64_t nDeadlineNanoseconds;
+} MctsDecision;
+
+/**
+ * Checks whether the passed deadline has passed.
+ * @param nDeadlineNanoseconds The deadline on the monotonic clock.
+ * @returns `1` if the deadline has passed or `0` if it has not.
+ */
+static int hasDeadlinePassed(uint64_t nDeadlineNanoseconds) {
+  return getMonotonicNanoseconds() >= nDeadlineNanoseconds;
+}
+
+/**
+ * Empties the passed tree so that it only has an unexpanded root, and draws the seed of the futures it plays out.
+ * @param[in,out] pMctsTree The tree to empty.
+ */
+static void resetMctsTree(MctsTree *pMctsTree) {
+  pMctsTree->pNodes[0].nFirstChildIndex = -1;
+  pMctsTree->pNodes[0].nVisitCount = 0;
+  pMctsTree->pNodes[0].nRewardSum = 0;
+  pMctsTree->pNodes[0].nValue = 0;
+  pMctsTree->nNodeCount = 1;
+  pMctsTree->nRolloutCount = 0;
+  pMctsTree->nTranspositionCount = 0;
+  pMctsTree->nWorldSeed = (uint64_t)generateRandomNumber(&pMctsTree->randomGenerator) << 32 |
+                          generateRandomNumber(&pMctsTree->randomGenerator);
+}
+
+/**
+ * Records the passed action in the cargo traded this turn, which are forgotten once the turn ends.
+ * @param action The action that was applied.
+ * @param[in,out] nBoughtCargoMask The cargo bought this turn.
+ * @param[in,out] nSoldCargoMask The cargo sold this turn.
+ */
+static void recordTradedCargo(GameAction action, int *nBoughtCargoMask, int *nSoldCargoMask) {
+  if (action.cActionId == BUY_ACTION_ID) {
+    *nBoughtCargoMask |= 1 << getCargoIndex(action.cCargoId);
+  } else if (action.cActionId == SELL_ACTION_ID) {
+    *nSoldCargoMask |= 1 << getCargoIndex(action.cCargoId);
+  } else if (action.cActionId == NAVIGATE_ACTION_ID) {
+    *nBoughtCargoMask = 0;
+    *nSoldCargoMask = 0;
+  }
+}
+
+/**
+ * Hashes the passed game along with the cargo traded this turn, which decide the actions that the search allows.
+ * @param pGameState The game to hash.
+ * @param nBoughtCargoMask The cargo bought this turn.
+ * @param nSoldCargoMask The cargo sold this turn.
+ * @returns The hash of the game in the transposition table.
+ */
+static uint64_t hashMctsState(const GameState *pGameState, int nBoughtCargoMask, int nSoldCargoMask) {
+  PackedGameState packedGameState;
+
+  packGameState(pGameState, &packedGameState);
+
+  return hashPackedGameState(&packedGameState) ^
+         (uint64_t)(nBoughtCargoMask | nSoldCargoMask << CARGO_COUNT) * 0x9E3779B97F4A7C15ULL;
+}
+
+/**
+ * Adds an unvisited child for every action index to the passed node, growing the tree's nodes if they are full.
+ * @param[in,out] pMctsTree The tree that the node belongs to.
+ * @param nNodeIndex The index of the node to expand.
+ * @returns `1` if the node was expanded or `0` if the nodes could not be grown.
+ */
+static int expandMctsNode(MctsTree *pMctsTree, long nNodeIndex) {
+  if (pMctsTree->nNodeCount + MCTS_ACTION_COUNT > pMctsTree->nNodeCapacity) {
+    MctsNode *pNodes = realloc(pMctsTree->pNodes, sizeof(MctsNode) * pMctsTree->nNodeCapacity * 2);
+
+    if (pNodes == NULL) return 0;
+
+    pMctsTree->pNodes = pNodes;
+    pMctsTree->nNodeCapacity *= 2;
+  }
+
+  pMctsTree->pNodes[nNodeIndex].nFirstChildIndex = pMctsTree->nNodeCount;
+
+  for (int nActionIndex = 0; nActionIndex < MCTS_ACTION_COUNT; nActionIndex++) {
+    MctsNode *pChildNode = &pMctsTree->pNodes[pMctsTree->nNodeCount + nActionIndex];
+
+    pChildNode->nFirstChildIndex = -1;
+    pChildNode->nVisitCount = 0;
+    pChildNode->nRewardSum = 0;
+    pChildNode->nValue = 0;
+  }
+
+  pMctsTree->nNodeCount += MCTS_ACTION_COUNT;
+
+  return 1;
+}
+
+/**
+ * Gets the action index of the passed action, assuming that it sells or buys as much cargo as possible.
+ * @param action The action.
+ * @returns The index of the action or `-1` if it has none.
+ */
+static int getMctsActionIndex(GameAction action) {
+  if (action.cActionId == SELL_ACTION_ID) {
+    return MCTS_SELL_ACTION_INDEX + getCargoIndex(action.cCargoId);
+  } else if (action.cActionId == BUY_ACTION_ID) {
+    return MCTS_BUY_ACTION_INDEX + getCargoIndex(action.cCargoId);
+  } else if (action.cActionId == UPGRADE_ACTION_ID) {
+    return MCTS_UPGRADE_ACTION_INDEX;
+  } else if (action.cActionId == NAVIGATE_ACTION_ID) {
+    return MCTS_NAVIGATE_ACTION_INDEX + getPortIndex(action.cPortId);
+  }
+
+  return -1;
+}
+
+/**
+ * Chooses the action of a rollout, which is the greedy policy's action unless it would undo a trade made this turn, in
+ * which case the turn ends where the greedy policy would sail.
+ * @param pGameState The game to choose an action for.
+ * @param nBoughtCargoMask The cargo bought this turn.
+ * @param nSoldCargoMask The cargo sold this turn.
+ * @returns A valid action.
+ */
+static GameAction chooseRolloutAction(const GameState *pGameState, int nBoughtCargoMask, int nSoldCargoMask) {
+  GameAction action = chooseGreedyAction(pGameState);
+  int nCargoMask = action.cActionId == BUY_ACTION_ID || action.cActionId == SELL_ACTION_ID
+                     ? 1 << getCargoIndex(action.cCargoId)
+                     : 0;
+
+  if ((action.cActionId == SELL_ACTION_ID && (nBoughtCargoMask & nCargoMask)) ||
+      (action.cActionId == BUY_ACTION_ID && (nSoldCargoMask & nCargoMask))) {
+    return chooseGreedyNavigation(pGameState);
+  }
+
+  return action;
+}
+
+/**
+ * Selects the child of the passed node to descend into among the actions that are valid in the passed game, using
+ * their upper confidence bound with rewards scaled by the range of rewards seen so far. The rollout policy's action is
+ * tried first, and every other unvisited child is valued as if it had been visited once at the node's own mean, so a
+ * child that beats the greedy line is exploited before every alternative has been tried.
+ * @param pMctsTree The tree that the node belongs to.
+ * @param nNodeIndex The index of the expanded node.
+ * @param pGameState The game that the node was reached in.
+ * @param nBoughtCargoMask The cargo bought this turn.
+ * @param nSoldCargoMask The cargo sold this turn.
+ * @param nExplorationConstant The weight of the exploration term.
+ * @param[out] pAction The action of the selected child.
+ * @returns The index of the selected child.
+ */
+static long selectMctsChild(const MctsTree *pMctsTree, long nNodeIndex, const GameState *pGameState,
+                            int nBoughtCargoMask, int nSoldCargoMask, double nExplorationConstant,
+                            GameAction *pAction) {
+  const MctsNode *pNode = &pMctsTree->pNodes[nNodeIndex];
+  double nRewardRange = pMctsTree->nMaximumReward - pMctsTree->nMinimumReward;
+  double nLogVisitCount = log((double)pNode->nVisitCount + 1);
+  long nSelectedChildIndex = -1;
+  double nSelectedScore = -HUGE_VAL;
+
+  if (nRewardRange <= 0) nRewardRange = 1;
+
+  double nUnvisitedScore = pNode->nVisitCount == 0 ? HUGE_VAL
+                                                    : (pNode->nValue - pMctsTree->nMinimumReward) / nRewardRange +
+                                                        nExplorationConstant * sqrt(nLogVisitCount);
+  int nGreedyActionIndex =
+    getMctsActionIndex(chooseRolloutAction(pGameState, nBoughtCargoMask, nSoldCargoMask));
+
+  for (int nActionIndex = 0; nActionIndex < MCTS_ACTION_COUNT; nActionIndex++) {
+    long nChildIndex = pNode->nFirstChildIndex + nActionIndex;
+    const MctsNode *pChildNode = &pMctsTree->pNodes[nChildIndex];
+    GameAction action;
+
+    if (!getMctsAction(pGameState, nActionIndex, nBoughtCargoMask, nSoldCargoMask, &action)) continue;
+
+    if (pChildNode->nVisitCount == 0 && nActionIndex == nGreedyActionIndex) {
+      *pAction = action;
+
+      return nChildIndex;
+    }
+
+    double nScore = pChildNode->nVisitCount == 0
+                      ? nUnvisitedScore
+                      : (pChildNode->nValue - pMctsTree->nMinimumReward) / nRewardRange +
+                          nExplorationConstant * sqrt(nLogVisitCount / pChildNode->nVisitCount);
+
+    if (nScore > nSelectedScore) {
+      nSelectedChildIndex = nChildIndex;
+      nSelectedScore = nScore;
+      *pAction = action;
+    }
+  }
+
+  return nSelectedChildIndex;
+}
+
+/**
+ * Plays a single iteration of the search, which descends the tree from a copy of the root game, expands the first
+ * unvisited node it reaches, plays the rest of the game with the greedy policy unless the transposition table already
+ * knows the value of the node's state, and adds the final balance to every node on the way.
+ * @param[in,out] pMctsTree The tree to grow.
+ * @param[in,out] pMctsSearch The search that the tree belongs to, whose transposition table stores every node's value.
+ * @param pRootGameState The game at the root of the tree.
+ */
+static void runMctsIteration(MctsTree *pMctsTree, MctsSearch *pMctsSearch, const GameState *pRootGameState) {
+  // The game state has no pointers, so a plain copy is a complete clone that the rollout can freely advance.
+  GameState gameState = *pRootGameState;
+  int nBoughtCargoMask = pMctsSearch->nBoughtCargoMask;
+  int nSoldCargoMask = pMctsSearch->nSoldCargoMask;
+  long nPathNodeIndices[MCTS_MAXIMUM_DEPTH];
+  uint64_t nPathHashes[MCTS_MAXIMUM_DEPTH];
+  int nPathLength = 1;
+  long nNodeIndex = 0;
+
+  seedRandomGenerator(&gameState.randomGenerator, pMctsTree->nWorldSeed + pMctsTree->nRolloutCount);
+
+  nPathNodeIndices[0] = 0;
+  nPathHashes[0] = hashMctsState(&gameState, nBoughtCargoMask, nSoldCargoMask);
+
+  // The tree only covers the current turn, whose actions have no chance, so every later turn is left to the rollout.
+  while (!isGameOver(&gameState) && nPathLength < MCTS_MAXIMUM_DEPTH) {
+    if (pMctsTree->pNodes[nNodeIndex].nFirstChildIndex < 0 && !expandMctsNode(pMctsTree, nNodeIndex)) break;
+
+    GameAction action;
+
+    nNodeIndex = selectMctsChild(pMctsTree, nNodeIndex, &gameState, nBoughtCargoMask, nSoldCargoMask,
+                                 pMctsSearch->nExplorationConstant, &action);
+    nPathNodeIndices[nPathLength++] = nNodeIndex;
+
+    // The n-th visit of every sibling plays out the same future, so siblings are compared on equal footing.
+    seedRandomGenerator(&gameState.randomGenerator, pMctsTree->nWorldSeed + pMctsTree->pNodes[nNodeIndex].nVisitCount);
+
+    stepGame(&gameState, action);
+    recordTradedCargo(action, &nBoughtCargoMask, &nSoldCargoMask);
+
+    // Sailing draws the next turn's prices, so a node after it stands for many states and has no hash, marked as `0`.
+    nPathHashes[nPathLength - 1] =
+      action.cActionId == NAVIGATE_ACTION_ID ? 0 : hashMctsState(&gameState, nBoughtCargoMask, nSoldCargoMask);
+
+    if (pMctsTree->pNodes[nNodeIndex].nVisitCount == 0 || action.cActionId == NAVIGATE_ACTION_ID) break;
+  }
+
+  TranspositionEntry transpositionEntry;
+  double nReward;
+
+  if (nPathHashes[nPathLength - 1] != 0 && pMctsTree->pNodes[nNodeIndex].nVisitCount == 0 &&
+      probeTranspositionTable(&pMctsSearch->transpositionTable, nPathHashes[nPathLength - 1], &transpositionEntry) &&
+      transpositionEntry.nDepth >= MCTS_TRANSPOSITION_MINIMUM_VISITS) {
+    nReward = transpositionEntry.nValue;
+    pMctsTree->nTranspositionCount++;
+  } else {
+    while (!isGameOver(&gameState)) {
+      GameAction action = chooseRolloutAction(&gameState, nBoughtCargoMask, nSoldCargoMask);
+
+      stepGame(&gameState, action);
+      recordTradedCargo(action, &nBoughtCargoMask, &nSoldCargoMask);
+    }
+
+    nReward = gameState.nPlayerBalance;
+  }
+
+  if (pMctsTree->nRolloutCount == 0 || nReward < pMctsTree->nMinimumReward) pMctsTree->nMinimumReward = nReward;
+  if (pMctsTree->nRolloutCount == 0 || nReward > pMctsTree->nMaximumReward) pMctsTree->nMaximumReward = nReward;
+
+  // Within a turn the player picks the next action, so an expanded node is worth as much as its best child.
+  for (int nPathIndex = nPathLength - 1; nPathIndex >= 0; nPathIndex--) {
+    MctsNode *pNode = &pMctsTree->pNodes[nPathNodeIndices[nPathIndex]];
+
+    pNode->nVisitCount++;
+    pNode->nRewardSum += nReward;
+    pNode->nValue = pNode->nRewardSum / pNode->nVisitCount;
+
+    if (pNode->nFirstChildIndex >= 0) {
+      pNode->nValue = -HUGE_VAL;
+
+      for (int nActionIndex = 0; nActionIndex < MCTS_ACTION_COUNT; nActionIndex++) {
+        const MctsNode *pChildNode = &pMctsTree->pNodes[pNode->nFirstChildIndex + nActionIndex];
+
+        if (pChildNode->nVisitCount > 0 && pChildNode->nValue > pNode->nValue) pNode->nValue = pChildNode->nValue;
+      }
+    }
+
+    if (nPathHashes[nPathIndex] == 0) continue;
+
+    // The visit count stands in for the depth, so a better-visited entry of the same state is never overwritten.
+    transpositionEntry.nValue = (float)pNode->nValue;
+    transpositionEntry.nDepth = pNode->nVisitCount < UINT16_MAX ? (uint16_t)pNode->nVisitCount : UINT16_MAX;
+    transpositionEntry.nActionIndex = 0;
+    storeTranspositionEntry(&pMctsSearch->transpositionTable, nPathHashes[nPathIndex], transpositionEntry);
+  }
+
+  pMctsTree->nRolloutCount++;
+}
+
+/**
+ * Grows the tree of a single worker from an empty root until the decision's time or rollout budget runs out.
+ * @param pContext The decision.
+ * @param nTaskIndex The index of the worker's tree.
+ * @param nWorkerIndex The index of the worker running the task.
+ */
+static void runMctsWorker(void *pContext, long nTaskIndex, int nWorkerIndex) {
+  MctsDecision *pMctsDecision = pContext;
+  MctsSearch *pMctsSearch = pMctsDecision->pMctsSearch;
+  MctsTree *pMctsTree = &pMctsSearch->pWorkerTrees[nTaskIndex];
+
+  (void)nWorkerIndex;
+
+  resetMctsTree(pMctsTree);
+
+  do {
+    runMctsIteration(pMctsTree, pMctsSearch, pMctsDecision->pRootGameState);
+  } while ((pMctsSearch->nRolloutBudget == 0 || pMctsTree->nRolloutCount < pMctsSearch->nRolloutBudget) &&
+           !hasDeadlinePassed(pMctsDecision->nDeadlineNanoseconds));
+}
+
+/**
+ * Allocates a search, the trees of its workers, and their transposition table.
+ * @param[out] pMctsSearch The search to allocate.
+ * @param nWorkerCount The number of worker threads, each of which grows its own tree.
+ * @param nTimeBudgetMilliseconds The time spent on each decision.
+ * @param nRolloutBudget The maximum number of rollouts that each worker plays per decision, or `0` for no limit.
+ * @param nSeed The seed of the workers' random number generators.
+ * @returns `0` if the search was allocated or `-1` if it could not be.
+ */
+int createMctsSearch(MctsSearch *pMctsSearch, int nWorkerCount, int nTimeBudgetMilliseconds, long nRolloutBudget,
+                     uint64_t nSeed) {
+  pMctsSearch->nWorkerCount = nWorkerCount;
+  pMctsSearch->nTimeBudgetMilliseconds = nTimeBudgetMilliseconds;
+  pMctsSearch->nRolloutBudget = nRolloutBudget;
+  pMctsSearch->nExplorationConstant = MCTS_DEFAULT_EXPLORATION_CONSTANT;
+  pMctsSearch->nRolloutCount = 0;
+  pMctsSearch->nTranspositionCount = 0;
+  pMctsSearch->nSearchSeconds = 0;
+  pMctsSearch->nTradeTurn = -1;
+  pMctsSearch->nBoughtCargoMask = 0;
+  pMctsSearch->nSoldCargoMask = 0;
+  pMctsSearch->pWorkerTrees = calloc(nWorkerCount, sizeof(MctsTree));
+
+  if (pMctsSearch->pWorkerTrees == NULL) return -1;
+
+  if (createTranspositionTable(&pMctsSearch->transpositionTable, MCTS_TRANSPOSITION_ENTRY_COUNT) != 0) {
+    free(pMctsSearch->pWorkerTrees);
+    pMctsSearch->pWorkerTrees = NULL;
+
+    return -1;
+  }
+
+  for (int nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+    MctsTree *pMctsTree = &pMctsSearch->pWorkerTrees[nWorkerIndex];
+
+    pMctsTree->pNodes = malloc(sizeof(MctsNode) * MCTS_INITIAL_NODE_CAPACITY);
+    pMctsTree->nNodeCapacity = MCTS_INITIAL_NODE_CAPACITY;
+
+    if (pMctsTree->pNodes == NULL) {
+      destroyMctsSearch(pMctsSearch);
+
+      return -1;
+    }
+
+    seedRandomGenerator(&pMctsTree->randomGenerator, nSeed + nWorkerIndex);
+  }
+
+  return 0;
+}
+
+/**
+ * Frees the trees and the transposition table of the passed search.
+ * @param[in,out] pMctsSearch The search to free.
+ */
+void destroyMctsSearch(MctsSearch *pMctsSearch) {
+  if (pMctsSearch->pWorkerTrees != NULL) {
+    for (int nWorkerIndex = 0; nWorkerIndex < pMctsSearch->nWorkerCount; nWorkerIndex++) {
+      free(pMctsSearch->pWorkerTrees[nWorkerIndex].pNodes);
+    }
+  }
+
+  free(pMctsSearch->pWorkerTrees);
+  destroyTranspositionTable(&pMctsSearch->transpositionTable);
+
+  pMctsSearch->pWorkerTrees = NULL;
+}
+
+/**
+ * Gets the action with the passed action index in the passed game.
+ * @param pGameState The game to get the action for.
+ * @param nActionIndex The index of the action.
+ * @param nBoughtCargoMask The cargo bought this turn, where bit `i` belongs to the cargo with cargo index `i`.
+ * @param nSoldCargoMask The cargo sold this turn, where bit `i` belongs to the cargo with cargo index `i`.
+ * @param[out] pAction The action.
+ * @pre @p nActionIndex must have an integer value within the range of `0` and the number of action indices minus one.
+ * @returns `1` if the action is valid and allowed by the search or `0` if it is not.
+ */
+int getMctsAction(const GameState *pGameState, int nActionIndex, int nBoughtCargoMask, int nSoldCargoMask,
+                  GameAction *pAction) {
+  GameAction action = {0};
+
+  if (nActionIndex < MCTS_BUY_ACTION_INDEX) {
+    int nCargoIndex = nActionIndex - MCTS_SELL_ACTION_INDEX;
+
+    action.cActionId = SELL_ACTION_ID;
+    action.cCargoId = CARGO_IDS[nCargoIndex];
+    action.nCargoAmount = nBoughtCargoMask & 1 << nCargoIndex ? 0 : getShipCargoAmount(pGameState, action.cCargoId);
+  } else if (nActionIndex < MCTS_UPGRADE_ACTION_INDEX) {
+    int nCargoIndex = nActionIndex - MCTS_BUY_ACTION_INDEX;
+    int nShipFreeCargoSpace = pGameState->nShipCargoLimit - getShipTotalCargoAmount(pGameState);
+
+    action.cActionId = BUY_ACTION_ID;
+    action.cCargoId = CARGO_IDS[nCargoIndex];
+    action.nCargoAmount = pGameState->nPlayerBalance / getCargoMarketPrice(pGameState, action.cCargoId);
+
+    if (action.nCargoAmount > nShipFreeCargoSpace) action.nCargoAmount = nShipFreeCargoSpace;
+    if (nSoldCargoMask & 1 << nCargoIndex) action.nCargoAmount = 0;
+  } else if (nActionIndex == MCTS_UPGRADE_ACTION_INDEX) {
+    action.cActionId = UPGRADE_ACTION_ID;
+  } else {
+    action.cActionId = NAVIGATE_ACTION_ID;
+    action.cPortId = PORT_IDS[nActionIndex - MCTS_NAVIGATE_ACTION_INDEX];
+  }
+
+  *pAction = action;
+
+  return isGameActionValid(pGameState, action);
+}
+
+/**
+ * Chooses an action by searching until the time or rollout budget runs out. Every rollout plays a copy of the game to
+ * the end with the greedy policy, after replacing the copy's random number generator so that the search never sees
+ * the game's real future.
+ * @param[in,out] pMctsSearch The search to use, whose rollout count, transposition count, and search time are
+ * increased.
+ * @param pGameState The game to choose an action for.
+ * @returns A valid action.
+ */
+GameAction chooseMctsAction(MctsSearch *pMctsSearch, const GameState *pGameState) {
+  MctsDecision mctsDecision;
+  uint64_t nStartNanoseconds = getMonotonicNanoseconds();
+
+  if (pGameState->nPlayerTurns != pMctsSearch->nTradeTurn) {
+    pMctsSearch->nTradeTurn = pGameState->nPlayerTurns;
+    pMctsSearch->nBoughtCargoMask = 0;
+    pMctsSearch->nSoldCargoMask = 0;
+  }
+
+  // Entries of earlier decisions stay valid, since a state's value does not depend on how it was reached.
+  advanceTranspositionGeneration(&pMctsSearch->transpositionTable);
+
+  mctsDecision.pMctsSearch = pMctsSearch;
+  mctsDecision.pRootGameState = pGameState;
+  mctsDecision.nDeadlineNanoseconds = nStartNanoseconds + (uint64_t)pMctsSearch->nTimeBudgetMilliseconds * 1000000u;
+
+  if (runThreadPoolTasks(pMctsSearch->nWorkerCount, pMctsSearch->nWorkerCount, runMctsWorker, &mctsDecision) != 0) {
+    return chooseGreedyAction(pGameState);
+  }
+
+  pMctsSearch->nSearchSeconds += (getMonotonicNanoseconds() - nStartNanoseconds) / 1e9;
+
+  // Root parallelism: every tree votes with the visit counts of its root's children.
+  long nActionVisitCounts[MCTS_ACTION_COUNT] = {0};
+
+  for (int nWorkerIndex = 0; nWorkerIndex < pMctsSearch->nWorkerCount; nWorkerIndex++) {
+    const MctsTree *pMctsTree = &pMctsSearch->pWorkerTrees[nWorkerIndex];
+    long nFirstChildIndex = pMctsTree->pNodes[0].nFirstChildIndex;
+
+    pMctsSearch->nRolloutCount += pMctsTree->nRolloutCount;
+    pMctsSearch->nTranspositionCount += pMctsTree->nTranspositionCount;
+
+    if (nFirstChildIndex < 0) continue;
+
+    for (int nActionIndex = 0; nActionIndex < MCTS_ACTION_COUNT; nActionIndex++) {
+      nActionVisitCounts[nActionIndex] += pMctsTree->pNodes[nFirstChildIndex + nActionIndex].nVisitCount;
+    }
+  }
+
+  GameAction action = chooseGreedyAction(pGameState);
+  long nBestVisitCount = 0;
+
+  for (int nActionIndex = 0; nActionIndex < MCTS_ACTION_COUNT; nActionIndex++) {
+    GameAction candidateAction;
+
+    if (nActionVisitCounts[nActionIndex] > nBestVisitCount &&
+        getMctsAction(pGameState, nActionIndex, pMctsSearch->nBoughtCargoMask, pMctsSearch->nSoldCargoMask,
+                      &candidateAction)) {
+      nBestVisitCount = nActionVisitCounts[nActionIndex];
+      action = candidateAction;
+    }
+  }
+
+  recordTradedCargo(action, &pMctsSearch->nBoughtCargoMask, &pMctsSearch->nSoldCargoMask);
+
+  return action;
+}
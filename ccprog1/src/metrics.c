@@ -0,0 +1,437 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "metrics.h"
+
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "trading.h"
+
+/**
+ * Every counter and histogram of the process. They are updated with relaxed atomics, so threads may record into them
+ * at the same time, although only the game currently does.
+ */
+typedef struct {
+  int bIsRecording;
+  uint64_t nCounters[METRICS_COUNTER_COUNT];
+  uint64_t nTradeCounts[PORT_COUNT][CARGO_COUNT];
+  MetricsHistogram histograms[METRICS_HISTOGRAM_COUNT];
+  const char *strDumpFilePath;
+  char cDumpFormatId;
+} MetricsRegistry;
+
+static MetricsRegistry metricsRegistry = {0};
+static volatile sig_atomic_t bIsMetricsDumpRequested = 0;
+
+static const char *const strMetricsCounterNames[METRICS_COUNTER_COUNT] = {
+  "turns", "buys", "sells", "upgrades", "departures", "postponed_departures", "storms", "frames", "emitted_bytes",
+};
+static const char *const strMetricsHistogramNames[METRICS_HISTOGRAM_COUNT] = {"render_ns", "input_wait_ns"};
+static const char *const strMetricsPortNames[PORT_COUNT] = {"tondo", "manila", "pandakan", "sapa"};
+static const char *const strMetricsCargoNames[CARGO_COUNT] = {"coconut", "rice", "silk", "gun"};
+
+/**
+ * Enables or disables recording metrics, which is disabled by default so that simulations pay nothing for them.
+ * @param bIsEnabled Whether or not to record metrics.
+ */
+void setMetricsRecording(int bIsEnabled) {
+  metricsRegistry.bIsRecording = bIsEnabled;
+
+  for (int nHistogramIndex = 0; nHistogramIndex < METRICS_HISTOGRAM_COUNT; nHistogramIndex++) {
+    if (metricsRegistry.histograms[nHistogramIndex].nCount == 0) {
+      metricsRegistry.histograms[nHistogramIndex].nMinimum = UINT64_MAX;
+    }
+  }
+}
+
+/**
+ * Checks whether metrics are being recorded, which callers use to skip measuring durations that would not be kept.
+ * @returns `1` if metrics are being recorded or `0` if they are not.
+ */
+int isMetricsRecording(void) { return metricsRegistry.bIsRecording; }
+
+/**
+ * Adds the passed amount to a counter if metrics are being recorded.
+ * @param nCounterId The ID of the counter.
+ * @param nAmount The amount to add.
+ */
+void addMetricsCounter(int nCounterId, uint64_t nAmount) {
+  if (!metricsRegistry.bIsRecording) return;
+
+  __atomic_fetch_add(&metricsRegistry.nCounters[nCounterId], nAmount, __ATOMIC_RELAXED);
+}
+
+/**
+ * Counts a trade at the passed port of the passed cargo if metrics are being recorded.
+ * @param cPortId The ID of the port.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cPortId must have a character value of `T`, `M`, `P`, or `S`.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
+ */
+void countMetricsTrade(char cPortId, char cCargoId) {
+  if (!metricsRegistry.bIsRecording) return;
+
+  __atomic_fetch_add(&metricsRegistry.nTradeCounts[getPortIndex(cPortId)][getCargoIndex(cCargoId)], 1,
+                     __ATOMIC_RELAXED);
+}
+
+/**
+ * Gets the index of the histogram bucket that holds the passed value.
+ * @param nValue The value.
+ * @returns The index of the bucket.
+ */
+static int getMetricsBucketIndex(uint64_t nValue) {
+  if (nValue < METRICS_HISTOGRAM_SUB_BUCKET_COUNT) return (int)nValue;
+
+  int nExponent = 63 - __builtin_clzll(nValue);
+  int nSubBucketIndex = (int)(nValue >> (nExponent - METRICS_HISTOGRAM_SUB_BUCKET_BITS)) &
+                        (METRICS_HISTOGRAM_SUB_BUCKET_COUNT - 1);
+
+  return (nExponent - METRICS_HISTOGRAM_SUB_BUCKET_BITS + 1) * METRICS_HISTOGRAM_SUB_BUCKET_COUNT + nSubBucketIndex;
+}
+
+/**
+ * Gets the highest value that falls within the passed histogram bucket.
+ * @param nBucketIndex The index of the bucket.
+ * @returns The highest value of the bucket.
+ */
+static uint64_t getMetricsBucketMaximum(int nBucketIndex) {
+  if (nBucketIndex < METRICS_HISTOGRAM_SUB_BUCKET_COUNT) return (uint64_t)nBucketIndex;
+
+  int nShift = nBucketIndex / METRICS_HISTOGRAM_SUB_BUCKET_COUNT - 1;
+  uint64_t nSubBucketValue = METRICS_HISTOGRAM_SUB_BUCKET_COUNT + nBucketIndex % METRICS_HISTOGRAM_SUB_BUCKET_COUNT;
+
+  return ((nSubBucketValue + 1) << nShift) - 1;
+}
+
+/**
+ * Records a value in a histogram if metrics are being recorded.
+ * @param nHistogramId The ID of the histogram.
+ * @param nValue The value to record, in nanoseconds.
+ */
+void recordMetricsHistogram(int nHistogramId, uint64_t nValue) {
+  if (!metricsRegistry.bIsRecording) return;
+
+  MetricsHistogram *pHistogram = &metricsRegistry.histograms[nHistogramId];
+  uint64_t nBound = __atomic_load_n(&pHistogram->nMinimum, __ATOMIC_RELAXED);
+
+  __atomic_fetch_add(&pHistogram->nBucketCounts[getMetricsBucketIndex(nValue)], 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&pHistogram->nCount, 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&pHistogram->nSum, nValue, __ATOMIC_RELAXED);
+
+  while (nValue < nBound && !__atomic_compare_exchange_n(&pHistogram->nMinimum, &nBound, nValue, 1, __ATOMIC_RELAXED,
+                                                         __ATOMIC_RELAXED)) {
+  }
+
+  nBound = __atomic_load_n(&pHistogram->nMaximum, __ATOMIC_RELAXED);
+
+  while (nValue > nBound && !__atomic_compare_exchange_n(&pHistogram->nMaximum, &nBound, nValue, 1, __ATOMIC_RELAXED,
+                                                         __ATOMIC_RELAXED)) {
+  }
+}
+
+/**
+ * Gets the value of a counter.
+ * @param nCounterId The ID of the counter.
+ * @returns The value of the counter.
+ */
+uint64_t getMetricsCounter(int nCounterId) {
+  return __atomic_load_n(&metricsRegistry.nCounters[nCounterId], __ATOMIC_RELAXED);
+}
+
+/**
+ * Gets the value below which the passed percentage of a histogram's values fall.
+ * @param pHistogram The histogram.
+ * @param nPercentile The percentage of values, from `0` to `100`.
+ * @returns The highest value of the bucket that holds the percentile, or `0` if the histogram is empty.
+ */
+static uint64_t getHistogramPercentile(const MetricsHistogram *pHistogram, double nPercentile) {
+  uint64_t nCount = __atomic_load_n(&pHistogram->nCount, __ATOMIC_RELAXED);
+
+  if (nCount == 0) return 0;
+
+  uint64_t nRank = (uint64_t)(nPercentile / 100 * nCount + 0.5);
+  uint64_t nSeenCount = 0;
+
+  if (nRank < 1) nRank = 1;
+
+  for (int nBucketIndex = 0; nBucketIndex < METRICS_HISTOGRAM_BUCKET_COUNT; nBucketIndex++) {
+    nSeenCount += __atomic_load_n(&pHistogram->nBucketCounts[nBucketIndex], __ATOMIC_RELAXED);
+
+    if (nSeenCount >= nRank) {
+      uint64_t nBucketMaximum = getMetricsBucketMaximum(nBucketIndex);
+
+      return nBucketMaximum < pHistogram->nMaximum ? nBucketMaximum : pHistogram->nMaximum;
+    }
+  }
+
+  return pHistogram->nMaximum;
+}
+
+/**
+ * Gets the value below which the passed percentage of a histogram's values fall.
+ * @param nHistogramId The ID of the histogram.
+ * @param nPercentile The percentage of values, from `0` to `100`.
+ * @returns The highest value of the bucket that holds the percentile, or `0` if the histogram is empty.
+ */
+uint64_t getMetricsHistogramPercentile(int nHistogramId, double nPercentile) {
+  return getHistogramPercentile(&metricsRegistry.histograms[nHistogramId], nPercentile);
+}
+
+/**
+ * Copies every counter and histogram of this process.
+ * @param[out] pMetricsSnapshot The copy.
+ */
+void copyMetrics(MetricsSnapshot *pMetricsSnapshot) {
+  for (int nCounterIndex = 0; nCounterIndex < METRICS_COUNTER_COUNT; nCounterIndex++) {
+    pMetricsSnapshot->nCounters[nCounterIndex] = getMetricsCounter(nCounterIndex);
+  }
+
+  for (int nPortIndex = 0; nPortIndex < PORT_COUNT; nPortIndex++) {
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      pMetricsSnapshot->nTradeCounts[nPortIndex][nCargoIndex] =
+        __atomic_load_n(&metricsRegistry.nTradeCounts[nPortIndex][nCargoIndex], __ATOMIC_RELAXED);
+    }
+  }
+
+  for (int nHistogramIndex = 0; nHistogramIndex < METRICS_HISTOGRAM_COUNT; nHistogramIndex++) {
+    const MetricsHistogram *pHistogram = &metricsRegistry.histograms[nHistogramIndex];
+    MetricsHistogram *pHistogramCopy = &pMetricsSnapshot->histograms[nHistogramIndex];
+
+    for (int nBucketIndex = 0; nBucketIndex < METRICS_HISTOGRAM_BUCKET_COUNT; nBucketIndex++) {
+      pHistogramCopy->nBucketCounts[nBucketIndex] =
+        __atomic_load_n(&pHistogram->nBucketCounts[nBucketIndex], __ATOMIC_RELAXED);
+    }
+
+    pHistogramCopy->nCount = __atomic_load_n(&pHistogram->nCount, __ATOMIC_RELAXED);
+    pHistogramCopy->nSum = __atomic_load_n(&pHistogram->nSum, __ATOMIC_RELAXED);
+    pHistogramCopy->nMinimum = __atomic_load_n(&pHistogram->nMinimum, __ATOMIC_RELAXED);
+    pHistogramCopy->nMaximum = __atomic_load_n(&pHistogram->nMaximum, __ATOMIC_RELAXED);
+  }
+}
+
+/**
+ * Adds the counters and histograms of a copy to those of another, which an empty copy that is all zeroes can start as.
+ * @param[in,out] pTotalSnapshot The copy to add to.
+ * @param pMetricsSnapshot The copy to add.
+ */
+void addMetricsSnapshot(MetricsSnapshot *pTotalSnapshot, const MetricsSnapshot *pMetricsSnapshot) {
+  for (int nCounterIndex = 0; nCounterIndex < METRICS_COUNTER_COUNT; nCounterIndex++) {
+    pTotalSnapshot->nCounters[nCounterIndex] += pMetricsSnapshot->nCounters[nCounterIndex];
+  }
+
+  for (int nPortIndex = 0; nPortIndex < PORT_COUNT; nPortIndex++) {
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      pTotalSnapshot->nTradeCounts[nPortIndex][nCargoIndex] += pMetricsSnapshot->nTradeCounts[nPortIndex][nCargoIndex];
+    }
+  }
+
+  for (int nHistogramIndex = 0; nHistogramIndex < METRICS_HISTOGRAM_COUNT; nHistogramIndex++) {
+    MetricsHistogram *pTotalHistogram = &pTotalSnapshot->histograms[nHistogramIndex];
+    const MetricsHistogram *pHistogram = &pMetricsSnapshot->histograms[nHistogramIndex];
+
+    // An empty histogram has no minimum to add, as a blank copy holds zero there and a registry the largest value.
+    if (pHistogram->nCount == 0) continue;
+
+    for (int nBucketIndex = 0; nBucketIndex < METRICS_HISTOGRAM_BUCKET_COUNT; nBucketIndex++) {
+      pTotalHistogram->nBucketCounts[nBucketIndex] += pHistogram->nBucketCounts[nBucketIndex];
+    }
+
+    if (pTotalHistogram->nCount == 0 || pHistogram->nMinimum < pTotalHistogram->nMinimum) {
+      pTotalHistogram->nMinimum = pHistogram->nMinimum;
+    }
+
+    if (pHistogram->nMaximum > pTotalHistogram->nMaximum) pTotalHistogram->nMaximum = pHistogram->nMaximum;
+
+    pTotalHistogram->nCount += pHistogram->nCount;
+    pTotalHistogram->nSum += pHistogram->nSum;
+  }
+}
+
+/**
+ * Writes every counter and histogram of a copy to the passed file.
+ * @param pFile The file to write to.
+ * @param pMetricsSnapshot The copy to write.
+ * @param cFormatId The ID of the format, which is either `TEXT_METRICS_FORMAT_ID` or `JSON_METRICS_FORMAT_ID`.
+ */
+void writeMetricsSnapshot(FILE *pFile, const MetricsSnapshot *pMetricsSnapshot, char cFormatId) {
+  static const double nPercentiles[] = {50, 90, 99, 99.9};
+  static const char *const strPercentileNames[] = {"p50", "p90", "p99", "p999"};
+  int bIsJson = cFormatId == JSON_METRICS_FORMAT_ID;
+
+  fputs(bIsJson ? "{\"counters\":{" : "Counters:\n", pFile);
+
+  for (int nCounterIndex = 0; nCounterIndex < METRICS_COUNTER_COUNT; nCounterIndex++) {
+    unsigned long long nValue = pMetricsSnapshot->nCounters[nCounterIndex];
+
+    if (bIsJson) {
+      fprintf(pFile, "%s\"%s\":%llu", nCounterIndex > 0 ? "," : "", strMetricsCounterNames[nCounterIndex], nValue);
+    } else {
+      fprintf(pFile, "  %-24s %12llu\n", strMetricsCounterNames[nCounterIndex], nValue);
+    }
+  }
+
+  fputs(bIsJson ? "},\"trades\":{" : "Trades by port and cargo:\n", pFile);
+
+  if (!bIsJson) {
+    fprintf(pFile, "  %-10s", "");
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      fprintf(pFile, " %10s", strMetricsCargoNames[nCargoIndex]);
+    }
+
+    fputc('\n', pFile);
+  }
+
+  for (int nPortIndex = 0; nPortIndex < PORT_COUNT; nPortIndex++) {
+    if (bIsJson) {
+      fprintf(pFile, "%s\"%s\":{", nPortIndex > 0 ? "," : "", strMetricsPortNames[nPortIndex]);
+    } else {
+      fprintf(pFile, "  %-10s", strMetricsPortNames[nPortIndex]);
+    }
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      unsigned long long nValue = pMetricsSnapshot->nTradeCounts[nPortIndex][nCargoIndex];
+
+      if (bIsJson) {
+        fprintf(pFile, "%s\"%s\":%llu", nCargoIndex > 0 ? "," : "", strMetricsCargoNames[nCargoIndex], nValue);
+      } else {
+        fprintf(pFile, " %10llu", nValue);
+      }
+    }
+
+    fputs(bIsJson ? "}" : "\n", pFile);
+  }
+
+  fputs(bIsJson ? "},\"histograms\":{" : "Histograms:\n", pFile);
+
+  for (int nHistogramIndex = 0; nHistogramIndex < METRICS_HISTOGRAM_COUNT; nHistogramIndex++) {
+    const MetricsHistogram *pHistogram = &pMetricsSnapshot->histograms[nHistogramIndex];
+    unsigned long long nCount = pHistogram->nCount;
+    unsigned long long nMinimum = nCount > 0 ? pHistogram->nMinimum : 0;
+    double nMean = nCount > 0 ? (double)pHistogram->nSum / nCount : 0.0;
+
+    if (bIsJson) {
+      fprintf(pFile, "%s\"%s\":{\"count\":%llu,\"min\":%llu,\"mean\":%.1f", nHistogramIndex > 0 ? "," : "",
+              strMetricsHistogramNames[nHistogramIndex], nCount, nMinimum, nMean);
+    } else {
+      fprintf(pFile, "  %-16s count %llu | min %llu | mean %.1f", strMetricsHistogramNames[nHistogramIndex], nCount,
+              nMinimum, nMean);
+    }
+
+    for (size_t nPercentileIndex = 0; nPercentileIndex < sizeof(nPercentiles) / sizeof(nPercentiles[0]);
+         nPercentileIndex++) {
+      unsigned long long nValue = getHistogramPercentile(pHistogram, nPercentiles[nPercentileIndex]);
+
+      fprintf(pFile, bIsJson ? ",\"%s\":%llu" : " | %s %llu", strPercentileNames[nPercentileIndex], nValue);
+    }
+
+    fprintf(pFile, bIsJson ? ",\"max\":%llu}" : " | max %llu\n", (unsigned long long)pHistogram->nMaximum);
+  }
+
+  if (bIsJson) fputs("}}\n", pFile);
+}
+
+/**
+ * Writes every counter and histogram to the passed file.
+ * @param pFile The file to write to.
+ * @param cFormatId The ID of the format, which is either `TEXT_METRICS_FORMAT_ID` or `JSON_METRICS_FORMAT_ID`.
+ */
+void writeMetrics(FILE *pFile, char cFormatId) {
+  static MetricsSnapshot metricsSnapshot;
+
+  copyMetrics(&metricsSnapshot);
+  writeMetricsSnapshot(pFile, &metricsSnapshot, cFormatId);
+}
+
+/**
+ * Sets where `dumpMetrics` writes the metrics to.
+ * @param strFilePath The path of the file to overwrite on every dump, or `-` for the standard error stream.
+ * @param cFormatId The ID of the format, which is either `TEXT_METRICS_FORMAT_ID` or `JSON_METRICS_FORMAT_ID`.
+ */
+void setMetricsDump(const char *strFilePath, char cFormatId) {
+  metricsRegistry.strDumpFilePath = strFilePath;
+  metricsRegistry.cDumpFormatId = cFormatId;
+}
+
+/** Writes the metrics to the place set by `setMetricsDump`, if any, which can be registered with `atexit`. */
+void dumpMetrics(void) {
+  if (metricsRegistry.strDumpFilePath == NULL) return;
+
+  if (strcmp(metricsRegistry.strDumpFilePath, "-") == 0) {
+    writeMetrics(stderr, metricsRegistry.cDumpFormatId);
+
+    return;
+  }
+
+  FILE *pFile = fopen(metricsRegistry.strDumpFilePath, "w");
+
+  if (pFile == NULL) {
+    fprintf(stderr, "Could not write the metrics to %s.\n", metricsRegistry.strDumpFilePath);
+
+    return;
+  }
+
+  writeMetrics(pFile, metricsRegistry.cDumpFormatId);
+  fclose(pFile);
+}
+
+#ifndef _WIN32
+/**
+ * Requests a dump of the metrics, which only sets a flag since writing files is not safe within a signal handler.
+ * @param nSignalNumber The number of the signal that was received.
+ */
+static void requestMetricsDump(int nSignalNumber) {
+  (void)nSignalNumber;
+
+  bIsMetricsDumpRequested = 1;
+}
+#endif
+
+/**
+ * Makes `SIGUSR1` request a dump of the metrics, which is carried out by the next call to `dumpRequestedMetrics`. The
+ * signal interrupts a blocked read instead of restarting it, so that a game waiting for input still dumps its metrics.
+ * @returns `0` if the signal handler was installed or `-1` if the platform has no such signal.
+ */
+int installMetricsDumpSignal(void) {
+#ifdef _WIN32
+  return -1;
+#else
+  struct sigaction signalAction;
+
+  memset(&signalAction, 0, sizeof(signalAction));
+  signalAction.sa_handler = requestMetricsDump;
+  sigemptyset(&signalAction.sa_mask);
+
+  return sigaction(SIGUSR1, &signalAction, NULL) == 0 ? 0 : -1;
+#endif
+}
+
+/** Dumps the metrics if a dump was requested by a signal since the last dump. */
+void dumpRequestedMetrics(void) {
+  if (!bIsMetricsDumpRequested) return;
+
+  bIsMetricsDumpRequested = 0;
+
+  dumpMetrics();
+}
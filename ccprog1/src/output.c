@@ -0,0 +1,320 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "output.h"
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "metrics.h"
+
+static OutputSink ttyOutputSink = {TTY_OUTPUT_SINK_ID, NULL, NULL, 0, 0};
+static OutputSink *pCurrentOutputSink = &ttyOutputSink;
+static long nConsoleWriteCount = 0;
+static int bIsFlushingAtExit = 0;
+
+/**
+ * Makes room for the passed number of bytes at the end of the buffer of a memory sink.
+ * @param[in,out] pOutputSink The memory sink to grow.
+ * @param nByteCount The number of bytes to make room for.
+ * @returns `0` if the bytes fit in the buffer or `-1` if the buffer could not grow.
+ */
+static int reserveOutputSinkCapacity(OutputSink *pOutputSink, size_t nByteCount) {
+  if (pOutputSink->nLength + nByteCount <= pOutputSink->nCapacity) return 0;
+
+  size_t nNewCapacity = pOutputSink->nCapacity > 0 ? pOutputSink->nCapacity : OUTPUT_SINK_INITIAL_CAPACITY;
+
+  while (nNewCapacity < pOutputSink->nLength + nByteCount) nNewCapacity *= 2;
+
+  char *pNewBuffer = realloc(pOutputSink->pBuffer, nNewCapacity);
+
+  if (pNewBuffer == NULL) return -1;
+
+  pOutputSink->pBuffer = pNewBuffer;
+  pOutputSink->nCapacity = nNewCapacity;
+
+  return 0;
+}
+
+/**
+ * Writes the passed bytes to the standard output, bypassing its buffer.
+ * @param pBytes The bytes to write.
+ * @param nByteCount The number of bytes to write.
+ * @returns `0` if every byte was written or `-1` if the console could not be written to.
+ */
+static int writeToConsole(const char *pBytes, size_t nByteCount) {
+  size_t nWrittenByteCount = 0;
+
+  // Anything printed straight to the standard output before the bytes is still in its buffer and goes first.
+  fflush(stdout);
+
+  while (nWrittenByteCount < nByteCount) {
+#ifdef _WIN32
+    int nResult = _write(1, pBytes + nWrittenByteCount, (unsigned int)(nByteCount - nWrittenByteCount));
+#else
+    ssize_t nResult = write(STDOUT_FILENO, pBytes + nWrittenByteCount, nByteCount - nWrittenByteCount);
+#endif
+
+    nConsoleWriteCount++;
+
+    if (nResult < 0 && errno == EINTR) continue;
+
+    if (nResult <= 0) return -1;
+
+    nWrittenByteCount += (size_t)nResult;
+  }
+
+  return 0;
+}
+
+/**
+ * Writes out everything that a console sink has buffered with a single write, unless the console cuts it short.
+ * @param[in,out] pOutputSink The console sink to flush.
+ * @returns `0` if everything was written or `-1` if the console could not be written to.
+ */
+static int flushConsoleOutput(OutputSink *pOutputSink) {
+  if (pOutputSink->nLength == 0) return 0;
+
+  int nStatus = writeToConsole(pOutputSink->pBuffer, pOutputSink->nLength);
+
+  pOutputSink->nLength = 0;
+
+  return nStatus;
+}
+
+/** Writes out everything that the current console sink has buffered, which runs when the game exits for any reason. */
+static void flushConsoleOutputAtExit(void) {
+  if (pCurrentOutputSink->cSinkId == TTY_OUTPUT_SINK_ID) flushConsoleOutput(pCurrentOutputSink);
+}
+
+/**
+ * Makes room for the passed number of bytes at the end of the buffer of a console sink, writing out what it holds
+ * first once it has grown past `OUTPUT_CONSOLE_FLUSH_SIZE`, such as when a script plays many games without input.
+ * @param[in,out] pOutputSink The console sink to make room in.
+ * @param nByteCount The number of bytes to make room for.
+ * @returns `0` if the bytes fit in the buffer or `-1` if the buffer could not grow.
+ */
+static int reserveConsoleCapacity(OutputSink *pOutputSink, size_t nByteCount) {
+  if (!bIsFlushingAtExit) {
+    atexit(flushConsoleOutputAtExit);
+    bIsFlushingAtExit = 1;
+  }
+
+  if (pOutputSink->nLength + nByteCount > OUTPUT_CONSOLE_FLUSH_SIZE) flushConsoleOutput(pOutputSink);
+
+  return reserveOutputSinkCapacity(pOutputSink, nByteCount);
+}
+
+/**
+ * Sets up a sink that writes to the standard output.
+ * @param[out] pOutputSink The sink to set up.
+ */
+void openTtyOutputSink(OutputSink *pOutputSink) { *pOutputSink = ttyOutputSink; }
+
+/**
+ * Sets up a sink that captures everything written to it in memory.
+ * @param[out] pOutputSink The sink to set up.
+ * @returns `0` if the sink was opened or `-1` if its buffer could not be allocated.
+ */
+int openMemoryOutputSink(OutputSink *pOutputSink) {
+  pOutputSink->cSinkId = MEMORY_OUTPUT_SINK_ID;
+  pOutputSink->pFile = NULL;
+  pOutputSink->pBuffer = NULL;
+  pOutputSink->nLength = 0;
+  pOutputSink->nCapacity = 0;
+
+  return reserveOutputSinkCapacity(pOutputSink, OUTPUT_SINK_INITIAL_CAPACITY);
+}
+
+/**
+ * Sets up a sink that writes to the passed file, which is created or truncated.
+ * @param[out] pOutputSink The sink to set up.
+ * @param strFilePath The path of the file to write to.
+ * @returns `0` if the sink was opened or `-1` if the file could not be opened.
+ */
+int openFileOutputSink(OutputSink *pOutputSink, const char *strFilePath) {
+  pOutputSink->cSinkId = FILE_OUTPUT_SINK_ID;
+  pOutputSink->pFile = fopen(strFilePath, "wb");
+  pOutputSink->pBuffer = NULL;
+  pOutputSink->nLength = 0;
+  pOutputSink->nCapacity = 0;
+
+  return pOutputSink->pFile != NULL ? 0 : -1;
+}
+
+/**
+ * Sets up a sink that discards everything written to it.
+ * @param[out] pOutputSink The sink to set up.
+ */
+void openNullOutputSink(OutputSink *pOutputSink) {
+  pOutputSink->cSinkId = NULL_OUTPUT_SINK_ID;
+  pOutputSink->pFile = NULL;
+  pOutputSink->pBuffer = NULL;
+  pOutputSink->nLength = 0;
+  pOutputSink->nCapacity = 0;
+}
+
+/**
+ * Flushes and closes the file of a file sink, writes out what a console sink has buffered, or frees the buffer of a
+ * memory sink.
+ * @param[in,out] pOutputSink The sink to close.
+ */
+void closeOutputSink(OutputSink *pOutputSink) {
+  if (pOutputSink->cSinkId == FILE_OUTPUT_SINK_ID && pOutputSink->pFile != NULL) {
+    fclose(pOutputSink->pFile);
+  } else if (pOutputSink->cSinkId == TTY_OUTPUT_SINK_ID) {
+    flushConsoleOutput(pOutputSink);
+  }
+
+  free(pOutputSink->pBuffer);
+
+  pOutputSink->pFile = NULL;
+  pOutputSink->pBuffer = NULL;
+  pOutputSink->nLength = 0;
+  pOutputSink->nCapacity = 0;
+
+  if (pCurrentOutputSink == pOutputSink) pCurrentOutputSink = &ttyOutputSink;
+}
+
+/**
+ * Empties the buffer of a memory sink so that it can capture the next frame.
+ * @param[in,out] pOutputSink The sink to empty.
+ */
+void clearOutputSink(OutputSink *pOutputSink) { pOutputSink->nLength = 0; }
+
+/**
+ * Makes every screen and prompt write to the passed sink.
+ * @param pOutputSink The sink to write to, which must stay open while it is in use, or `NULL` for the standard output.
+ */
+void setOutputSink(OutputSink *pOutputSink) {
+  flushOutput();
+
+  pCurrentOutputSink = pOutputSink != NULL ? pOutputSink : &ttyOutputSink;
+}
+
+/**
+ * Checks whether the current sink discards everything written to it, so that output does not need to be built at all.
+ * @returns `1` if the current sink is a null sink or `0` if it is not.
+ */
+int isOutputDiscarded(void) { return pCurrentOutputSink->cSinkId == NULL_OUTPUT_SINK_ID; }
+
+/**
+ * Writes the passed bytes to the current sink. The console sink buffers them along with the prompts printed around
+ * them until the game waits for input, so that a screen and its prompts reach the console with a single write.
+ * @param pBytes The bytes to write.
+ * @param nByteCount The number of bytes to write.
+ * @returns `0` if every byte was written or `-1` if the sink could not be written to.
+ */
+int writeOutput(const char *pBytes, size_t nByteCount) {
+  OutputSink *pOutputSink = pCurrentOutputSink;
+
+  if (pOutputSink->cSinkId == TTY_OUTPUT_SINK_ID) {
+    // Bytes that do not fit in memory are written out straight away after everything buffered before them.
+    if (reserveConsoleCapacity(pOutputSink, nByteCount) != 0) {
+      return flushConsoleOutput(pOutputSink) == 0 ? writeToConsole(pBytes, nByteCount) : -1;
+    }
+
+    memcpy(pOutputSink->pBuffer + pOutputSink->nLength, pBytes, nByteCount);
+    pOutputSink->nLength += nByteCount;
+  } else if (pOutputSink->cSinkId == FILE_OUTPUT_SINK_ID) {
+    return fwrite(pBytes, 1, nByteCount, pOutputSink->pFile) == nByteCount ? 0 : -1;
+  } else if (pOutputSink->cSinkId == MEMORY_OUTPUT_SINK_ID) {
+    if (reserveOutputSinkCapacity(pOutputSink, nByteCount) != 0) return -1;
+
+    memcpy(pOutputSink->pBuffer + pOutputSink->nLength, pBytes, nByteCount);
+    pOutputSink->nLength += nByteCount;
+  }
+
+  return 0;
+}
+
+/**
+ * Prints formatted text to the current sink, which accepts the same format as `printf`. Nothing is formatted if the
+ * current sink is a null sink.
+ * @param strFormat The format of the text.
+ */
+void printOutput(const char *strFormat, ...) {
+  OutputSink *pOutputSink = pCurrentOutputSink;
+
+  if (pOutputSink->cSinkId == NULL_OUTPUT_SINK_ID) return;
+
+  // The text is formatted into the buffer of a console sink just like a memory sink, which must exist to do so.
+  if (pOutputSink->cSinkId == TTY_OUTPUT_SINK_ID && reserveConsoleCapacity(pOutputSink, 1) != 0) return;
+
+  va_list arguments;
+
+  va_start(arguments, strFormat);
+
+  if (pOutputSink->cSinkId == FILE_OUTPUT_SINK_ID) {
+    int nTextLength = vfprintf(pOutputSink->pFile, strFormat, arguments);
+
+    if (nTextLength > 0) addMetricsCounter(EMITTED_BYTE_METRICS_COUNTER, (uint64_t)nTextLength);
+  } else {
+    va_list copiedArguments;
+
+    va_copy(copiedArguments, arguments);
+
+    int nTextLength = vsnprintf(pOutputSink->pBuffer + pOutputSink->nLength,
+                                pOutputSink->nCapacity - pOutputSink->nLength, strFormat, arguments);
+
+    // The terminating null character is written but not counted, so the next write overwrites it.
+    if (nTextLength >= 0 && (size_t)nTextLength >= pOutputSink->nCapacity - pOutputSink->nLength &&
+        reserveOutputSinkCapacity(pOutputSink, (size_t)nTextLength + 1) == 0) {
+      vsnprintf(pOutputSink->pBuffer + pOutputSink->nLength, (size_t)nTextLength + 1, strFormat, copiedArguments);
+    }
+
+    if (nTextLength >= 0 && pOutputSink->nLength + (size_t)nTextLength < pOutputSink->nCapacity) {
+      pOutputSink->nLength += (size_t)nTextLength;
+    }
+
+    // Text printed outside of frames is emitted as well, so it counts towards the emitted bytes of the console sinks.
+    if (pOutputSink->cSinkId == TTY_OUTPUT_SINK_ID && nTextLength > 0) {
+      addMetricsCounter(EMITTED_BYTE_METRICS_COUNTER, (uint64_t)nTextLength);
+    }
+
+    va_end(copiedArguments);
+  }
+
+  va_end(arguments);
+}
+
+/** Writes out any text that the current sink has buffered, which must be done before waiting for input. */
+void flushOutput(void) {
+  if (pCurrentOutputSink->cSinkId == TTY_OUTPUT_SINK_ID) {
+    flushConsoleOutput(pCurrentOutputSink);
+  } else if (pCurrentOutputSink->cSinkId == FILE_OUTPUT_SINK_ID) {
+    fflush(pCurrentOutputSink->pFile);
+  }
+}
+
+/**
+ * Gets the number of system calls that every console sink has written with so far.
+ * @returns The number of writes.
+ */
+long getConsoleWriteCount(void) { return nConsoleWriteCount; }
@@ -0,0 +1,268 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "policy.h"
+
+#include "prompts.h"
+#include "trading.h"
+
+/**
+ * Gets twice the expected market price of the passed cargo in the passed port, which keeps the average an integer.
+ * @param cPortId The ID of the port.
+ * @param cCargoId The ID of the cargo.
+ * @returns The sum of the minimum and maximum market prices.
+ */
+static int getDoubledExpectedPrice(char cPortId, char cCargoId) {
+  int nMinimumPrice;
+  int nMaximumPrice;
+
+  getCargoPriceRange(cPortId, cCargoId, &nMinimumPrice, &nMaximumPrice);
+
+  return nMinimumPrice + nMaximumPrice;
+}
+
+/**
+ * Gets the highest doubled expected market price of the passed cargo among all ports except the passed one.
+ * @param cExcludedPortId The ID of the port to skip.
+ * @param cCargoId The ID of the cargo.
+ * @returns The highest sum of the minimum and maximum market prices.
+ */
+static int getBestDoubledExpectedPrice(char cExcludedPortId, char cCargoId) {
+  int nBestDoubledPrice = 0;
+
+  for (int nPortIndex = 0; nPortIndex < PORT_COUNT; nPortIndex++) {
+    if (PORT_IDS[nPortIndex] == cExcludedPortId) continue;
+
+    int nDoubledPrice = getDoubledExpectedPrice(PORT_IDS[nPortIndex], cCargoId);
+
+    if (nDoubledPrice > nBestDoubledPrice) nBestDoubledPrice = nDoubledPrice;
+  }
+
+  return nBestDoubledPrice;
+}
+
+/**
+ * Gets the largest amount of the passed cargo that the player can afford and the ship can store.
+ * @param pGameState The game to inspect.
+ * @param cCargoId The ID of the cargo.
+ * @returns A non-negative integer value.
+ */
+static int getMaximumBuyableCargoAmount(const GameState *pGameState, char cCargoId) {
+  int nShipFreeCargoSpace = pGameState->nShipCargoLimit - getShipTotalCargoAmount(pGameState);
+  int nAffordableCargoAmount = pGameState->nPlayerBalance / getCargoMarketPrice(pGameState, cCargoId);
+
+  return nAffordableCargoAmount < nShipFreeCargoSpace ? nAffordableCargoAmount : nShipFreeCargoSpace;
+}
+
+/**
+ * Chooses a random action that the rules allow, which is never quitting.
+ * @param pGameState The game to choose an action for.
+ * @param[in,out] pRandomGenerator The policy's own random number generator.
+ * @returns A valid action.
+ */
+GameAction chooseRandomAction(const GameState *pGameState, RandomGenerator *pRandomGenerator) {
+  GameAction action = {0};
+  char cCandidateCargoIds[CARGO_COUNT];
+  char cCandidateActionIds[4];
+  int nCandidateActionCount = 0;
+  int nShipTotalCargoAmount = getShipTotalCargoAmount(pGameState);
+  int nShipUpgradeCost;
+  int nShipNewCargoLimit;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+    if (getMaximumBuyableCargoAmount(pGameState, CARGO_IDS[nCargoIndex]) > 0) {
+      cCandidateActionIds[nCandidateActionCount++] = BUY_ACTION_ID;
+
+      break;
+    }
+  }
+
+  if (nShipTotalCargoAmount > 0) cCandidateActionIds[nCandidateActionCount++] = SELL_ACTION_ID;
+
+  if (getShipUpgrade(pGameState->nShipCargoLimit, &nShipUpgradeCost, &nShipNewCargoLimit) &&
+      pGameState->nPlayerBalance >= nShipUpgradeCost) {
+    cCandidateActionIds[nCandidateActionCount++] = UPGRADE_ACTION_ID;
+  }
+
+  cCandidateActionIds[nCandidateActionCount++] = NAVIGATE_ACTION_ID;
+
+  action.cActionId = cCandidateActionIds[generateBoundedRandomNumber(pRandomGenerator, nCandidateActionCount)];
+
+  int nCandidateCargoCount = 0;
+
+  switch (action.cActionId) {
+    case BUY_ACTION_ID: {
+      for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+        if (getMaximumBuyableCargoAmount(pGameState, CARGO_IDS[nCargoIndex]) > 0) {
+          cCandidateCargoIds[nCandidateCargoCount++] = CARGO_IDS[nCargoIndex];
+        }
+      }
+
+      action.cCargoId = cCandidateCargoIds[generateBoundedRandomNumber(pRandomGenerator, nCandidateCargoCount)];
+      action.nCargoAmount =
+        1 + generateBoundedRandomNumber(pRandomGenerator, getMaximumBuyableCargoAmount(pGameState, action.cCargoId));
+
+      break;
+    }
+    case SELL_ACTION_ID: {
+      for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+        if (getShipCargoAmount(pGameState, CARGO_IDS[nCargoIndex]) > 0) {
+          cCandidateCargoIds[nCandidateCargoCount++] = CARGO_IDS[nCargoIndex];
+        }
+      }
+
+      action.cCargoId = cCandidateCargoIds[generateBoundedRandomNumber(pRandomGenerator, nCandidateCargoCount)];
+      action.nCargoAmount =
+        1 + generateBoundedRandomNumber(pRandomGenerator, getShipCargoAmount(pGameState, action.cCargoId));
+
+      break;
+    }
+    case NAVIGATE_ACTION_ID: {
+      int nPortOffset = 1 + generateBoundedRandomNumber(pRandomGenerator, PORT_COUNT - 1);
+
+      action.cPortId = PORT_IDS[(getPortIndex(pGameState->cCurrentPortId) + nPortOffset) % PORT_COUNT];
+
+      break;
+    }
+  }
+
+  return action;
+}
+
+/**
+ * Chooses the port that the greedy policy sails to, which is wherever the carried cargo is expected to sell for the
+ * most, or wherever the best margin can be bought if the ship is empty.
+ * @param pGameState The game to choose a port for.
+ * @returns A valid navigation action.
+ */
+GameAction chooseGreedyNavigation(const GameState *pGameState) {
+  GameAction action = {0};
+  long nBestPortValue = -1;
+
+  action.cActionId = NAVIGATE_ACTION_ID;
+
+  for (int nPortIndex = 0; nPortIndex < PORT_COUNT; nPortIndex++) {
+    char cPortId = PORT_IDS[nPortIndex];
+    long nPortValue = 0;
+
+    if (cPortId == pGameState->cCurrentPortId) continue;
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      char cCargoId = CARGO_IDS[nCargoIndex];
+      int nShipCargoAmount = getShipCargoAmount(pGameState, cCargoId);
+
+      if (nShipCargoAmount > 0) {
+        nPortValue += (long)getDoubledExpectedPrice(cPortId, cCargoId) * nShipCargoAmount;
+      } else if (getShipTotalCargoAmount(pGameState) == 0) {
+        long nMargin = getBestDoubledExpectedPrice(cPortId, cCargoId) - getDoubledExpectedPrice(cPortId, cCargoId);
+
+        if (nMargin > nPortValue) nPortValue = nMargin;
+      }
+    }
+
+    if (nPortValue > nBestPortValue) {
+      nBestPortValue = nPortValue;
+
+      action.cPortId = cPortId;
+    }
+  }
+
+  return action;
+}
+
+/**
+ * Chooses an action by selling cargo worth more here than anywhere else, buying the cargo with the best expected margin
+ * at another port, and sailing to wherever the carried cargo is expected to sell for the most.
+ * @param pGameState The game to choose an action for.
+ * @returns A valid action.
+ */
+GameAction chooseGreedyAction(const GameState *pGameState) {
+  GameAction action = {0};
+  int bIsLastTurn = pGameState->nPlayerTurns == MAXIMUM_PLAYER_TURNS - 1;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+    char cCargoId = CARGO_IDS[nCargoIndex];
+    int nShipCargoAmount = getShipCargoAmount(pGameState, cCargoId);
+
+    if (nShipCargoAmount > 0 &&
+        (bIsLastTurn || getCargoMarketPrice(pGameState, cCargoId) * 2 >=
+                          getBestDoubledExpectedPrice(pGameState->cCurrentPortId, cCargoId))) {
+      action.cActionId = SELL_ACTION_ID;
+      action.cCargoId = cCargoId;
+      action.nCargoAmount = nShipCargoAmount;
+
+      return action;
+    }
+  }
+
+  if (!bIsLastTurn) {
+    int nShipUpgradeCost;
+    int nShipNewCargoLimit;
+
+    if (pGameState->nPlayerTurns < MAXIMUM_PLAYER_TURNS / 2 &&
+        getShipUpgrade(pGameState->nShipCargoLimit, &nShipUpgradeCost, &nShipNewCargoLimit) &&
+        pGameState->nPlayerBalance >= nShipUpgradeCost * 2) {
+      action.cActionId = UPGRADE_ACTION_ID;
+
+      return action;
+    }
+
+    long nBestExpectedGain = 0;
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      char cCargoId = CARGO_IDS[nCargoIndex];
+      int nCargoAmount = getMaximumBuyableCargoAmount(pGameState, cCargoId);
+      long nExpectedGain =
+        (long)(getBestDoubledExpectedPrice(pGameState->cCurrentPortId, cCargoId) -
+               getCargoMarketPrice(pGameState, cCargoId) * 2) *
+        nCargoAmount;
+
+      if (nCargoAmount > 0 && nExpectedGain > nBestExpectedGain) {
+        nBestExpectedGain = nExpectedGain;
+
+        action.cActionId = BUY_ACTION_ID;
+        action.cCargoId = cCargoId;
+        action.nCargoAmount = nCargoAmount;
+      }
+    }
+
+    if (nBestExpectedGain > 0) return action;
+  }
+
+  return chooseGreedyNavigation(pGameState);
+}
+
+/**
+ * Chooses an action using the passed policy.
+ * @param cPolicyId The ID of the policy.
+ * @param pGameState The game to choose an action for.
+ * @param[in,out] pRandomGenerator The policy's own random number generator.
+ * @param pSolvedPolicy The solved policy, which is only used by the `D` policy.
+ * @pre @p cPolicyId must have a character value of `R`, `G`, or `D`.
+ * @returns A valid action.
+ */
+GameAction choosePolicyAction(char cPolicyId, const GameState *pGameState, RandomGenerator *pRandomGenerator,
+                              const SolvedPolicy *pSolvedPolicy) {
+  if (cPolicyId == GREEDY_POLICY_ID) {
+    return chooseGreedyAction(pGameState);
+  } else if (cPolicyId == SOLVED_POLICY_ID) {
+    return chooseSolvedAction(pSolvedPolicy, pGameState);
+  } else {
+    return chooseRandomAction(pGameState, pRandomGenerator);
+  }
+}
@@ -18,143 +18,160 @@
 
 #include "prompts.h"
 
-#include <ctype.h>
-#include <stdio.h>
-
 #include "console.h"
+#include "output.h"
 #include "trading.h"
 
+static int bIsSkippingContinuation = 0;
+
+/** Prints out the prompt for the player's preferred merchant ID, followed by the input marker. */
+void printMerchantIdPrompt(void) {
+  int nConsoleLeftPaddingSize = 56;
+
+  printOutput("%*cEnter your preferred merchant code (0 - 999)\n", nConsoleLeftPaddingSize, ' ');
+
+  printInputMarker(nConsoleLeftPaddingSize);
+}
+
 /**
- * Prompts the player to input their preferred merchant ID.
- * @returns An integer value within the range of `0` and `999`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * Checks the player's answer to the merchant ID prompt, printing out why it was rejected and the input marker again if
+ * it is not valid.
+ * @param nGivenMerchantId The answer, which is `INVALID_INTEGER_INPUT` if it was not an integer.
+ * @returns `1` if the answer is valid or `0` if it is not.
  */
-int promptPlayerForMerchantId(void) {
+int checkMerchantIdAnswer(int nGivenMerchantId) {
   int nConsoleLeftPaddingSize = 56;
 
-  printf("%*cEnter your preferred merchant code (0 - 999)\n", nConsoleLeftPaddingSize, ' ');
+  if (nGivenMerchantId < MINIMUM_MERCHANT_ID_VALUE || nGivenMerchantId > MAXIMUM_MERCHANT_ID_VALUE) {
+    setConsoleColorToRed();
+    printOutput("%*cPlease only enter an integer within the range of 0 - 999!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else {
+    return 1;
+  }
+
+  printInputMarker(nConsoleLeftPaddingSize);
 
-  int nGivenMerchantId;
-  int bIsValid = 0;
+  return 0;
+}
 
-  do {
-    nGivenMerchantId = getIntegerInput(nConsoleLeftPaddingSize);
+/** Prints out the prompt for the number of gold coins the player wants to start with, followed by the input marker. */
+void printInitialBalancePrompt(void) {
+  int nConsoleLeftPaddingSize = 57;
 
-    if (nGivenMerchantId < MINIMUM_MERCHANT_ID_VALUE || nGivenMerchantId > MAXIMUM_MERCHANT_ID_VALUE) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter an integer within the range of 0 - 999!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else {
-      bIsValid = 1;
-    }
-  } while (!bIsValid);
+  printOutput("%*cEnter your preferred initial balance (> 0)\n", nConsoleLeftPaddingSize, ' ');
 
-  return nGivenMerchantId;
+  printInputMarker(nConsoleLeftPaddingSize);
 }
 
 /**
- * Prompts the player to input the number of gold coins they want to start with.
- * @returns An integer value greater than `0`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * Checks the player's answer to the initial balance prompt, printing out why it was rejected and the input marker again
+ * if it is not valid.
+ * @param nGivenInitialBalance The answer, which is `INVALID_INTEGER_INPUT` if it was not an integer.
+ * @returns `1` if the answer is valid or `0` if it is not.
  */
-int promptPlayerForInitialBalance(void) {
+int checkInitialBalanceAnswer(int nGivenInitialBalance) {
   int nConsoleLeftPaddingSize = 57;
 
-  printf("%*cEnter your preferred initial balance (> 0)\n", nConsoleLeftPaddingSize, ' ');
+  if (nGivenInitialBalance < MINIMUM_INITIAL_BALANCE) {
+    setConsoleColorToRed();
+    printOutput("%*cPlease only enter an integer greater than 0!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else {
+    return 1;
+  }
+
+  printInputMarker(nConsoleLeftPaddingSize);
 
-  int nGivenInitialBalance;
-  int bIsValid = 0;
+  return 0;
+}
 
-  do {
-    nGivenInitialBalance = getIntegerInput(nConsoleLeftPaddingSize);
+/** Prints out the prompt for the player's desired profit target, followed by the input marker. */
+void printProfitTargetPrompt(void) {
+  int nConsoleLeftPaddingSize = 62;
 
-    if (nGivenInitialBalance < MINIMUM_INITIAL_BALANCE) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter an integer greater than 0!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else {
-      bIsValid = 1;
-    }
-  } while (!bIsValid);
+  printOutput("%*cEnter your target profit (>= 20)\n", nConsoleLeftPaddingSize, ' ');
 
-  return nGivenInitialBalance;
+  printInputMarker(nConsoleLeftPaddingSize);
 }
 
 /**
- * Prompts the player to input their desired profit target.
- * @returns An integer value greater than `20`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * Checks the player's answer to the profit target prompt, printing out why it was rejected and the input marker again
+ * if it is not valid.
+ * @param nGivenProfitTarget The answer, which is `INVALID_INTEGER_INPUT` if it was not an integer.
+ * @returns `1` if the answer is valid or `0` if it is not.
  */
-int promptPlayerForProfitTarget(void) {
+int checkProfitTargetAnswer(int nGivenProfitTarget) {
   int nConsoleLeftPaddingSize = 62;
 
-  printf("%*cEnter your target profit (>= 20)\n", nConsoleLeftPaddingSize, ' ');
+  if (nGivenProfitTarget < MINIMUM_TARGET_PROFIT) {
+    setConsoleColorToRed();
+    printOutput("%*cPlease only enter an integer greater than or equal to 20!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else {
+    return 1;
+  }
+
+  printInputMarker(nConsoleLeftPaddingSize);
 
-  int nGivenProfitTarget;
-  int bIsValid = 0;
+  return 0;
+}
 
-  do {
-    nGivenProfitTarget = getIntegerInput(nConsoleLeftPaddingSize);
+/** Prints out the prompt for a confirmation of the player's prior decision, followed by the input marker. */
+void printConfirmationPrompt(void) {
+  int nConsoleLeftPaddingSize = 67;
 
-    if (nGivenProfitTarget < MINIMUM_TARGET_PROFIT) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter an integer greater than or equal to 20!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else {
-      bIsValid = 1;
-    }
-  } while (!bIsValid);
+  printOutput("%*cAre you sure? [Y / N]\n", nConsoleLeftPaddingSize, ' ');
 
-  return nGivenProfitTarget;
+  printInputMarker(nConsoleLeftPaddingSize);
 }
 
 /**
- * Prompts the player to input a confirmation of their prior decision.
- * @returns `1` if the player confirms or `0` if they do not.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * Checks the player's answer to the confirmation prompt, printing out why it was rejected and the input marker again if
+ * it is not valid.
+ * @param cGivenBooleanId The answer in uppercase, which is `INVALID_CHARACTER_INPUT` if it was not a single character.
+ * @returns `1` if the answer is valid or `0` if it is not.
  */
-int promptPlayerForConfirmation(void) {
+int checkConfirmationAnswer(char cGivenBooleanId) {
   int nConsoleLeftPaddingSize = 67;
 
-  printf("%*cAre you sure? [Y / N]\n", nConsoleLeftPaddingSize, ' ');
+  if (cGivenBooleanId != YES_ID && cGivenBooleanId != NO_ID) {
+    setConsoleColorToRed();
+    printOutput("%*cPlease only enter one of the provided character options!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else {
+    return 1;
+  }
 
-  char cGivenBooleanId;
-  int bIsValid = 0;
+  printInputMarker(nConsoleLeftPaddingSize);
 
-  do {
-    cGivenBooleanId = toupper(getCharacterInput(nConsoleLeftPaddingSize));
+  return 0;
+}
 
-    if (cGivenBooleanId != YES_ID && cGivenBooleanId != NO_ID) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter one of the provided character options!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else {
-      bIsValid = 1;
-    }
-  } while (!bIsValid);
+/**
+ * Sets whether the continuation prompts are skipped, which scripted games do since their moves have no pauses.
+ * @param bIsSkipping `1` to skip the continuation prompts or `0` to show them.
+ */
+void setContinuationSkipping(int bIsSkipping) { bIsSkippingContinuation = bIsSkipping; }
 
-  if (cGivenBooleanId == YES_ID) {
-    return 1;
-  } else {
-    return 0;
-  }
-}
+/**
+ * Checks whether the continuation prompts are skipped.
+ * @returns `1` if the continuation prompts are skipped or `0` if they are shown.
+ */
+int isContinuationSkipping(void) { return bIsSkippingContinuation; }
 
-/** Prompts the player to press the enter or return key to continue the game. */
-void promptPlayerForContinuation(void) {
+/** Prints out the prompt for the player to press the enter or return key, followed by the input marker. */
+void printContinuationPrompt(void) {
   int nConsoleLeftPaddingSize = 62;
 
-  printf("%*cEnter any character to continue\n", nConsoleLeftPaddingSize, ' ');
+  printOutput("%*cEnter any character to continue\n", nConsoleLeftPaddingSize, ' ');
 
-  getCharacterInput(nConsoleLeftPaddingSize);
+  printInputMarker(nConsoleLeftPaddingSize);
 }
 
 /**
- * Prompts the player to input the ID of the action they want to do.
+ * Prints out the prompt for the ID of the action the player wants to do, which only lists the actions they can afford,
+ * followed by the input marker.
  * @param nShipTotalCargoAmount The total amount of cargo carried by the ship.
  * @param nShipCargoLimit The maximum amount of cargo that the ship can carry.
  * @param nPlayerBalance The player's gold coin balance.
@@ -162,82 +179,96 @@ void promptPlayerForContinuation(void) {
  * @param nRiceMarketPrice The market price of rice.
  * @param nSilkMarketPrice The market price of silk.
  * @param nGunMarketPrice The market price of guns.
- * @returns A character value of `B` for the buy screen, `S` for the sell screen, `U` for the ship upgrade screen, `N`
- * for the navigation screen, or `Q` for quitting the game.
  */
-char promptPlayerForActionId(int nShipTotalCargoAmount, int nShipCargoLimit, int nPlayerBalance,
-                             int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice) {
+void printActionIdPrompt(int nShipTotalCargoAmount, int nShipCargoLimit, int nPlayerBalance, int nCoconutMarketPrice,
+                         int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice) {
   int nConsoleLeftPaddingSize = 65;
 
-  printf("%*cWhat would you like to do?\n", nConsoleLeftPaddingSize, ' ');
+  printOutput("%*cWhat would you like to do?\n", nConsoleLeftPaddingSize, ' ');
 
   if (nShipTotalCargoAmount < nShipCargoLimit &&
       (nPlayerBalance >= nCoconutMarketPrice || nPlayerBalance >= nRiceMarketPrice ||
        nPlayerBalance >= nSilkMarketPrice || nPlayerBalance >= nGunMarketPrice)) {
-    printf("%*c‣ [B] Buy Cargo\n", nConsoleLeftPaddingSize, ' ');
+    printOutput("%*c‣ [B] Buy Cargo\n", nConsoleLeftPaddingSize, ' ');
   }
 
-  if (nShipTotalCargoAmount > 0) printf("%*c‣ [S] Sell Cargo\n", nConsoleLeftPaddingSize, ' ');
+  if (nShipTotalCargoAmount > 0) printOutput("%*c‣ [S] Sell Cargo\n", nConsoleLeftPaddingSize, ' ');
 
   if (nShipCargoLimit < TIER_FOUR_SHIP_CARGO_LIMIT &&
       ((nShipCargoLimit == 75 && nPlayerBalance >= TIER_TWO_SHIP_UPGRADE_COST) ||
        (nShipCargoLimit == 150 && nPlayerBalance >= TIER_THREE_SHIP_UPGRADE_COST) ||
        (nShipCargoLimit == 225 && nPlayerBalance >= TIER_FOUR_SHIP_UPGRADE_COST))) {
-    printf("%*c‣ [U] Upgrade Ship\n", nConsoleLeftPaddingSize, ' ');
+    printOutput("%*c‣ [U] Upgrade Ship\n", nConsoleLeftPaddingSize, ' ');
   }
 
-  printf("%*c‣ [N] Navigate To a Different Port\n", nConsoleLeftPaddingSize, ' ');
-
-  printf("\n");
-
-  printf("%*c‣ [Q] Quit Game\n", nConsoleLeftPaddingSize, ' ');
-
-  char cChosenActionId;
-  int bIsValid = 0;
-
-  do {
-    cChosenActionId = toupper(getCharacterInput(nConsoleLeftPaddingSize));
-
-    if (cChosenActionId != BUY_ACTION_ID && cChosenActionId != SELL_ACTION_ID && cChosenActionId != UPGRADE_ACTION_ID &&
-        cChosenActionId != NAVIGATE_ACTION_ID && cChosenActionId != QUIT_ACTION_ID) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter one of the provided character options!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cChosenActionId == BUY_ACTION_ID && nShipTotalCargoAmount == nShipCargoLimit) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough storage to buy more cargo!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cChosenActionId == BUY_ACTION_ID &&
-               (nPlayerBalance <= nCoconutMarketPrice && nPlayerBalance <= nRiceMarketPrice &&
-                nPlayerBalance <= nSilkMarketPrice && nPlayerBalance <= nGunMarketPrice)) {
-      setConsoleColorToRed();
-      printf("%*cYou can't afford to buy any cargo!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cChosenActionId == SELL_ACTION_ID && nShipTotalCargoAmount == 0) {
-      setConsoleColorToRed();
-      printf("%*cYou have no cargo to sell!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cChosenActionId == UPGRADE_ACTION_ID && nShipCargoLimit == TIER_FOUR_SHIP_CARGO_LIMIT) {
-      setConsoleColorToRed();
-      printf("%*cYour ship is already in the highest tier!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cChosenActionId == UPGRADE_ACTION_ID &&
-               ((nShipCargoLimit == 75 && nPlayerBalance < TIER_TWO_SHIP_UPGRADE_COST) ||
-                (nShipCargoLimit == 150 && nPlayerBalance < TIER_THREE_SHIP_UPGRADE_COST) ||
-                (nShipCargoLimit == 225 && nPlayerBalance < TIER_FOUR_SHIP_UPGRADE_COST))) {
-      setConsoleColorToRed();
-      printf("%*cYou can't afford to upgrade your ship!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else {
-      bIsValid = 1;
-    }
-  } while (!bIsValid);
-
-  return cChosenActionId;
+  printOutput("%*c‣ [N] Navigate To a Different Port\n", nConsoleLeftPaddingSize, ' ');
+
+  printOutput("\n");
+
+  printOutput("%*c‣ [Q] Quit Game\n", nConsoleLeftPaddingSize, ' ');
+
+  printInputMarker(nConsoleLeftPaddingSize);
 }
 
 /**
- * Prompts the player to input the ID of the cargo they want to trade.
+ * Checks the player's answer to the action prompt, printing out why it was rejected and the input marker again if it is
+ * not valid.
+ * @param cChosenActionId The answer in uppercase, which is `INVALID_CHARACTER_INPUT` if it was not a single character.
+ * @param nShipTotalCargoAmount The total amount of cargo carried by the ship.
+ * @param nShipCargoLimit The maximum amount of cargo that the ship can carry.
+ * @param nPlayerBalance The player's gold coin balance.
+ * @param nCoconutMarketPrice The market price of coconuts.
+ * @param nRiceMarketPrice The market price of rice.
+ * @param nSilkMarketPrice The market price of silk.
+ * @param nGunMarketPrice The market price of guns.
+ * @returns `1` if the answer is valid or `0` if it is not.
+ */
+int checkActionIdAnswer(char cChosenActionId, int nShipTotalCargoAmount, int nShipCargoLimit, int nPlayerBalance,
+                        int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice) {
+  int nConsoleLeftPaddingSize = 65;
+
+  if (cChosenActionId != BUY_ACTION_ID && cChosenActionId != SELL_ACTION_ID && cChosenActionId != UPGRADE_ACTION_ID &&
+      cChosenActionId != NAVIGATE_ACTION_ID && cChosenActionId != QUIT_ACTION_ID) {
+    setConsoleColorToRed();
+    printOutput("%*cPlease only enter one of the provided character options!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cChosenActionId == BUY_ACTION_ID && nShipTotalCargoAmount == nShipCargoLimit) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough storage to buy more cargo!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cChosenActionId == BUY_ACTION_ID &&
+             (nPlayerBalance <= nCoconutMarketPrice && nPlayerBalance <= nRiceMarketPrice &&
+              nPlayerBalance <= nSilkMarketPrice && nPlayerBalance <= nGunMarketPrice)) {
+    setConsoleColorToRed();
+    printOutput("%*cYou can't afford to buy any cargo!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cChosenActionId == SELL_ACTION_ID && nShipTotalCargoAmount == 0) {
+    setConsoleColorToRed();
+    printOutput("%*cYou have no cargo to sell!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cChosenActionId == UPGRADE_ACTION_ID && nShipCargoLimit == TIER_FOUR_SHIP_CARGO_LIMIT) {
+    setConsoleColorToRed();
+    printOutput("%*cYour ship is already in the highest tier!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cChosenActionId == UPGRADE_ACTION_ID &&
+             ((nShipCargoLimit == 75 && nPlayerBalance < TIER_TWO_SHIP_UPGRADE_COST) ||
+              (nShipCargoLimit == 150 && nPlayerBalance < TIER_THREE_SHIP_UPGRADE_COST) ||
+              (nShipCargoLimit == 225 && nPlayerBalance < TIER_FOUR_SHIP_UPGRADE_COST))) {
+    setConsoleColorToRed();
+    printOutput("%*cYou can't afford to upgrade your ship!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else {
+    return 1;
+  }
+
+  printInputMarker(nConsoleLeftPaddingSize);
+
+  return 0;
+}
+
+/**
+ * Prints out the prompt for the ID of the cargo the player wants to trade, which only lists the cargo they can trade,
+ * followed by the input marker.
  * @param cTransactionTypeId The ID of the type of transaction to make.
  * @param nPlayerBalance The player's gold coin balance.
  * @param nCoconutMarketPrice The market price of coconuts.
@@ -249,99 +280,136 @@ char promptPlayerForActionId(int nShipTotalCargoAmount, int nShipCargoLimit, int
  * @param nShipSilkCargoAmount The amount of silk cargo carried by the ship.
  * @param nShipGunCargoAmount The amount of gun cargo carried by the ship.
  * @pre @p cTransactionTypeId must have a character value of either `B` or `S`.
- * @returns A character value of `C` for coconut, `R` for rice, `S` for silk, `G` for gun, or `X` for returning to the
- * main menu.
  */
-char promptPlayerForCargoId(char cTransactionTypeId, int nPlayerBalance, int nCoconutMarketPrice, int nRiceMarketPrice,
-                            int nSilkMarketPrice, int nGunMarketPrice, int nShipCoconutCargoAmount,
-                            int nShipRiceCargoAmount, int nShipSilkCargoAmount, int nShipGunCargoAmount) {
+void printCargoIdPrompt(char cTransactionTypeId, int nPlayerBalance, int nCoconutMarketPrice, int nRiceMarketPrice,
+                        int nSilkMarketPrice, int nGunMarketPrice, int nShipCoconutCargoAmount,
+                        int nShipRiceCargoAmount, int nShipSilkCargoAmount, int nShipGunCargoAmount) {
   int nConsoleLeftPaddingSize = 64;
 
   if (cTransactionTypeId == BUY_ACTION_ID) {
-    printf("%*cWhat would you like to buy?\n", nConsoleLeftPaddingSize, ' ');
+    printOutput("%*cWhat would you like to buy?\n", nConsoleLeftPaddingSize, ' ');
   } else {
-    printf("%*cWhat would you like to sell?\n", nConsoleLeftPaddingSize, ' ');
+    printOutput("%*cWhat would you like to sell?\n", nConsoleLeftPaddingSize, ' ');
   }
 
   if (cTransactionTypeId == BUY_ACTION_ID) {
-    if (nPlayerBalance > nCoconutMarketPrice) printf("%*c‣ [C] Coconut\n", nConsoleLeftPaddingSize, ' ');
+    if (nPlayerBalance > nCoconutMarketPrice) printOutput("%*c‣ [C] Coconut\n", nConsoleLeftPaddingSize, ' ');
+
+    if (nPlayerBalance > nRiceMarketPrice) printOutput("%*c‣ [R] Rice\n", nConsoleLeftPaddingSize, ' ');
+
+    if (nPlayerBalance > nSilkMarketPrice) printOutput("%*c‣ [S] Silk\n", nConsoleLeftPaddingSize, ' ');
+
+    if (nPlayerBalance > nGunMarketPrice) printOutput("%*c‣ [G] Gun\n", nConsoleLeftPaddingSize, ' ');
+  } else {
+    if (nShipCoconutCargoAmount > 0) printOutput("%*c‣ [C] Coconut\n", nConsoleLeftPaddingSize, ' ');
+
+    if (nShipRiceCargoAmount > 0) printOutput("%*c‣ [R] Rice\n", nConsoleLeftPaddingSize, ' ');
 
-    if (nPlayerBalance > nRiceMarketPrice) printf("%*c‣ [R] Rice\n", nConsoleLeftPaddingSize, ' ');
+    if (nShipSilkCargoAmount > 0) printOutput("%*c‣ [S] Silk\n", nConsoleLeftPaddingSize, ' ');
 
-    if (nPlayerBalance > nSilkMarketPrice) printf("%*c‣ [S] Silk\n", nConsoleLeftPaddingSize, ' ');
+    if (nShipGunCargoAmount > 0) printOutput("%*c‣ [G] Gun\n", nConsoleLeftPaddingSize, ' ');
+  }
+
+  printOutput("\n");
+
+  printOutput("%*c‣ [X] Return To Main Menu\n", nConsoleLeftPaddingSize, ' ');
+
+  printInputMarker(nConsoleLeftPaddingSize);
+}
+
+/**
+ * Checks the player's answer to the cargo prompt, printing out why it was rejected and the input marker again if it is
+ * not valid.
+ * @param cChosenCargoId The answer in uppercase, which is `INVALID_CHARACTER_INPUT` if it was not a single character.
+ * @param cTransactionTypeId The ID of the type of transaction to make.
+ * @param nPlayerBalance The player's gold coin balance.
+ * @param nCoconutMarketPrice The market price of coconuts.
+ * @param nRiceMarketPrice The market price of rice.
+ * @param nSilkMarketPrice The market price of silk.
+ * @param nGunMarketPrice The market price of guns.
+ * @param nShipCoconutCargoAmount The amount of coconut cargo carried by the ship.
+ * @param nShipRiceCargoAmount The amount of rice cargo carried by the ship.
+ * @param nShipSilkCargoAmount The amount of silk cargo carried by the ship.
+ * @param nShipGunCargoAmount The amount of gun cargo carried by the ship.
+ * @pre @p cTransactionTypeId must have a character value of either `B` or `S`.
+ * @returns `1` if the answer is valid or `0` if it is not.
+ */
+int checkCargoIdAnswer(char cChosenCargoId, char cTransactionTypeId, int nPlayerBalance, int nCoconutMarketPrice,
+                       int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice, int nShipCoconutCargoAmount,
+                       int nShipRiceCargoAmount, int nShipSilkCargoAmount, int nShipGunCargoAmount) {
+  int nConsoleLeftPaddingSize = 64;
 
-    if (nPlayerBalance > nGunMarketPrice) printf("%*c‣ [G] Gun\n", nConsoleLeftPaddingSize, ' ');
+  if (cChosenCargoId != COCONUT_CARGO_ID && cChosenCargoId != RICE_CARGO_ID && cChosenCargoId != SILK_CARGO_ID &&
+      cChosenCargoId != GUN_CARGO_ID && cChosenCargoId != CANCEL_ACTION_ID) {
+    setConsoleColorToRed();
+    printOutput("%*cPlease only enter one of the provided character options!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cTransactionTypeId == BUY_ACTION_ID && cChosenCargoId == COCONUT_CARGO_ID &&
+             nPlayerBalance < nCoconutMarketPrice) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough gold coins to buy a coconut!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cTransactionTypeId == BUY_ACTION_ID && cChosenCargoId == RICE_CARGO_ID &&
+             nPlayerBalance < nRiceMarketPrice) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough gold coins to buy rice!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cTransactionTypeId == BUY_ACTION_ID && cChosenCargoId == SILK_CARGO_ID &&
+             nPlayerBalance < nSilkMarketPrice) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough gold coins to buy silk!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cTransactionTypeId == BUY_ACTION_ID && cChosenCargoId == 'G' && nPlayerBalance < nGunMarketPrice) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough gold coins to buy a gun!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cTransactionTypeId == SELL_ACTION_ID && cChosenCargoId == COCONUT_CARGO_ID &&
+             nShipCoconutCargoAmount == 0) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have any coconuts to sell!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cTransactionTypeId == SELL_ACTION_ID && cChosenCargoId == RICE_CARGO_ID && nShipRiceCargoAmount == 0) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have any rice to sell!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cTransactionTypeId == SELL_ACTION_ID && cChosenCargoId == SILK_CARGO_ID && nShipSilkCargoAmount == 0) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have any silk to sell!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cTransactionTypeId == SELL_ACTION_ID && cChosenCargoId == GUN_CARGO_ID && nShipGunCargoAmount == 0) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have any guns to sell!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
   } else {
-    if (nShipCoconutCargoAmount > 0) printf("%*c‣ [C] Coconut\n", nConsoleLeftPaddingSize, ' ');
+    return 1;
+  }
 
-    if (nShipRiceCargoAmount > 0) printf("%*c‣ [R] Rice\n", nConsoleLeftPaddingSize, ' ');
+  printInputMarker(nConsoleLeftPaddingSize);
+
+  return 0;
+}
 
-    if (nShipSilkCargoAmount > 0) printf("%*c‣ [S] Silk\n", nConsoleLeftPaddingSize, ' ');
+/**
+ * Prints out the prompt for the amount of cargo the player wants to trade, followed by the input marker.
+ * @param cTransactionTypeId The ID of the type of transaction to make.
+ * @pre @p cTransactionTypeId must have a character value of either `B` or `S`.
+ */
+void printCargoAmountPrompt(char cTransactionTypeId) {
+  int nConsoleLeftPaddingSize = 57;
 
-    if (nShipGunCargoAmount > 0) printf("%*c‣ [G] Gun\n", nConsoleLeftPaddingSize, ' ');
+  if (cTransactionTypeId == BUY_ACTION_ID) {
+    printOutput("%*cEnter the amount of cargo you want to buy\n", nConsoleLeftPaddingSize, ' ');
+  } else {
+    printOutput("%*cEnter the amount of cargo you want to sell\n", nConsoleLeftPaddingSize, ' ');
   }
 
-  printf("\n");
-
-  printf("%*c‣ [X] Return To Main Menu\n", nConsoleLeftPaddingSize, ' ');
-
-  char cChosenCargoId;
-  int bIsValid = 0;
-
-  do {
-    cChosenCargoId = toupper(getCharacterInput(nConsoleLeftPaddingSize));
-
-    if (cChosenCargoId != COCONUT_CARGO_ID && cChosenCargoId != RICE_CARGO_ID && cChosenCargoId != SILK_CARGO_ID &&
-        cChosenCargoId != GUN_CARGO_ID && cChosenCargoId != CANCEL_ACTION_ID) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter one of the provided character options!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cTransactionTypeId == BUY_ACTION_ID && cChosenCargoId == COCONUT_CARGO_ID &&
-               nPlayerBalance < nCoconutMarketPrice) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy a coconut!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cTransactionTypeId == BUY_ACTION_ID && cChosenCargoId == RICE_CARGO_ID &&
-               nPlayerBalance < nRiceMarketPrice) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy rice!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cTransactionTypeId == BUY_ACTION_ID && cChosenCargoId == SILK_CARGO_ID &&
-               nPlayerBalance < nSilkMarketPrice) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy silk!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cTransactionTypeId == BUY_ACTION_ID && cChosenCargoId == 'G' && nPlayerBalance < nGunMarketPrice) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy a gun!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cTransactionTypeId == SELL_ACTION_ID && cChosenCargoId == COCONUT_CARGO_ID &&
-               nShipCoconutCargoAmount == 0) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have any coconuts to sell!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cTransactionTypeId == SELL_ACTION_ID && cChosenCargoId == RICE_CARGO_ID && nShipRiceCargoAmount == 0) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have any rice to sell!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cTransactionTypeId == SELL_ACTION_ID && cChosenCargoId == SILK_CARGO_ID && nShipSilkCargoAmount == 0) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have any silk to sell!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cTransactionTypeId == SELL_ACTION_ID && cChosenCargoId == GUN_CARGO_ID && nShipGunCargoAmount == 0) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have any guns to sell!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else {
-      bIsValid = 1;
-    }
-  } while (!bIsValid);
-
-  return cChosenCargoId;
+  printInputMarker(nConsoleLeftPaddingSize);
 }
 
 /**
- * Prompts the player to input the amount of cargo they want to trade.
+ * Checks the player's answer to the cargo amount prompt, printing out why it was rejected and the input marker again if
+ * it is not valid.
+ * @param nGivenCargoAmount The answer, which is `INVALID_INTEGER_INPUT` if it was not an integer.
  * @param cTransactionTypeId The ID of the type of transaction to make.
  * @param nShipCargoLimit The maximum amount of cargo that the ship can carry.
  * @param cCargoId The ID of the traded cargo.
@@ -356,182 +424,178 @@ char promptPlayerForCargoId(char cTransactionTypeId, int nPlayerBalance, int nCo
  * @param nShipGunCargoAmount The amount of gun cargo carried by the ship.
  * @pre @p cTransactionTypeId must have a character value of either `B` or `S`.
  * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
- * @returns An integer value greater than `0`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * @returns `1` if the answer is valid or `0` if it is not.
  */
-int promptPlayerForCargoAmount(char cTransactionTypeId, int nShipCargoLimit, char cCargoId, int nPlayerBalance,
-                               int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice,
-                               int nShipCoconutCargoAmount, int nShipRiceCargoAmount, int nShipSilkCargoAmount,
-                               int nShipGunCargoAmount) {
+int checkCargoAmountAnswer(int nGivenCargoAmount, char cTransactionTypeId, int nShipCargoLimit, char cCargoId,
+                           int nPlayerBalance, int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice,
+                           int nGunMarketPrice, int nShipCoconutCargoAmount, int nShipRiceCargoAmount,
+                           int nShipSilkCargoAmount, int nShipGunCargoAmount) {
   int nConsoleLeftPaddingSize = 57;
 
-  if (cTransactionTypeId == BUY_ACTION_ID) {
-    printf("%*cEnter the amount of cargo you want to buy\n", nConsoleLeftPaddingSize, ' ');
+  if (nGivenCargoAmount < 1) {
+    setConsoleColorToRed();
+    printOutput("%*cPlease only enter an integer greater than 0!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (nGivenCargoAmount > nShipCargoLimit) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough storage to buy this amount of cargo!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cTransactionTypeId == BUY_ACTION_ID && cCargoId == COCONUT_CARGO_ID &&
+             nPlayerBalance < (nGivenCargoAmount * nCoconutMarketPrice)) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough gold coins to buy %d coconuts!\n", nConsoleLeftPaddingSize, ' ',
+                nGivenCargoAmount);
+    resetConsoleColor();
+  } else if (cTransactionTypeId == BUY_ACTION_ID && cCargoId == RICE_CARGO_ID &&
+             nPlayerBalance < (nGivenCargoAmount * nRiceMarketPrice)) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough gold coins to buy %d rice!\n", nConsoleLeftPaddingSize, ' ',
+                nGivenCargoAmount);
+    resetConsoleColor();
+  } else if (cTransactionTypeId == BUY_ACTION_ID && cCargoId == SILK_CARGO_ID &&
+             nPlayerBalance < (nGivenCargoAmount * nSilkMarketPrice)) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough gold coins to buy %d silk!\n", nConsoleLeftPaddingSize, ' ',
+                nGivenCargoAmount);
+    resetConsoleColor();
+  } else if (cTransactionTypeId == BUY_ACTION_ID && cCargoId == GUN_CARGO_ID &&
+             nPlayerBalance < (nGivenCargoAmount * nGunMarketPrice)) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough gold coins to buy %d guns!\n", nConsoleLeftPaddingSize, ' ',
+                nGivenCargoAmount);
+    resetConsoleColor();
+  } else if (cTransactionTypeId == SELL_ACTION_ID && cCargoId == COCONUT_CARGO_ID &&
+             nShipCoconutCargoAmount < nGivenCargoAmount) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have %d coconuts to sell!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
+    resetConsoleColor();
+  } else if (cTransactionTypeId == SELL_ACTION_ID && cCargoId == RICE_CARGO_ID &&
+             nShipRiceCargoAmount < nGivenCargoAmount) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have %d rice to sell!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
+    resetConsoleColor();
+  } else if (cTransactionTypeId == SELL_ACTION_ID && cCargoId == SILK_CARGO_ID &&
+             nShipSilkCargoAmount < nGivenCargoAmount) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have %d silk to sell!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
+    resetConsoleColor();
+  } else if (cTransactionTypeId == SELL_ACTION_ID && cCargoId == GUN_CARGO_ID &&
+             nShipGunCargoAmount < nGivenCargoAmount) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have %d guns to sell!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
+    resetConsoleColor();
   } else {
-    printf("%*cEnter the amount of cargo you want to sell\n", nConsoleLeftPaddingSize, ' ');
+    return 1;
   }
 
-  int nGivenCargoAmount;
-  int bIsValid = 0;
-
-  do {
-    nGivenCargoAmount = getIntegerInput(nConsoleLeftPaddingSize);
-
-    if (nGivenCargoAmount < 1) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter an integer greater than 0!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (nGivenCargoAmount > nShipCargoLimit) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough storage to buy this amount of cargo!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cTransactionTypeId == BUY_ACTION_ID && cCargoId == COCONUT_CARGO_ID &&
-               nPlayerBalance < (nGivenCargoAmount * nCoconutMarketPrice)) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy %d coconuts!\n", nConsoleLeftPaddingSize, ' ',
-             nGivenCargoAmount);
-      resetConsoleColor();
-    } else if (cTransactionTypeId == BUY_ACTION_ID && cCargoId == RICE_CARGO_ID &&
-               nPlayerBalance < (nGivenCargoAmount * nRiceMarketPrice)) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy %d rice!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
-      resetConsoleColor();
-    } else if (cTransactionTypeId == BUY_ACTION_ID && cCargoId == SILK_CARGO_ID &&
-               nPlayerBalance < (nGivenCargoAmount * nSilkMarketPrice)) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy %d silk!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
-      resetConsoleColor();
-    } else if (cTransactionTypeId == BUY_ACTION_ID && cCargoId == GUN_CARGO_ID &&
-               nPlayerBalance < (nGivenCargoAmount * nGunMarketPrice)) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy %d guns!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
-      resetConsoleColor();
-    } else if (cTransactionTypeId == SELL_ACTION_ID && cCargoId == COCONUT_CARGO_ID &&
-               nShipCoconutCargoAmount < nGivenCargoAmount) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have %d coconuts to sell!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
-      resetConsoleColor();
-    } else if (cTransactionTypeId == SELL_ACTION_ID && cCargoId == RICE_CARGO_ID &&
-               nShipRiceCargoAmount < nGivenCargoAmount) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have %d rice to sell!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
-      resetConsoleColor();
-    } else if (cTransactionTypeId == SELL_ACTION_ID && cCargoId == SILK_CARGO_ID &&
-               nShipSilkCargoAmount < nGivenCargoAmount) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have %d silk to sell!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
-      resetConsoleColor();
-    } else if (cTransactionTypeId == SELL_ACTION_ID && cCargoId == GUN_CARGO_ID &&
-               nShipGunCargoAmount < nGivenCargoAmount) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have %d guns to sell!\n", nConsoleLeftPaddingSize, ' ', nGivenCargoAmount);
-      resetConsoleColor();
-    } else {
-      bIsValid = 1;
-    }
-  } while (!bIsValid);
-
-  return nGivenCargoAmount;
+  printInputMarker(nConsoleLeftPaddingSize);
+
+  return 0;
+}
+
+/** Prints out the prompt for whether the player wants to upgrade their ship, followed by the input marker. */
+void printShipUpgradePrompt(void) {
+  int nConsoleLeftPaddingSize = 57;
+
+  printOutput("%*cDo you want to upgrade your ship? [Y / N]\n", nConsoleLeftPaddingSize, ' ');
+
+  printInputMarker(nConsoleLeftPaddingSize);
 }
 
 /**
- * Prompts the player to input a confirmation on whether they want to upgrade their ship or not.
+ * Checks the player's answer to the ship upgrade prompt, printing out why it was rejected and the input marker again if
+ * it is not valid.
+ * @param cGivenBooleanId The answer in uppercase, which is `INVALID_CHARACTER_INPUT` if it was not a single character.
  * @param nShipCurrentCargoLimit The current maximum amount of cargo that the ship can carry.
  * @param nPlayerBalance The player's gold coin balance.
- * @returns `1` if the player wants to upgrade or `0` if they do not.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
+ * @returns `1` if the answer is valid or `0` if it is not.
  */
-int promptPlayerForShipUpgrade(int nShipCurrentCargoLimit, int nPlayerBalance) {
+int checkShipUpgradeAnswer(char cGivenBooleanId, int nShipCurrentCargoLimit, int nPlayerBalance) {
   int nConsoleLeftPaddingSize = 57;
 
-  printf("%*cDo you want to upgrade your ship? [Y / N]\n", nConsoleLeftPaddingSize, ' ');
-
-  char cGivenBooleanId;
-  int bIsValid = 0;
-
-  do {
-    cGivenBooleanId = toupper(getCharacterInput(nConsoleLeftPaddingSize));
-
-    if (cGivenBooleanId != YES_ID && cGivenBooleanId != NO_ID) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter one of the provided character options!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if ((nShipCurrentCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT && nPlayerBalance < TIER_TWO_SHIP_UPGRADE_COST) ||
-               (nShipCurrentCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT && nPlayerBalance < TIER_THREE_SHIP_UPGRADE_COST) ||
-               (nShipCurrentCargoLimit == TIER_THREE_SHIP_CARGO_LIMIT &&
-                nPlayerBalance < TIER_FOUR_SHIP_UPGRADE_COST)) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to upgrade your ship!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else {
-      bIsValid = 1;
-    }
-  } while (!bIsValid);
-
-  if (cGivenBooleanId == YES_ID) {
-    return 1;
+  if (cGivenBooleanId != YES_ID && cGivenBooleanId != NO_ID) {
+    setConsoleColorToRed();
+    printOutput("%*cPlease only enter one of the provided character options!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if ((nShipCurrentCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT && nPlayerBalance < TIER_TWO_SHIP_UPGRADE_COST) ||
+             (nShipCurrentCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT && nPlayerBalance < TIER_THREE_SHIP_UPGRADE_COST) ||
+             (nShipCurrentCargoLimit == TIER_THREE_SHIP_CARGO_LIMIT &&
+              nPlayerBalance < TIER_FOUR_SHIP_UPGRADE_COST)) {
+    setConsoleColorToRed();
+    printOutput("%*cYou do not have enough gold coins to upgrade your ship!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
   } else {
-    return 0;
+    return 1;
   }
+
+  printInputMarker(nConsoleLeftPaddingSize);
+
+  return 0;
 }
 
 /**
- * Prompts the player to input the ID of the port they want to navigate to.
+ * Prints out the prompt for the ID of the port the player wants to navigate to, which lists every port but the current
+ * one, followed by the input marker.
  * @param cCurrentPortId The ID of the current port.
  * @pre @p cCurrentPortId must have a character value of `T`, `M`, `P`, or `S`.
- * @returns A character value of `T` for Tondo, `M` for Manila, `P` for Pandakan, `S` for Sapa, or `X` for returning to
- * the main menu.
  */
-char promptPlayerForPortId(char cCurrentPortId) {
+void printPortIdPrompt(char cCurrentPortId) {
   int nConsoleLeftPaddingSize = 64;
 
-  printf("%*cWhere would you like to go?\n", nConsoleLeftPaddingSize, ' ');
-
-  if (cCurrentPortId != 'T') printf("%*c‣ [T] Tondo \n", nConsoleLeftPaddingSize, ' ');
-
-  if (cCurrentPortId != 'M') printf("%*c‣ [M] Manila \n", nConsoleLeftPaddingSize, ' ');
-
-  if (cCurrentPortId != 'P') printf("%*c‣ [P] Pandakan\n", nConsoleLeftPaddingSize, ' ');
-
-  if (cCurrentPortId != 'S') printf("%*c‣ [S] Sapa\n", nConsoleLeftPaddingSize, ' ');
-
-  printf("\n");
-
-  printf("%*c‣ [X] Return To Main Menu\n", nConsoleLeftPaddingSize, ' ');
-
-  char cChosenPortId;
-  int bIsValid = 0;
-
-  do {
-    cChosenPortId = toupper(getCharacterInput(nConsoleLeftPaddingSize));
-
-    if (cChosenPortId != TONDO_PORT_ID && cChosenPortId != MANILA_PORT_ID && cChosenPortId != PANDAKAN_PORT_ID &&
-        cChosenPortId != SAPA_PORT_ID && cChosenPortId != CANCEL_ACTION_ID) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter one of the provided character options!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cChosenPortId == TONDO_PORT_ID && cCurrentPortId == TONDO_PORT_ID) {
-      setConsoleColorToRed();
-      printf("%*cYou are already in the port of Tondo!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cChosenPortId == MANILA_PORT_ID && cCurrentPortId == MANILA_PORT_ID) {
-      setConsoleColorToRed();
-      printf("%*cYou are already in the port of Manila!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cChosenPortId == PANDAKAN_PORT_ID && cCurrentPortId == PANDAKAN_PORT_ID) {
-      setConsoleColorToRed();
-      printf("%*cYou are already in the port of Pandakan!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else if (cChosenPortId == SAPA_PORT_ID && cCurrentPortId == SAPA_PORT_ID) {
-      setConsoleColorToRed();
-      printf("%*cYou are already in the port of Sapa!\n", nConsoleLeftPaddingSize, ' ');
-      resetConsoleColor();
-    } else {
-      bIsValid = 1;
-    }
-  } while (!bIsValid);
-
-  return cChosenPortId;
+  printOutput("%*cWhere would you like to go?\n", nConsoleLeftPaddingSize, ' ');
+
+  if (cCurrentPortId != 'T') printOutput("%*c‣ [T] Tondo \n", nConsoleLeftPaddingSize, ' ');
+
+  if (cCurrentPortId != 'M') printOutput("%*c‣ [M] Manila \n", nConsoleLeftPaddingSize, ' ');
+
+  if (cCurrentPortId != 'P') printOutput("%*c‣ [P] Pandakan\n", nConsoleLeftPaddingSize, ' ');
+
+  if (cCurrentPortId != 'S') printOutput("%*c‣ [S] Sapa\n", nConsoleLeftPaddingSize, ' ');
+
+  printOutput("\n");
+
+  printOutput("%*c‣ [X] Return To Main Menu\n", nConsoleLeftPaddingSize, ' ');
+
+  printInputMarker(nConsoleLeftPaddingSize);
+}
+
+/**
+ * Checks the player's answer to the port prompt, printing out why it was rejected and the input marker again if it is
+ * not valid.
+ * @param cChosenPortId The answer in uppercase, which is `INVALID_CHARACTER_INPUT` if it was not a single character.
+ * @param cCurrentPortId The ID of the current port.
+ * @pre @p cCurrentPortId must have a character value of `T`, `M`, `P`, or `S`.
+ * @returns `1` if the answer is valid or `0` if it is not.
+ */
+int checkPortIdAnswer(char cChosenPortId, char cCurrentPortId) {
+  int nConsoleLeftPaddingSize = 64;
+
+  if (cChosenPortId != TONDO_PORT_ID && cChosenPortId != MANILA_PORT_ID && cChosenPortId != PANDAKAN_PORT_ID &&
+      cChosenPortId != SAPA_PORT_ID && cChosenPortId != CANCEL_ACTION_ID) {
+    setConsoleColorToRed();
+    printOutput("%*cPlease only enter one of the provided character options!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cChosenPortId == TONDO_PORT_ID && cCurrentPortId == TONDO_PORT_ID) {
+    setConsoleColorToRed();
+    printOutput("%*cYou are already in the port of Tondo!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cChosenPortId == MANILA_PORT_ID && cCurrentPortId == MANILA_PORT_ID) {
+    setConsoleColorToRed();
+    printOutput("%*cYou are already in the port of Manila!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cChosenPortId == PANDAKAN_PORT_ID && cCurrentPortId == PANDAKAN_PORT_ID) {
+    setConsoleColorToRed();
+    printOutput("%*cYou are already in the port of Pandakan!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else if (cChosenPortId == SAPA_PORT_ID && cCurrentPortId == SAPA_PORT_ID) {
+    setConsoleColorToRed();
+    printOutput("%*cYou are already in the port of Sapa!\n", nConsoleLeftPaddingSize, ' ');
+    resetConsoleColor();
+  } else {
+    return 1;
+  }
+
+  printInputMarker(nConsoleLeftPaddingSize);
+
+  return 0;
 }
@@ -0,0 +1,144 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "random.h"
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#define PCG_DEFAULT_STREAM 0xda3e39cb94b95bdbULL
+
+const uint64_t PCG_JUMP_MULTIPLIERS[RANDOM_LOOKAHEAD_COUNT + 1] = {
+  0x0000000000000001ULL, 0x5851f42d4c957f2dULL, 0x685f98a2018fade9ULL, 0x0b046976f22528f5ULL, 0xfb4d3ae39272be11ULL};
+const uint64_t PCG_JUMP_INCREMENT_FACTORS[RANDOM_LOOKAHEAD_COUNT + 1] = {
+  0x0000000000000000ULL, 0x0000000000000001ULL, 0x5851f42d4c957f2eULL, 0xc0b18ccf4e252d17ULL, 0xcbb5f646404a560cULL};
+
+/**
+ * Seeds the passed random number generator, which always produces the same sequence for the same seed.
+ * @param[out] pRandomGenerator The random number generator to seed.
+ * @param nSeed The seed of the sequence.
+ */
+void seedRandomGenerator(RandomGenerator *pRandomGenerator, uint64_t nSeed) {
+  pRandomGenerator->nState = 0;
+  pRandomGenerator->nIncrement = (PCG_DEFAULT_STREAM << 1) | 1;
+
+  generateRandomNumber(pRandomGenerator);
+
+  pRandomGenerator->nState += nSeed;
+
+  generateRandomNumber(pRandomGenerator);
+}
+
+/**
+ * Parses a seed passed on the command line, which must be a decimal number that fits in 64 bits so that a mistyped seed
+ * is not silently played as another one.
+ * @param strSeed The text of the seed.
+ * @param[out] pSeed The seed.
+ * @returns `0` if the seed was parsed or `-1` if the text is not such a number.
+ */
+int parseRandomSeed(const char *strSeed, uint64_t *pSeed) {
+  char *pEnd;
+
+  // `strtoull` would otherwise skip leading spaces and negate a leading minus sign.
+  if (!isdigit((unsigned char)strSeed[0])) return -1;
+
+  errno = 0;
+  *pSeed = strtoull(strSeed, &pEnd, 10);
+
+  return *pEnd == '\0' && errno == 0 ? 0 : -1;
+}
+
+/**
+ * Generates the next random number in the sequence.
+ * @param[in,out] pRandomGenerator The random number generator to advance.
+ * @returns An integer value within the full range of `uint32_t`.
+ */
+uint32_t generateRandomNumber(RandomGenerator *pRandomGenerator) {
+  uint64_t nOldState = pRandomGenerator->nState;
+
+  pRandomGenerator->nState = nOldState * PCG_MULTIPLIER + pRandomGenerator->nIncrement;
+
+  return permuteRandomState(nOldState);
+}
+
+/**
+ * Generates an unbiased random number below the passed bound using multiply-shift sampling.
+ * @param[in,out] pRandomGenerator The random number generator to advance.
+ * @param nBound The exclusive upper bound.
+ * @pre @p nBound must have a positive integer value.
+ * @returns An integer value within the range of `0` and `nBound - 1`.
+ */
+uint32_t generateBoundedRandomNumber(RandomGenerator *pRandomGenerator, uint32_t nBound) {
+  uint64_t nProduct = (uint64_t)generateRandomNumber(pRandomGenerator) * nBound;
+  uint32_t nLowBits = (uint32_t)nProduct;
+
+  // Rejects the few products that would otherwise make the lower results more likely than the higher ones.
+  if (nLowBits < nBound) {
+    uint32_t nThreshold = (0u - nBound) % nBound;
+
+    while (nLowBits < nThreshold) {
+      nProduct = (uint64_t)generateRandomNumber(pRandomGenerator) * nBound;
+      nLowBits = (uint32_t)nProduct;
+    }
+  }
+
+  return (uint32_t)(nProduct >> 32);
+}
+
+/**
+ * Generates an unbiased random number below each of the passed bounds, which gives exactly the same numbers as calling
+ * `generateBoundedRandomNumber` once per bound. Up to `RANDOM_LOOKAHEAD_COUNT` states are jumped to at once, so the
+ * draws do not wait on each other.
+ * @param[in,out] pRandomGenerator The random number generator to advance.
+ * @param pBounds The exclusive upper bound of each random number.
+ * @param[out] pRandomNumbers The generated random numbers.
+ * @param nCount The number of random numbers to generate.
+ * @pre Every bound in @p pBounds must have a positive integer value.
+ */
+void generateBoundedRandomNumbers(RandomGenerator *pRandomGenerator, const uint32_t *pBounds, uint32_t *pRandomNumbers,
+                                  int nCount) {
+  while (nCount > 0) {
+    int nLookaheadCount = nCount < RANDOM_LOOKAHEAD_COUNT ? nCount : RANDOM_LOOKAHEAD_COUNT;
+    uint64_t nState = pRandomGenerator->nState;
+    uint64_t nIncrement = pRandomGenerator->nIncrement;
+    int bMayReject = 0;
+
+    for (int nIndex = 0; nIndex < nLookaheadCount; nIndex++) {
+      uint64_t nJumpedState = PCG_JUMP_MULTIPLIERS[nIndex] * nState + PCG_JUMP_INCREMENT_FACTORS[nIndex] * nIncrement;
+      uint64_t nProduct = (uint64_t)permuteRandomState(nJumpedState) * pBounds[nIndex];
+
+      pRandomNumbers[nIndex] = (uint32_t)(nProduct >> 32);
+      bMayReject |= (uint32_t)nProduct < pBounds[nIndex];
+    }
+
+    // A rejection would shift every later draw onto another state, so those rare chunks are drawn one at a time.
+    if (bMayReject) {
+      for (int nIndex = 0; nIndex < nLookaheadCount; nIndex++) {
+        pRandomNumbers[nIndex] = generateBoundedRandomNumber(pRandomGenerator, pBounds[nIndex]);
+      }
+    } else {
+      pRandomGenerator->nState =
+        PCG_JUMP_MULTIPLIERS[nLookaheadCount] * nState + PCG_JUMP_INCREMENT_FACTORS[nLookaheadCount] * nIncrement;
+    }
+
+    pBounds += nLookaheadCount;
+    pRandomNumbers += nLookaheadCount;
+    nCount -= nLookaheadCount;
+  }
+}
@@ -0,0 +1,351 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "screen.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "console.h"
+
+#define SCREEN_CELL_COUNT (SCREEN_MAX_ROWS * SCREEN_MAX_COLUMNS)
+#define SCREEN_INITIAL_OUTPUT_CAPACITY 16384
+
+#define SPACE_GLYPH ((uint32_t)' ')
+
+/** The escape sequences of the colors a cell can have, indexed by the last digit of their ANSI color code. */
+static const char *const strColorEscapeSequences[] = {COLOR_DEFAULT, COLOR_RED,    COLOR_GREEN, COLOR_YELLOW,
+                                                      COLOR_BLUE,    COLOR_PURPLE, COLOR_CYAN};
+
+/**
+ * Appends the passed bytes to the output of the screen renderer.
+ * @param[in,out] pScreenRenderer The screen renderer whose output to append to.
+ * @param pBytes The bytes to append.
+ * @param nByteCount The number of bytes to append.
+ * @returns `0` if the bytes were appended or `-1` if the output buffer could not grow.
+ */
+static int appendScreenOutput(ScreenRenderer *pScreenRenderer, const char *pBytes, size_t nByteCount) {
+  if (pScreenRenderer->nOutputLength + nByteCount > pScreenRenderer->nOutputCapacity) {
+    size_t nNewCapacity = pScreenRenderer->nOutputCapacity > 0 ? pScreenRenderer->nOutputCapacity
+                                                               : SCREEN_INITIAL_OUTPUT_CAPACITY;
+
+    while (nNewCapacity < pScreenRenderer->nOutputLength + nByteCount) nNewCapacity *= 2;
+
+    char *pNewOutput = realloc(pScreenRenderer->pOutput, nNewCapacity);
+
+    if (pNewOutput == NULL) return -1;
+
+    pScreenRenderer->pOutput = pNewOutput;
+    pScreenRenderer->nOutputCapacity = nNewCapacity;
+  }
+
+  memcpy(pScreenRenderer->pOutput + pScreenRenderer->nOutputLength, pBytes, nByteCount);
+  pScreenRenderer->nOutputLength += nByteCount;
+
+  return 0;
+}
+
+/**
+ * Appends the UTF-8 bytes of the passed glyph to the output of the screen renderer.
+ * @param[in,out] pScreenRenderer The screen renderer whose output to append to.
+ * @param nGlyph The glyph, whose first byte is stored in its lowest 8 bits.
+ * @returns `0` if the glyph was appended or `-1` if the output buffer could not grow.
+ */
+static int appendScreenGlyph(ScreenRenderer *pScreenRenderer, uint32_t nGlyph) {
+  char strGlyph[4];
+  size_t nByteCount = 0;
+
+  while (nByteCount < sizeof(strGlyph) && (nGlyph >> (8 * nByteCount) & 0xFF) != 0) {
+    strGlyph[nByteCount] = (char)(nGlyph >> (8 * nByteCount) & 0xFF);
+    nByteCount++;
+  }
+
+  return appendScreenOutput(pScreenRenderer, strGlyph, nByteCount);
+}
+
+/**
+ * Appends the escape sequence that moves the console cursor to the passed cell.
+ * @param[in,out] pScreenRenderer The screen renderer whose output to append to.
+ * @param nRow The zero-based row of the cell.
+ * @param nColumn The zero-based column of the cell.
+ * @returns `0` if the escape sequence was appended or `-1` if the output buffer could not grow.
+ */
+static int appendScreenCursorMove(ScreenRenderer *pScreenRenderer, int nRow, int nColumn) {
+  char strEscapeSequence[16];
+  int nLength = snprintf(strEscapeSequence, sizeof(strEscapeSequence), "\033[%d;%dH", nRow + 1, nColumn + 1);
+
+  return appendScreenOutput(pScreenRenderer, strEscapeSequence, (size_t)nLength);
+}
+
+/**
+ * Parses the color index of the Select Graphic Rendition escape sequence at the start of the passed bytes.
+ * @param pBytes The bytes after the `ESC [` that starts the escape sequence.
+ * @param nByteCount The number of bytes left in the frame.
+ * @param[out] nColorIndex The index of the color in `strColorEscapeSequences`, which is `0` for any other sequence.
+ * @returns The number of bytes that the rest of the escape sequence takes up.
+ */
+static size_t parseColorEscapeSequence(const char *pBytes, size_t nByteCount, uint8_t *nColorIndex) {
+  size_t nByteIndex = 0;
+  int nParameter = 0;
+
+  while (nByteIndex < nByteCount && (pBytes[nByteIndex] < 0x40 || pBytes[nByteIndex] > 0x7E)) {
+    if (pBytes[nByteIndex] >= '0' && pBytes[nByteIndex] <= '9') {
+      nParameter = nParameter * 10 + (pBytes[nByteIndex] - '0');
+    } else {
+      nParameter = 0;
+    }
+
+    nByteIndex++;
+  }
+
+  *nColorIndex = nParameter >= 31 && nParameter <= 36 ? (uint8_t)(nParameter - 30) : 0;
+
+  return nByteIndex < nByteCount ? nByteIndex + 1 : nByteIndex;
+}
+
+/**
+ * Lays out the passed frame on the back grid of the screen renderer.
+ * @param[in,out] pScreenRenderer The screen renderer whose back grid to fill.
+ * @param pFrameBytes The frame to lay out.
+ * @param nFrameByteCount The number of bytes in the frame.
+ * @param[out] nCursorRow The row the console cursor ends up in after the frame.
+ * @param[out] nCursorColumn The column the console cursor ends up in after the frame.
+ */
+static void layOutScreenFrame(ScreenRenderer *pScreenRenderer, const char *pFrameBytes, size_t nFrameByteCount,
+                              int *nCursorRow, int *nCursorColumn) {
+  ScreenCell blankCell = {SPACE_GLYPH, 0};
+  uint8_t nColorIndex = 0;
+  int nRow = 0;
+  int nColumn = 0;
+  size_t nByteIndex = 0;
+
+  for (int nCellIndex = 0; nCellIndex < SCREEN_CELL_COUNT; nCellIndex++) pScreenRenderer->pBackCells[nCellIndex] = blankCell;
+
+  while (nByteIndex < nFrameByteCount) {
+    unsigned char cLeadByte = (unsigned char)pFrameBytes[nByteIndex];
+
+    if (cLeadByte == '\033' && nByteIndex + 1 < nFrameByteCount && pFrameBytes[nByteIndex + 1] == '[') {
+      nByteIndex += 2;
+      nByteIndex += parseColorEscapeSequence(pFrameBytes + nByteIndex, nFrameByteCount - nByteIndex, &nColorIndex);
+    } else if (cLeadByte == '\n') {
+      if (nRow < SCREEN_MAX_ROWS - 1) nRow++;
+
+      nColumn = 0;
+      nByteIndex++;
+    } else if (cLeadByte == '\r') {
+      nColumn = 0;
+      nByteIndex++;
+    } else if (cLeadByte < ' ') {
+      nByteIndex++;
+    } else {
+      size_t nGlyphByteCount = cLeadByte < 0x80 ? 1 : cLeadByte < 0xE0 ? 2 : cLeadByte < 0xF0 ? 3 : 4;
+      uint32_t nGlyph = 0;
+
+      for (size_t nGlyphByteIndex = 0; nGlyphByteIndex < nGlyphByteCount && nByteIndex < nFrameByteCount;
+           nGlyphByteIndex++) {
+        nGlyph |= (uint32_t)(unsigned char)pFrameBytes[nByteIndex++] << (8 * nGlyphByteIndex);
+      }
+
+      if (nColumn < SCREEN_MAX_COLUMNS) {
+        ScreenCell *pCell = &pScreenRenderer->pBackCells[nRow * SCREEN_MAX_COLUMNS + nColumn];
+
+        // A space looks the same in every color, so it is stored uncolored to avoid needless color changes.
+        pCell->nGlyph = nGlyph;
+        pCell->nColorIndex = nGlyph == SPACE_GLYPH ? 0 : nColorIndex;
+      }
+
+      nColumn++;
+    }
+  }
+
+  *nCursorRow = nRow;
+  *nCursorColumn = nColumn < SCREEN_MAX_COLUMNS ? nColumn : SCREEN_MAX_COLUMNS;
+}
+
+/**
+ * Checks whether the unchanged cells between the console cursor and the next changed cell can be written out again
+ * instead of moving the cursor past them, which is only the case if they do not need a different color.
+ * @param pScreenRenderer The screen renderer to inspect.
+ * @param nRow The row of the cells.
+ * @param nBeginColumn The column of the console cursor.
+ * @param nEndColumn The column of the next changed cell.
+ * @param nEmittedColorIndex The color the console currently draws with.
+ * @returns `1` if the cells can be written out again or `0` if the cursor should be moved.
+ */
+static int canRewriteScreenCells(const ScreenRenderer *pScreenRenderer, int nRow, int nBeginColumn, int nEndColumn,
+                                 int nEmittedColorIndex) {
+  if (nEndColumn - nBeginColumn > SCREEN_MAXIMUM_REWRITTEN_CELL_COUNT) return 0;
+
+  for (int nColumn = nBeginColumn; nColumn < nEndColumn; nColumn++) {
+    const ScreenCell *pCell = &pScreenRenderer->pBackCells[nRow * SCREEN_MAX_COLUMNS + nColumn];
+
+    if (pCell->nGlyph != SPACE_GLYPH && pCell->nColorIndex != nEmittedColorIndex) return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * Allocates the cell grids of a screen renderer. The first frame it renders clears the console and draws every cell.
+ * @param[out] pScreenRenderer The screen renderer to set up.
+ * @returns `0` if the screen renderer was created or `-1` if its grids could not be allocated.
+ */
+int createScreenRenderer(ScreenRenderer *pScreenRenderer) {
+  pScreenRenderer->pFrontCells = malloc(SCREEN_CELL_COUNT * sizeof(ScreenCell));
+  pScreenRenderer->pBackCells = malloc(SCREEN_CELL_COUNT * sizeof(ScreenCell));
+  pScreenRenderer->nFrontEndRow = 0;
+  pScreenRenderer->nFrontEndColumn = 0;
+  pScreenRenderer->bIsFrontValid = 0;
+  pScreenRenderer->pOutput = NULL;
+  pScreenRenderer->nOutputLength = 0;
+  pScreenRenderer->nOutputCapacity = 0;
+
+  if (pScreenRenderer->pFrontCells == NULL || pScreenRenderer->pBackCells == NULL) {
+    destroyScreenRenderer(pScreenRenderer);
+
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * Frees the cell grids and output buffer of a screen renderer.
+ * @param[in,out] pScreenRenderer The screen renderer to destroy.
+ */
+void destroyScreenRenderer(ScreenRenderer *pScreenRenderer) {
+  free(pScreenRenderer->pFrontCells);
+  free(pScreenRenderer->pBackCells);
+  free(pScreenRenderer->pOutput);
+
+  pScreenRenderer->pFrontCells = NULL;
+  pScreenRenderer->pBackCells = NULL;
+  pScreenRenderer->pOutput = NULL;
+  pScreenRenderer->nOutputCapacity = 0;
+}
+
+/**
+ * Forgets what the console currently shows, so that the next frame clears the console and is drawn in full.
+ * @param[in,out] pScreenRenderer The screen renderer to reset.
+ */
+void resetScreenRenderer(ScreenRenderer *pScreenRenderer) { pScreenRenderer->bIsFrontValid = 0; }
+
+/**
+ * Lays out the passed frame on the back grid and encodes the escape sequences that turn the front grid into it. The
+ * frame is anchored to the top left of the console, and everything after the end of the previous frame, such as the
+ * prompts printed below it, is cleared first. Text past the last row or column of the grid is dropped.
+ * @param[in,out] pScreenRenderer The screen renderer to draw with.
+ * @param pFrameBytes The frame, which may only contain text, newlines, and the color escape sequences of `console.h`.
+ * @param nFrameByteCount The number of bytes in the frame.
+ * @param[out] pOutputBytes The bytes to write to the console, which stay owned by the screen renderer.
+ * @param[out] nOutputByteCount The number of bytes to write to the console.
+ * @returns `0` if the frame was encoded or `-1` if the output buffer could not grow.
+ */
+int renderScreenFrame(ScreenRenderer *pScreenRenderer, const char *pFrameBytes, size_t nFrameByteCount,
+                      const char **pOutputBytes, size_t *nOutputByteCount) {
+  int nEndRow;
+  int nEndColumn;
+  int nStatus = 0;
+
+  layOutScreenFrame(pScreenRenderer, pFrameBytes, nFrameByteCount, &nEndRow, &nEndColumn);
+
+  pScreenRenderer->nOutputLength = 0;
+
+  if (!pScreenRenderer->bIsFrontValid) {
+    ScreenCell blankCell = {SPACE_GLYPH, 0};
+
+    for (int nCellIndex = 0; nCellIndex < SCREEN_CELL_COUNT; nCellIndex++) {
+      pScreenRenderer->pFrontCells[nCellIndex] = blankCell;
+    }
+
+    nStatus |= appendScreenOutput(pScreenRenderer, "\033[H\033[2J", 7);
+  } else {
+    // The front grid only knows about frames, so whatever was printed after the previous one is cleared first.
+    nStatus |= appendScreenCursorMove(pScreenRenderer, pScreenRenderer->nFrontEndRow, pScreenRenderer->nFrontEndColumn);
+    nStatus |= appendScreenOutput(pScreenRenderer, "\033[J", 3);
+  }
+
+  // The color the console draws with is unknown until the first escape sequence, since prompts may have changed it.
+  int nEmittedColorIndex = -1;
+  int nCursorRow = pScreenRenderer->bIsFrontValid ? pScreenRenderer->nFrontEndRow : 0;
+  int nCursorColumn = pScreenRenderer->bIsFrontValid ? pScreenRenderer->nFrontEndColumn : 0;
+
+  // Everything after the end of the frame is blank and cleared in one go, so only the cells before it are compared.
+  for (int nRow = 0; nRow <= nEndRow; nRow++) {
+    int nRowEndColumn = nRow < nEndRow ? SCREEN_MAX_COLUMNS : nEndColumn;
+
+    for (int nColumn = 0; nColumn < nRowEndColumn; nColumn++) {
+      int nCellIndex = nRow * SCREEN_MAX_COLUMNS + nColumn;
+      const ScreenCell *pBackCell = &pScreenRenderer->pBackCells[nCellIndex];
+      const ScreenCell *pFrontCell = &pScreenRenderer->pFrontCells[nCellIndex];
+
+      if (pBackCell->nGlyph == pFrontCell->nGlyph && pBackCell->nColorIndex == pFrontCell->nColorIndex) continue;
+
+      if (nCursorRow == nRow && nCursorColumn < nColumn &&
+          canRewriteScreenCells(pScreenRenderer, nRow, nCursorColumn, nColumn, nEmittedColorIndex)) {
+        for (int nRewrittenColumn = nCursorColumn; nRewrittenColumn < nColumn; nRewrittenColumn++) {
+          nStatus |= appendScreenGlyph(pScreenRenderer,
+                                       pScreenRenderer->pBackCells[nRow * SCREEN_MAX_COLUMNS + nRewrittenColumn].nGlyph);
+        }
+      } else if (nCursorRow != nRow || nCursorColumn != nColumn) {
+        nStatus |= appendScreenCursorMove(pScreenRenderer, nRow, nColumn);
+      }
+
+      if (pBackCell->nGlyph != SPACE_GLYPH && pBackCell->nColorIndex != nEmittedColorIndex) {
+        const char *strEscapeSequence = strColorEscapeSequences[pBackCell->nColorIndex];
+
+        nStatus |= appendScreenOutput(pScreenRenderer, strEscapeSequence, strlen(strEscapeSequence));
+        nEmittedColorIndex = pBackCell->nColorIndex;
+      }
+
+      nStatus |= appendScreenGlyph(pScreenRenderer, pBackCell->nGlyph);
+      nCursorRow = nRow;
+      nCursorColumn = nColumn + 1;
+    }
+  }
+
+  if (nCursorRow != nEndRow || nCursorColumn != nEndColumn) {
+    nStatus |= appendScreenCursorMove(pScreenRenderer, nEndRow, nEndColumn);
+  }
+
+  if (nEmittedColorIndex > 0) {
+    nStatus |= appendScreenOutput(pScreenRenderer, COLOR_DEFAULT, strlen(COLOR_DEFAULT));
+  }
+
+  if (nEndRow < pScreenRenderer->nFrontEndRow ||
+      (nEndRow == pScreenRenderer->nFrontEndRow && nEndColumn < pScreenRenderer->nFrontEndColumn)) {
+    nStatus |= appendScreenOutput(pScreenRenderer, "\033[J", 3);
+  }
+
+  if (nStatus != 0) {
+    pScreenRenderer->bIsFrontValid = 0;
+
+    return -1;
+  }
+
+  memcpy(pScreenRenderer->pFrontCells, pScreenRenderer->pBackCells, SCREEN_CELL_COUNT * sizeof(ScreenCell));
+  pScreenRenderer->nFrontEndRow = nEndRow;
+  pScreenRenderer->nFrontEndColumn = nEndColumn;
+  pScreenRenderer->bIsFrontValid = 1;
+
+  *pOutputBytes = pScreenRenderer->pOutput;
+  *nOutputByteCount = pScreenRenderer->nOutputLength;
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "scripted_player.h"
+
+#include <stddef.h>
+#include <string.h>
+
+static const ScriptedPrompt scriptedPrompts[] = {
+  {"Enter your preferred merchant code", SETUP_FRAME_KIND, "1"},
+  {"Enter your preferred initial balance", SETUP_FRAME_KIND, "1000"},
+  {"Enter your target profit", SETUP_FRAME_KIND, "20"},
+  {"What would you like to do?", MENU_FRAME_KIND, NULL},
+  {"What would you like to buy?", CARGO_FRAME_KIND, NULL},
+  {"What would you like to sell?", CARGO_FRAME_KIND, NULL},
+  {"Enter the amount of cargo you want to", AMOUNT_FRAME_KIND, "1"},
+  {"Are you sure?", CONFIRMATION_FRAME_KIND, "Y"},
+  {"Enter any character to continue", CONTINUATION_FRAME_KIND, "x"},
+  {"Where would you like to go?", PORT_FRAME_KIND, NULL},
+  {"Do you want to upgrade your ship?", UPGRADE_FRAME_KIND, "N"},
+};
+
+static const char *strFrameKindNames[FRAME_KIND_COUNT] = {
+  "setup", "main menu", "cargo menu", "cargo amount", "confirmation", "continuation", "navigation menu", "upgrade",
+  "game end",
+};
+
+/**
+ * Gets the name of the passed kind of frame.
+ * @param nFrameKind The kind of frame.
+ * @returns The name of the kind of frame.
+ */
+const char *getFrameKindName(int nFrameKind) { return strFrameKindNames[nFrameKind]; }
+
+/**
+ * Finds the prompt that the frame ends with.
+ * @param strFrame The output of the frame.
+ * @param[out] strPromptText The position of the prompt in the frame.
+ * @returns The prompt, or `NULL` if the frame has none.
+ */
+const ScriptedPrompt *findScriptedPrompt(const char *strFrame, const char **strPromptText) {
+  const ScriptedPrompt *pLastPrompt = NULL;
+
+  *strPromptText = NULL;
+
+  for (size_t nPromptIndex = 0; nPromptIndex < sizeof(scriptedPrompts) / sizeof(scriptedPrompts[0]); nPromptIndex++) {
+    const char *strText = strstr(strFrame, scriptedPrompts[nPromptIndex].strText);
+    const char *strNextText;
+
+    while (strText != NULL && (strNextText = strstr(strText + 1, scriptedPrompts[nPromptIndex].strText)) != NULL) {
+      strText = strNextText;
+    }
+
+    if (strText != NULL && (*strPromptText == NULL || strText > *strPromptText)) {
+      pLastPrompt = &scriptedPrompts[nPromptIndex];
+      *strPromptText = strText;
+    }
+  }
+
+  return pLastPrompt;
+}
+
+/**
+ * Gets the first option offered after a prompt that is not the option to return to the main menu.
+ * @param strPromptText The prompt in the frame.
+ * @returns The ID of the option, or `X` if there is none.
+ */
+static char getFirstScriptedOption(const char *strPromptText) {
+  const char *strOption = strPromptText;
+
+  while ((strOption = strstr(strOption, "\xe2\x80\xa3 [")) != NULL) {
+    strOption += strlen("\xe2\x80\xa3 [");
+
+    if (*strOption != 'X') return *strOption;
+  }
+
+  return 'X';
+}
+
+/**
+ * Chooses the answer to the prompt that the frame ends with. Every day, the player buys and sells one unit of the first
+ * cargo offered, if they can, then sails to the first port offered.
+ * @param pPrompt The prompt to answer.
+ * @param strPromptText The prompt in the frame.
+ * @param[in,out] nDayStep How far the player is through the plan of the current day, which starts at `0`.
+ * @param[out] strAnswer The answer, which holds room for `SCRIPTED_ANSWER_SIZE` characters.
+ */
+void chooseScriptedAnswer(const ScriptedPrompt *pPrompt, const char *strPromptText, int *nDayStep, char *strAnswer) {
+  if (pPrompt->strAnswer != NULL) {
+    strcpy(strAnswer, pPrompt->strAnswer);
+  } else if (pPrompt->nFrameKind == MENU_FRAME_KIND) {
+    if (*nDayStep == 0 && strstr(strPromptText, "[B] Buy Cargo") != NULL) {
+      strcpy(strAnswer, "B");
+    } else if (*nDayStep <= 1 && strstr(strPromptText, "[S] Sell Cargo") != NULL) {
+      strcpy(strAnswer, "S");
+    } else {
+      strcpy(strAnswer, "N");
+    }
+
+    (*nDayStep)++;
+  } else {
+    strAnswer[0] = getFirstScriptedOption(strPromptText);
+    strAnswer[1] = '\0';
+
+    if (pPrompt->nFrameKind == PORT_FRAME_KIND) *nDayStep = 0;
+  }
+}
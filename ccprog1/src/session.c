@@ -0,0 +1,392 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "session.h"
+
+#include <ctype.h>
+#include <stdio.h>
+
+#include "console.h"
+#include "output.h"
+#include "prompts.h"
+#include "text_graphics.h"
+#include "trace.h"
+
+#ifdef TIDES_TRACE
+static const char *strSessionStateNames[] = {
+  "AwaitMerchantId", "AwaitInitialBalance", "AwaitProfitTarget", "AwaitAction", "AwaitCargo", "AwaitAmount",
+  "AwaitConfirm", "AwaitUpgrade", "AwaitPort", "AwaitContinuation", "WeatherReport", "GameOver",
+};
+#endif
+
+/**
+ * Applies the passed action to the game and appends it to the journal, followed by a keyframe if one is due, if the
+ * game is being recorded.
+ * @param[in,out] pGameSession The game to advance.
+ * @param action The action to apply.
+ * @returns The outcome of the action.
+ */
+static GameStepResult stepSessionGame(GameSession *pGameSession, GameAction action) {
+  ActionJournalWriter *pActionJournalWriter = pGameSession->pActionJournalWriter;
+
+  if (pActionJournalWriter == NULL) return stepGame(&pGameSession->gameState, action);
+
+  int nStatus = recordJournalAction(pActionJournalWriter, action);
+  GameStepResult stepResult = stepGame(&pGameSession->gameState, action);
+
+  if (nStatus != 0 || recordJournalKeyframe(pActionJournalWriter, &pGameSession->gameState) != 0) {
+    fprintf(stderr, "Could not write to the journal.\n");
+  }
+
+  return stepResult;
+}
+
+/**
+ * Starts the next turn by printing out the main screen and the action prompt, unless the game is over.
+ * @param[in,out] pGameSession The game to advance.
+ * @returns `1` if the game is over or `0` if it is waiting on the player's action.
+ */
+static int beginSessionTurn(GameSession *pGameSession) {
+  GameState *pGameState = &pGameSession->gameState;
+
+  if (isGameOver(pGameState)) {
+    pGameSession->nSessionState = GAME_OVER_SESSION_STATE;
+
+    return 1;
+  }
+
+  int nShipTotalCargoAmount = getShipTotalCargoAmount(pGameState);
+
+  TRACE_BEGIN("printMainScreen");
+  printMainScreen(pGameState->nPlayerTurns, pGameState->cCurrentPortId, pGameState->nPlayerMerchantId,
+                  pGameState->nPlayerBalance, pGameState->nPlayerProfit, pGameState->nPlayerProfitTarget,
+                  nShipTotalCargoAmount, pGameState->nShipCargoLimit, pGameState->nShipCoconutCargoAmount,
+                  pGameState->nShipRiceCargoAmount, pGameState->nShipSilkCargoAmount, pGameState->nShipGunCargoAmount,
+                  pGameState->nCoconutMarketPrice, pGameState->nRiceMarketPrice, pGameState->nSilkMarketPrice,
+                  pGameState->nGunMarketPrice);
+  TRACE_END("printMainScreen");
+
+  printActionIdPrompt(nShipTotalCargoAmount, pGameState->nShipCargoLimit, pGameState->nPlayerBalance,
+                      pGameState->nCoconutMarketPrice, pGameState->nRiceMarketPrice, pGameState->nSilkMarketPrice,
+                      pGameState->nGunMarketPrice);
+
+  pGameSession->nSessionState = AWAIT_ACTION_SESSION_STATE;
+
+  return 0;
+}
+
+/**
+ * Shows the weather report of the last departure if it has one, or starts the next turn if it does not.
+ * @param[in,out] pGameSession The game to advance.
+ * @returns `1` if the game is over or `0` if it is waiting on another answer.
+ */
+static int continueSessionDeparture(GameSession *pGameSession) {
+  GameStepResult *pStepResult = &pGameSession->stepResult;
+
+  if (pGameSession->action.cActionId != NAVIGATE_ACTION_ID || !pStepResult->bHasWeatherReport) {
+    return beginSessionTurn(pGameSession);
+  }
+
+  TRACE_BEGIN("weatherReport");
+  printWeatherReportScreen(pStepResult->bIsNewStorm, pStepResult->nStormOldWindSignalNumber,
+                           pStepResult->nStormNewWindSignalNumber, pStepResult->nPostponedDepartureChance,
+                           pStepResult->nStormTurnDuration);
+  TRACE_END("weatherReport");
+
+  if (isContinuationSkipping()) return beginSessionTurn(pGameSession);
+
+  printContinuationPrompt();
+
+  pGameSession->nSessionState = WEATHER_REPORT_SESSION_STATE;
+
+  return 0;
+}
+
+/**
+ * Waits for the player to continue after the screen that reported the last action, unless continuation prompts are
+ * skipped.
+ * @param[in,out] pGameSession The game to advance.
+ * @returns `1` if the game is over or `0` if it is waiting on another answer.
+ */
+static int awaitSessionContinuation(GameSession *pGameSession) {
+  if (isContinuationSkipping()) return continueSessionDeparture(pGameSession);
+
+  printContinuationPrompt();
+
+  pGameSession->nSessionState = AWAIT_CONTINUATION_SESSION_STATE;
+
+  return 0;
+}
+
+/**
+ * Applies the confirmed action to the game and prints out the screen that reports it.
+ * @param[in,out] pGameSession The game to advance.
+ * @returns `1` if the game is over or `0` if it is waiting on another answer.
+ */
+static int applySessionAction(GameSession *pGameSession) {
+  GameState *pGameState = &pGameSession->gameState;
+  GameAction action = pGameSession->action;
+
+  int bIsTrading = action.cActionId == BUY_ACTION_ID || action.cActionId == SELL_ACTION_ID;
+
+  pGameSession->nPlayerDepartureTurn = pGameState->nPlayerTurns;
+
+  if (bIsTrading) TRACE_BEGIN("applyTrade");
+
+  pGameSession->stepResult = stepSessionGame(pGameSession, action);
+
+  if (bIsTrading) TRACE_END("applyTrade");
+
+  if (pGameSession->stepResult.nStatus != GAME_STEP_SUCCESS) return beginSessionTurn(pGameSession);
+
+  if (bIsTrading) {
+    printTransactionScreen(action.cActionId, action.cCargoId, action.nCargoAmount,
+                           pGameSession->stepResult.nCargoPrice);
+  } else if (action.cActionId == UPGRADE_ACTION_ID) {
+    printShipUpgradeScreen(pGameSession->stepResult.nShipCargoLimitIncrease, pGameSession->stepResult.nShipUpgradeCost);
+  } else {
+    printNavigationScreen(pGameSession->stepResult.bIsDepartureSuccessful, action.cPortId,
+                          pGameSession->nPlayerDepartureTurn);
+  }
+
+  return awaitSessionContinuation(pGameSession);
+}
+
+/**
+ * Starts a new game by printing out its start screen and the first prompt to the current output sink.
+ * @param[out] pGameSession The game to start.
+ * @param nSeed The seed of the game's random number generator.
+ * @param[in,out] pActionJournalWriter The journal to record to, or `NULL` if the game is not being recorded.
+ */
+void startGameSession(GameSession *pGameSession, uint64_t nSeed, ActionJournalWriter *pActionJournalWriter) {
+  pGameSession->nSeed = nSeed;
+  pGameSession->pActionJournalWriter = pActionJournalWriter;
+  pGameSession->nSessionState = AWAIT_MERCHANT_ID_SESSION_STATE;
+
+  printGameStartScreen();
+  printMerchantIdPrompt();
+}
+
+/**
+ * Resumes a saved game at the start of its current turn by printing out its main screen and the action prompt to the
+ * current output sink.
+ * @param[out] pGameSession The game to resume.
+ * @param pGameState The saved state of the game.
+ * @returns `1` if the game is already over or `0` if it is waiting on the player's action.
+ */
+int resumeGameSession(GameSession *pGameSession, const GameState *pGameState) {
+  pGameSession->gameState = *pGameState;
+  pGameSession->pActionJournalWriter = NULL;
+
+  return beginSessionTurn(pGameSession);
+}
+
+/**
+ * Answers the prompt that the game is waiting on by handling the answer in the game's current state.
+ * @param[in,out] pGameSession The game to advance.
+ * @param pToken The first character of the answer.
+ * @param nTokenLength The number of characters in the answer.
+ * @returns `1` if the game is over or `0` if it is waiting on another answer.
+ */
+static int answerGameSession(GameSession *pGameSession, const char *pToken, size_t nTokenLength) {
+  GameState *pGameState = &pGameSession->gameState;
+  GameAction *pAction = &pGameSession->action;
+  int nSessionState = pGameSession->nSessionState;
+  int nShipTotalCargoAmount = getShipTotalCargoAmount(pGameState);
+
+  if (nSessionState == AWAIT_MERCHANT_ID_SESSION_STATE) {
+    int nGivenMerchantId = parseIntegerAnswer(pToken, nTokenLength);
+
+    if (!checkMerchantIdAnswer(nGivenMerchantId)) return 0;
+
+    pGameSession->nPlayerMerchantId = nGivenMerchantId;
+
+    printOutput("\n");
+
+    printInitialBalancePrompt();
+
+    pGameSession->nSessionState = AWAIT_INITIAL_BALANCE_SESSION_STATE;
+  } else if (nSessionState == AWAIT_INITIAL_BALANCE_SESSION_STATE) {
+    int nGivenInitialBalance = parseIntegerAnswer(pToken, nTokenLength);
+
+    if (!checkInitialBalanceAnswer(nGivenInitialBalance)) return 0;
+
+    pGameSession->nPlayerInitialBalance = nGivenInitialBalance;
+
+    printOutput("\n");
+
+    printProfitTargetPrompt();
+
+    pGameSession->nSessionState = AWAIT_PROFIT_TARGET_SESSION_STATE;
+  } else if (nSessionState == AWAIT_PROFIT_TARGET_SESSION_STATE) {
+    int nGivenProfitTarget = parseIntegerAnswer(pToken, nTokenLength);
+
+    if (!checkProfitTargetAnswer(nGivenProfitTarget)) return 0;
+
+    initializeGame(pGameState, pGameSession->nPlayerMerchantId, pGameSession->nPlayerInitialBalance,
+                   nGivenProfitTarget, pGameSession->nSeed);
+
+    JournalSession session = {pGameSession->nSeed, pGameSession->nPlayerMerchantId,
+                              pGameSession->nPlayerInitialBalance, nGivenProfitTarget};
+
+    if (pGameSession->pActionJournalWriter != NULL &&
+        recordJournalSession(pGameSession->pActionJournalWriter, session) != 0) {
+      fprintf(stderr, "Could not write to the journal.\n");
+    }
+
+    return beginSessionTurn(pGameSession);
+  } else if (nSessionState == AWAIT_ACTION_SESSION_STATE) {
+    char cChosenActionId = toupper(parseCharacterAnswer(pToken, nTokenLength));
+
+    if (!checkActionIdAnswer(cChosenActionId, nShipTotalCargoAmount, pGameState->nShipCargoLimit,
+                             pGameState->nPlayerBalance, pGameState->nCoconutMarketPrice, pGameState->nRiceMarketPrice,
+                             pGameState->nSilkMarketPrice, pGameState->nGunMarketPrice)) {
+      return 0;
+    }
+
+    GameAction action = {0};
+
+    action.cActionId = cChosenActionId;
+    *pAction = action;
+
+    printOutput("\n");
+
+    if (cChosenActionId == BUY_ACTION_ID || cChosenActionId == SELL_ACTION_ID) {
+      printCargoIdPrompt(cChosenActionId, pGameState->nPlayerBalance, pGameState->nCoconutMarketPrice,
+                         pGameState->nRiceMarketPrice, pGameState->nSilkMarketPrice, pGameState->nGunMarketPrice,
+                         pGameState->nShipCoconutCargoAmount, pGameState->nShipRiceCargoAmount,
+                         pGameState->nShipSilkCargoAmount, pGameState->nShipGunCargoAmount);
+
+      pGameSession->nSessionState = AWAIT_CARGO_SESSION_STATE;
+    } else if (cChosenActionId == UPGRADE_ACTION_ID) {
+      printShipUpgradeMenu(pGameState->nShipCargoLimit);
+      printShipUpgradePrompt();
+
+      pGameSession->nSessionState = AWAIT_UPGRADE_SESSION_STATE;
+    } else if (cChosenActionId == NAVIGATE_ACTION_ID) {
+      printNavigationMenu(pGameState->cCurrentPortId, pGameState->nPlayerTurns);
+      printPortIdPrompt(pGameState->cCurrentPortId);
+
+      pGameSession->nSessionState = AWAIT_PORT_SESSION_STATE;
+    } else {
+      stepSessionGame(pGameSession, action);
+
+      return beginSessionTurn(pGameSession);
+    }
+  } else if (nSessionState == AWAIT_CARGO_SESSION_STATE) {
+    char cChosenCargoId = toupper(parseCharacterAnswer(pToken, nTokenLength));
+
+    if (!checkCargoIdAnswer(cChosenCargoId, pAction->cActionId, pGameState->nPlayerBalance,
+                            pGameState->nCoconutMarketPrice, pGameState->nRiceMarketPrice,
+                            pGameState->nSilkMarketPrice, pGameState->nGunMarketPrice,
+                            pGameState->nShipCoconutCargoAmount, pGameState->nShipRiceCargoAmount,
+                            pGameState->nShipSilkCargoAmount, pGameState->nShipGunCargoAmount)) {
+      return 0;
+    }
+
+    if (cChosenCargoId == CANCEL_ACTION_ID) return beginSessionTurn(pGameSession);
+
+    pAction->cCargoId = cChosenCargoId;
+
+    printOutput("\n");
+
+    printCargoAmountPrompt(pAction->cActionId);
+
+    pGameSession->nSessionState = AWAIT_AMOUNT_SESSION_STATE;
+  } else if (nSessionState == AWAIT_AMOUNT_SESSION_STATE) {
+    int nGivenCargoAmount = parseIntegerAnswer(pToken, nTokenLength);
+
+    if (!checkCargoAmountAnswer(nGivenCargoAmount, pAction->cActionId,
+                                pGameState->nShipCargoLimit - nShipTotalCargoAmount, pAction->cCargoId,
+                                pGameState->nPlayerBalance, pGameState->nCoconutMarketPrice,
+                                pGameState->nRiceMarketPrice, pGameState->nSilkMarketPrice,
+                                pGameState->nGunMarketPrice, pGameState->nShipCoconutCargoAmount,
+                                pGameState->nShipRiceCargoAmount, pGameState->nShipSilkCargoAmount,
+                                pGameState->nShipGunCargoAmount)) {
+      return 0;
+    }
+
+    pAction->nCargoAmount = nGivenCargoAmount;
+
+    printOutput("\n");
+
+    printConfirmationPrompt();
+
+    pGameSession->nSessionState = AWAIT_CONFIRMATION_SESSION_STATE;
+  } else if (nSessionState == AWAIT_CONFIRMATION_SESSION_STATE) {
+    char cGivenBooleanId = toupper(parseCharacterAnswer(pToken, nTokenLength));
+
+    if (!checkConfirmationAnswer(cGivenBooleanId)) return 0;
+
+    if (cGivenBooleanId != YES_ID) return beginSessionTurn(pGameSession);
+
+    return applySessionAction(pGameSession);
+  } else if (nSessionState == AWAIT_UPGRADE_SESSION_STATE) {
+    char cGivenBooleanId = toupper(parseCharacterAnswer(pToken, nTokenLength));
+
+    if (!checkShipUpgradeAnswer(cGivenBooleanId, pGameState->nShipCargoLimit, pGameState->nPlayerBalance)) return 0;
+
+    if (cGivenBooleanId != YES_ID) return beginSessionTurn(pGameSession);
+
+    return applySessionAction(pGameSession);
+  } else if (nSessionState == AWAIT_PORT_SESSION_STATE) {
+    char cChosenPortId = toupper(parseCharacterAnswer(pToken, nTokenLength));
+
+    if (!checkPortIdAnswer(cChosenPortId, pGameState->cCurrentPortId)) return 0;
+
+    if (cChosenPortId == CANCEL_ACTION_ID) return beginSessionTurn(pGameSession);
+
+    pAction->cPortId = cChosenPortId;
+
+    printOutput("\n");
+
+    printConfirmationPrompt();
+
+    pGameSession->nSessionState = AWAIT_CONFIRMATION_SESSION_STATE;
+  } else if (nSessionState == AWAIT_CONTINUATION_SESSION_STATE) {
+    return continueSessionDeparture(pGameSession);
+  } else if (nSessionState == WEATHER_REPORT_SESSION_STATE) {
+    return beginSessionTurn(pGameSession);
+  } else {
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+ * Answers the prompt that the game is waiting on, printing out everything up to and including the next prompt to the
+ * current output sink. An invalid answer prints out why it was rejected and the same prompt's input marker again.
+ * @param[in,out] pGameSession The game to advance.
+ * @param pToken The first character of the answer.
+ * @param nTokenLength The number of characters in the answer.
+ * @returns `1` if the game is over or `0` if it is waiting on another answer.
+ */
+int feedGameSession(GameSession *pGameSession, const char *pToken, size_t nTokenLength) {
+#ifdef TIDES_TRACE
+  const char *strSessionStateName = strSessionStateNames[pGameSession->nSessionState];
+#endif
+
+  TRACE_BEGIN(strSessionStateName);
+
+  int bIsGameOver = answerGameSession(pGameSession, pToken, nTokenLength);
+
+  TRACE_END(strSessionStateName);
+
+  return bIsGameOver;
+}
@@ -0,0 +1,450 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "simulation.h"
+
+#include <stdlib.h>
+
+#include "batch.h"
+#include "engine.h"
+#include "policy.h"
+#include "thread_pool.h"
+
+#define POLICY_SEED_MASK 0x9e3779b97f4a7c15ULL
+
+/** The shared arguments of a single simulation run. */
+typedef struct {
+  SimulationSummary *pWorkerSummaries;
+  char cPolicyId;
+  const SolvedPolicy *pSolvedPolicy;
+  int nPlayerInitialBalance;
+  int nPlayerProfitTarget;
+  uint64_t nBaseSeed;
+} Simulation;
+
+/** The shared arguments of a single batched simulation run, where every worker reuses its own batch. */
+typedef struct {
+  SimulationSummary *pWorkerSummaries;
+  GameBatch *pWorkerBatches;
+  long nGameCount;
+  int nBatchSize;
+  int nPlayerInitialBalance;
+  int nPlayerProfitTarget;
+  uint64_t nBaseSeed;
+} BatchSimulation;
+
+/**
+ * Plays a complete game from start to finish using the passed policy and keeps its final state.
+ * @param[out] pGameState The game to play.
+ * @param cPolicyId The ID of the policy that chooses every action.
+ * @param pSolvedPolicy The solved policy, which is only used by the `D` policy.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nSeed The seed of the game's random number generator.
+ * @pre @p cPolicyId must have a character value of `R`, `G`, or `D`.
+ */
+static void playSimulatedGame(GameState *pGameState, char cPolicyId, const SolvedPolicy *pSolvedPolicy,
+                              int nPlayerInitialBalance, int nPlayerProfitTarget, uint64_t nSeed) {
+  RandomGenerator policyRandomGenerator;
+
+  initializeGame(pGameState, 0, nPlayerInitialBalance, nPlayerProfitTarget, nSeed);
+  seedRandomGenerator(&policyRandomGenerator, nSeed ^ POLICY_SEED_MASK);
+
+  while (!isGameOver(pGameState)) {
+    GameAction action = choosePolicyAction(cPolicyId, pGameState, &policyRandomGenerator, pSolvedPolicy);
+
+    if (stepGame(pGameState, action).nStatus != GAME_STEP_SUCCESS) break;
+  }
+}
+
+/**
+ * Plays a complete game from start to finish using the passed policy.
+ * @param cPolicyId The ID of the policy that chooses every action.
+ * @param pSolvedPolicy The solved policy, which is only used by the `D` policy.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nSeed The seed of the game's random number generator.
+ * @pre @p cPolicyId must have a character value of `R`, `G`, or `D`.
+ * @returns The player's final profit percentage.
+ */
+int simulateGame(char cPolicyId, const SolvedPolicy *pSolvedPolicy, int nPlayerInitialBalance,
+                 int nPlayerProfitTarget, uint64_t nSeed) {
+  GameState gameState;
+
+  playSimulatedGame(&gameState, cPolicyId, pSolvedPolicy, nPlayerInitialBalance, nPlayerProfitTarget, nSeed);
+
+  return gameState.nPlayerProfit;
+}
+
+/**
+ * Gets the index of the profit count that the passed profit is counted in.
+ * @param nPlayerProfit The player's profit percentage.
+ * @returns An integer value within the range of `0` and the number of profit counts minus one.
+ */
+int getSimulationProfitIndex(int nPlayerProfit) {
+  if (nPlayerProfit < SIMULATION_MINIMUM_PROFIT) return 0;
+
+  if (nPlayerProfit < SIMULATION_EXACT_PROFIT_LIMIT) return nPlayerProfit - SIMULATION_MINIMUM_PROFIT;
+
+  int nDecadeIndex = 0;
+  int nDecadeStep = 10;
+
+  while (nDecadeIndex < SIMULATION_PROFIT_DECADE_COUNT - 1 && nPlayerProfit / nDecadeStep >= 1000) {
+    nDecadeIndex++;
+    nDecadeStep *= 10;
+  }
+
+  int nDecadeOffset = nPlayerProfit / nDecadeStep - 100;
+
+  if (nDecadeOffset > 899) nDecadeOffset = 899;
+
+  return SIMULATION_EXACT_PROFIT_LIMIT - SIMULATION_MINIMUM_PROFIT + nDecadeIndex * 900 + nDecadeOffset;
+}
+
+/**
+ * Gets the lowest profit counted in the profit count with the passed index.
+ * @param nProfitIndex The index of the profit count.
+ * @returns The profit percentage at the start of the profit count.
+ */
+int getSimulationIndexProfit(int nProfitIndex) {
+  if (nProfitIndex < SIMULATION_EXACT_PROFIT_LIMIT - SIMULATION_MINIMUM_PROFIT) {
+    return nProfitIndex + SIMULATION_MINIMUM_PROFIT;
+  }
+
+  nProfitIndex -= SIMULATION_EXACT_PROFIT_LIMIT - SIMULATION_MINIMUM_PROFIT;
+
+  int nDecadeStep = 10;
+
+  for (int nDecadeIndex = 0; nDecadeIndex < nProfitIndex / 900; nDecadeIndex++) nDecadeStep *= 10;
+
+  return (nProfitIndex % 900 + 100) * nDecadeStep;
+}
+
+/**
+ * Clears the passed summary so that it has no recorded games.
+ * @param[out] pSimulationSummary The summary to clear.
+ */
+void resetSimulationSummary(SimulationSummary *pSimulationSummary) {
+  pSimulationSummary->nGameCount = 0;
+  pSimulationSummary->nWinCount = 0;
+  pSimulationSummary->nProfitSum = 0;
+  pSimulationSummary->nMinimumProfit = 0;
+  pSimulationSummary->nMaximumProfit = 0;
+
+  for (int nProfitIndex = 0; nProfitIndex < SIMULATION_PROFIT_BUCKET_COUNT; nProfitIndex++) {
+    pSimulationSummary->nProfitCounts[nProfitIndex] = 0;
+  }
+}
+
+/**
+ * Records the final profit of a single game in the passed summary.
+ * @param[in,out] pSimulationSummary The summary to record in.
+ * @param nPlayerFinalProfit The player's final profit percentage.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ */
+void recordSimulatedGame(SimulationSummary *pSimulationSummary, int nPlayerFinalProfit, int nPlayerProfitTarget) {
+  if (pSimulationSummary->nGameCount == 0 || nPlayerFinalProfit < pSimulationSummary->nMinimumProfit) {
+    pSimulationSummary->nMinimumProfit = nPlayerFinalProfit;
+  }
+
+  if (pSimulationSummary->nGameCount == 0 || nPlayerFinalProfit > pSimulationSummary->nMaximumProfit) {
+    pSimulationSummary->nMaximumProfit = nPlayerFinalProfit;
+  }
+
+  pSimulationSummary->nGameCount++;
+  pSimulationSummary->nProfitSum += nPlayerFinalProfit;
+
+  if (nPlayerFinalProfit >= nPlayerProfitTarget) pSimulationSummary->nWinCount++;
+
+  pSimulationSummary->nProfitCounts[getSimulationProfitIndex(nPlayerFinalProfit)]++;
+}
+
+/**
+ * Adds all games recorded in one summary to another.
+ * @param[in,out] pSimulationSummary The summary to add to.
+ * @param pOtherSimulationSummary The summary to add from.
+ */
+void mergeSimulationSummaries(SimulationSummary *pSimulationSummary, const SimulationSummary *pOtherSimulationSummary) {
+  if (pOtherSimulationSummary->nGameCount == 0) return;
+
+  if (pSimulationSummary->nGameCount == 0 ||
+      pOtherSimulationSummary->nMinimumProfit < pSimulationSummary->nMinimumProfit) {
+    pSimulationSummary->nMinimumProfit = pOtherSimulationSummary->nMinimumProfit;
+  }
+
+  if (pSimulationSummary->nGameCount == 0 ||
+      pOtherSimulationSummary->nMaximumProfit > pSimulationSummary->nMaximumProfit) {
+    pSimulationSummary->nMaximumProfit = pOtherSimulationSummary->nMaximumProfit;
+  }
+
+  pSimulationSummary->nGameCount += pOtherSimulationSummary->nGameCount;
+  pSimulationSummary->nWinCount += pOtherSimulationSummary->nWinCount;
+  pSimulationSummary->nProfitSum += pOtherSimulationSummary->nProfitSum;
+
+  for (int nProfitIndex = 0; nProfitIndex < SIMULATION_PROFIT_BUCKET_COUNT; nProfitIndex++) {
+    pSimulationSummary->nProfitCounts[nProfitIndex] += pOtherSimulationSummary->nProfitCounts[nProfitIndex];
+  }
+}
+
+/**
+ * Gets the final profit below which the passed percentage of the recorded games fall.
+ * @param pSimulationSummary The summary to inspect.
+ * @param nPercentile The percentile to get.
+ * @pre @p nPercentile must have an integer value within the range of `0` and `100`.
+ * @returns The profit percentage at the percentile, rounded down to three significant digits above `1000`.
+ */
+int getSimulationProfitPercentile(const SimulationSummary *pSimulationSummary, int nPercentile) {
+  long nRank = (long)((pSimulationSummary->nGameCount - 1) * (nPercentile / 100.0));
+  long nCumulativeCount = 0;
+
+  for (int nProfitIndex = 0; nProfitIndex < SIMULATION_PROFIT_BUCKET_COUNT; nProfitIndex++) {
+    nCumulativeCount += pSimulationSummary->nProfitCounts[nProfitIndex];
+
+    if (nCumulativeCount > nRank) return getSimulationIndexProfit(nProfitIndex);
+  }
+
+  return pSimulationSummary->nMaximumProfit;
+}
+
+/**
+ * Plays a single game of the simulation and records it in the summary of the worker that played it.
+ * @param pContext The simulation's shared arguments.
+ * @param nTaskIndex The index of the game.
+ * @param nWorkerIndex The index of the worker playing the game.
+ */
+static void runSimulatedGame(void *pContext, long nTaskIndex, int nWorkerIndex) {
+  Simulation *pSimulation = pContext;
+  int nPlayerFinalProfit =
+    simulateGame(pSimulation->cPolicyId, pSimulation->pSolvedPolicy, pSimulation->nPlayerInitialBalance,
+                 pSimulation->nPlayerProfitTarget, pSimulation->nBaseSeed + nTaskIndex);
+
+  recordSimulatedGame(&pSimulation->pWorkerSummaries[nWorkerIndex], nPlayerFinalProfit,
+                      pSimulation->nPlayerProfitTarget);
+}
+
+/**
+ * Plays the passed number of games across the passed number of worker threads and aggregates their final profits.
+ * Game `i` is seeded with `nBaseSeed + i`, so the same arguments always give the same summary.
+ * @param[out] pSimulationSummary The summary of all games.
+ * @param cPolicyId The ID of the policy that chooses every action.
+ * @param pSolvedPolicy The solved policy, which is only used by the `D` policy.
+ * @param nGameCount The number of games to play.
+ * @param nWorkerCount The number of worker threads to use.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nBaseSeed The seed of the first game.
+ * @returns `0` if all games were played or `-1` if the workers could not be allocated.
+ */
+int runSimulation(SimulationSummary *pSimulationSummary, char cPolicyId, const SolvedPolicy *pSolvedPolicy,
+                  long nGameCount, int nWorkerCount, int nPlayerInitialBalance, int nPlayerProfitTarget,
+                  uint64_t nBaseSeed) {
+  if (nWorkerCount < 1) nWorkerCount = 1;
+
+  Simulation simulation;
+
+  simulation.pWorkerSummaries = malloc(sizeof(SimulationSummary) * nWorkerCount);
+  simulation.cPolicyId = cPolicyId;
+  simulation.pSolvedPolicy = pSolvedPolicy;
+  simulation.nPlayerInitialBalance = nPlayerInitialBalance;
+  simulation.nPlayerProfitTarget = nPlayerProfitTarget;
+  simulation.nBaseSeed = nBaseSeed;
+
+  if (simulation.pWorkerSummaries == NULL) return -1;
+
+  for (int nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+    resetSimulationSummary(&simulation.pWorkerSummaries[nWorkerIndex]);
+  }
+
+  int nStatus = runThreadPoolTasks(nGameCount, nWorkerCount, runSimulatedGame, &simulation);
+
+  resetSimulationSummary(pSimulationSummary);
+
+  for (int nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+    mergeSimulationSummaries(pSimulationSummary, &simulation.pWorkerSummaries[nWorkerIndex]);
+  }
+
+  free(simulation.pWorkerSummaries);
+
+  return nStatus;
+}
+
+/**
+ * Plays a single batch of the simulation with the greedy policy and records it in the summary of the worker that
+ * played it.
+ * @param pContext The batched simulation's shared arguments.
+ * @param nTaskIndex The index of the batch.
+ * @param nWorkerIndex The index of the worker playing the batch.
+ */
+static void runSimulatedBatch(void *pContext, long nTaskIndex, int nWorkerIndex) {
+  BatchSimulation *pBatchSimulation = pContext;
+  GameBatch *pGameBatch = &pBatchSimulation->pWorkerBatches[nWorkerIndex];
+  long nFirstGameIndex = nTaskIndex * pBatchSimulation->nBatchSize;
+  long nRemainingGameCount = pBatchSimulation->nGameCount - nFirstGameIndex;
+
+  // The last batch may be partial, which only needs fewer of the games that were allocated.
+  pGameBatch->nGameCount =
+    nRemainingGameCount < pBatchSimulation->nBatchSize ? (int)nRemainingGameCount : pBatchSimulation->nBatchSize;
+
+  initializeGameBatch(pGameBatch, pBatchSimulation->nPlayerInitialBalance, pBatchSimulation->nPlayerProfitTarget,
+                      pBatchSimulation->nBaseSeed + nFirstGameIndex);
+  playBatchGreedily(pGameBatch);
+
+  for (int nGameIndex = 0; nGameIndex < pGameBatch->nGameCount; nGameIndex++) {
+    int nPlayerFinalProfit =
+      calculatePlayerProfit(pGameBatch->pPlayerBalances[nGameIndex], pGameBatch->nPlayerInitialBalance);
+
+    recordSimulatedGame(&pBatchSimulation->pWorkerSummaries[nWorkerIndex], nPlayerFinalProfit,
+                        pBatchSimulation->nPlayerProfitTarget);
+  }
+}
+
+/**
+ * Plays the passed number of games with the greedy policy in structure-of-arrays batches across the passed number of
+ * worker threads. Every game is seeded exactly like in `runSimulation`, so both give the same summary.
+ * @param[out] pSimulationSummary The summary of all games.
+ * @param nGameCount The number of games to play.
+ * @param nBatchSize The number of games that each worker advances together.
+ * @param nWorkerCount The number of worker threads to use.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nBaseSeed The seed of the first game.
+ * @returns `0` if all games were played or `-1` if the workers or their batches could not be allocated.
+ */
+int runBatchSimulation(SimulationSummary *pSimulationSummary, long nGameCount, int nBatchSize, int nWorkerCount,
+                       int nPlayerInitialBalance, int nPlayerProfitTarget, uint64_t nBaseSeed) {
+  if (nWorkerCount < 1) nWorkerCount = 1;
+
+  if (nBatchSize < 1) nBatchSize = 1;
+
+  BatchSimulation batchSimulation;
+  int nCreatedBatchCount = 0;
+  int nStatus = -1;
+
+  batchSimulation.pWorkerSummaries = malloc(sizeof(SimulationSummary) * nWorkerCount);
+  batchSimulation.pWorkerBatches = malloc(sizeof(GameBatch) * nWorkerCount);
+  batchSimulation.nGameCount = nGameCount;
+  batchSimulation.nBatchSize = nBatchSize;
+  batchSimulation.nPlayerInitialBalance = nPlayerInitialBalance;
+  batchSimulation.nPlayerProfitTarget = nPlayerProfitTarget;
+  batchSimulation.nBaseSeed = nBaseSeed;
+
+  if (batchSimulation.pWorkerSummaries != NULL && batchSimulation.pWorkerBatches != NULL) {
+    while (nCreatedBatchCount < nWorkerCount &&
+           createGameBatch(&batchSimulation.pWorkerBatches[nCreatedBatchCount], nBatchSize) == 0) {
+      resetSimulationSummary(&batchSimulation.pWorkerSummaries[nCreatedBatchCount]);
+
+      nCreatedBatchCount++;
+    }
+  }
+
+  if (nCreatedBatchCount == nWorkerCount) {
+    nStatus = runThreadPoolTasks((nGameCount + nBatchSize - 1) / nBatchSize, nWorkerCount, runSimulatedBatch,
+                                 &batchSimulation);
+
+    resetSimulationSummary(pSimulationSummary);
+
+    for (int nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+      mergeSimulationSummaries(pSimulationSummary, &batchSimulation.pWorkerSummaries[nWorkerIndex]);
+    }
+  }
+
+  for (int nWorkerIndex = 0; nWorkerIndex < nCreatedBatchCount; nWorkerIndex++) {
+    destroyGameBatch(&batchSimulation.pWorkerBatches[nWorkerIndex]);
+  }
+
+  free(batchSimulation.pWorkerSummaries);
+  free(batchSimulation.pWorkerBatches);
+
+  return nStatus;
+}
+
+/**
+ * Checks whether two games are in exactly the same state, including their random number generators.
+ * @param pGameState The first game.
+ * @param pOtherGameState The second game.
+ * @returns `1` if the games are identical or `0` if they are not.
+ */
+static int isGameStateEqual(const GameState *pGameState, const GameState *pOtherGameState) {
+  return pGameState->nPlayerMerchantId == pOtherGameState->nPlayerMerchantId &&
+         pGameState->nPlayerInitialBalance == pOtherGameState->nPlayerInitialBalance &&
+         pGameState->nPlayerBalance == pOtherGameState->nPlayerBalance &&
+         pGameState->nPlayerProfitTarget == pOtherGameState->nPlayerProfitTarget &&
+         pGameState->nPlayerProfit == pOtherGameState->nPlayerProfit &&
+         pGameState->nPlayerTurns == pOtherGameState->nPlayerTurns &&
+         pGameState->bIsQuitting == pOtherGameState->bIsQuitting &&
+         pGameState->cCurrentPortId == pOtherGameState->cCurrentPortId &&
+         pGameState->nShipCargoLimit == pOtherGameState->nShipCargoLimit &&
+         pGameState->nShipCoconutCargoAmount == pOtherGameState->nShipCoconutCargoAmount &&
+         pGameState->nShipRiceCargoAmount == pOtherGameState->nShipRiceCargoAmount &&
+         pGameState->nShipSilkCargoAmount == pOtherGameState->nShipSilkCargoAmount &&
+         pGameState->nShipGunCargoAmount == pOtherGameState->nShipGunCargoAmount &&
+         pGameState->nCoconutMarketPrice == pOtherGameState->nCoconutMarketPrice &&
+         pGameState->nRiceMarketPrice == pOtherGameState->nRiceMarketPrice &&
+         pGameState->nSilkMarketPrice == pOtherGameState->nSilkMarketPrice &&
+         pGameState->nGunMarketPrice == pOtherGameState->nGunMarketPrice &&
+         pGameState->nStormTurnDuration == pOtherGameState->nStormTurnDuration &&
+         pGameState->bIsNewStorm == pOtherGameState->bIsNewStorm &&
+         pGameState->nStormWindSignalNumber == pOtherGameState->nStormWindSignalNumber &&
+         pGameState->nPostponedDepartureChance == pOtherGameState->nPostponedDepartureChance &&
+         pGameState->randomGenerator.nState == pOtherGameState->randomGenerator.nState &&
+         pGameState->randomGenerator.nIncrement == pOtherGameState->randomGenerator.nIncrement;
+}
+
+/**
+ * Plays the passed number of games with the greedy policy both in batches and one at a time, and compares their final
+ * states.
+ * @param nGameCount The number of games to play.
+ * @param nBatchSize The number of games that are advanced together.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param nBaseSeed The seed of the first game.
+ * @returns The number of games whose final states differ or `-1` if the batch could not be allocated.
+ */
+long verifyBatchSimulation(long nGameCount, int nBatchSize, int nPlayerInitialBalance, int nPlayerProfitTarget,
+                           uint64_t nBaseSeed) {
+  GameBatch gameBatch;
+  long nMismatchCount = 0;
+
+  if (nBatchSize < 1) nBatchSize = 1;
+
+  if (createGameBatch(&gameBatch, nBatchSize) != 0) return -1;
+
+  for (long nFirstGameIndex = 0; nFirstGameIndex < nGameCount; nFirstGameIndex += nBatchSize) {
+    long nRemainingGameCount = nGameCount - nFirstGameIndex;
+
+    gameBatch.nGameCount = nRemainingGameCount < nBatchSize ? (int)nRemainingGameCount : nBatchSize;
+
+    initializeGameBatch(&gameBatch, nPlayerInitialBalance, nPlayerProfitTarget, nBaseSeed + nFirstGameIndex);
+    playBatchGreedily(&gameBatch);
+
+    for (int nGameIndex = 0; nGameIndex < gameBatch.nGameCount; nGameIndex++) {
+      GameState batchGameState;
+      GameState scalarGameState;
+
+      copyBatchGameState(&gameBatch, nGameIndex, &batchGameState);
+      playSimulatedGame(&scalarGameState, GREEDY_POLICY_ID, NULL, nPlayerInitialBalance, nPlayerProfitTarget,
+                        nBaseSeed + nFirstGameIndex + nGameIndex);
+
+      if (!isGameStateEqual(&batchGameState, &scalarGameState)) nMismatchCount++;
+    }
+  }
+
+  destroyGameBatch(&gameBatch);
+
+  return nMismatchCount;
+}
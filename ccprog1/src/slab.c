@@ -0,0 +1,247 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "slab.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Every slot starts on a 16-byte boundary, which suits every type that a slot may hold.
+#define SLAB_SLOT_ALIGNMENT 16
+
+/**
+ * Gets the size of the slots that a pool allocates for objects of the passed size.
+ * @param nObjectSize The size of every object in bytes.
+ * @returns The size of every slot in bytes.
+ */
+size_t getSlabSlotSize(size_t nObjectSize) {
+  // A free slot holds the pointer to the next free slot, so no slot can be smaller than one.
+  if (nObjectSize < sizeof(void *)) nObjectSize = sizeof(void *);
+
+  return (nObjectSize + SLAB_SLOT_ALIGNMENT - 1) / SLAB_SLOT_ALIGNMENT * SLAB_SLOT_ALIGNMENT;
+}
+
+/**
+ * Sets up an empty pool of slots of the passed size.
+ * @param[out] pSlabPool The pool to set up.
+ * @param nSlotSize The size of every slot in bytes.
+ */
+void openSlabPool(SlabPool *pSlabPool, size_t nSlotSize) {
+  pSlabPool->nSlotSize = getSlabSlotSize(nSlotSize);
+  pSlabPool->pFreeSlot = NULL;
+  pSlabPool->pBlocks = NULL;
+  pSlabPool->nBlockCount = 0;
+  pSlabPool->nBlockCapacity = 0;
+  pSlabPool->nUsedSlotCount = 0;
+  pSlabPool->nMaximumUsedSlotCount = 0;
+}
+
+/**
+ * Frees every block of the pool, along with every slot still in use.
+ * @param[in,out] pSlabPool The pool to close.
+ */
+void closeSlabPool(SlabPool *pSlabPool) {
+  for (int nBlockIndex = 0; nBlockIndex < pSlabPool->nBlockCount; nBlockIndex++) free(pSlabPool->pBlocks[nBlockIndex]);
+
+  free(pSlabPool->pBlocks);
+  openSlabPool(pSlabPool, pSlabPool->nSlotSize);
+}
+
+/**
+ * Allocates a new block and threads every slot in it onto the free list.
+ * @param[in,out] pSlabPool The pool to grow.
+ * @returns `0` if the pool has grown or `-1` if the block could not be allocated.
+ */
+static int growSlabPool(SlabPool *pSlabPool) {
+  if (pSlabPool->nBlockCount == pSlabPool->nBlockCapacity) {
+    int nBlockCapacity = pSlabPool->nBlockCapacity > 0 ? pSlabPool->nBlockCapacity * 2 : 16;
+    void **pBlocks = realloc(pSlabPool->pBlocks, sizeof(void *) * (size_t)nBlockCapacity);
+
+    if (pBlocks == NULL) return -1;
+
+    pSlabPool->pBlocks = pBlocks;
+    pSlabPool->nBlockCapacity = nBlockCapacity;
+  }
+
+  char *pBlock = malloc(pSlabPool->nSlotSize * SLAB_BLOCK_SLOT_COUNT);
+
+  if (pBlock == NULL) return -1;
+
+  // The slots are pushed in reverse, so they are handed out in the order they sit in memory.
+  for (int nSlotIndex = SLAB_BLOCK_SLOT_COUNT - 1; nSlotIndex >= 0; nSlotIndex--) {
+    void *pSlot = pBlock + pSlabPool->nSlotSize * (size_t)nSlotIndex;
+
+    *(void **)pSlot = pSlabPool->pFreeSlot;
+    pSlabPool->pFreeSlot = pSlot;
+  }
+
+  pSlabPool->pBlocks[pSlabPool->nBlockCount++] = pBlock;
+
+  return 0;
+}
+
+/**
+ * Takes a slot from the pool, allocating a new block of `SLAB_BLOCK_SLOT_COUNT` slots if every slot is in use.
+ * @param[in,out] pSlabPool The pool to take from.
+ * @returns The slot, whose contents are undefined, or `NULL` if a new block could not be allocated.
+ */
+void *allocateSlabSlot(SlabPool *pSlabPool) {
+  if (pSlabPool->pFreeSlot == NULL && growSlabPool(pSlabPool) != 0) return NULL;
+
+  void *pSlot = pSlabPool->pFreeSlot;
+
+  pSlabPool->pFreeSlot = *(void **)pSlot;
+  pSlabPool->nUsedSlotCount++;
+
+  if (pSlabPool->nUsedSlotCount > pSlabPool->nMaximumUsedSlotCount) {
+    pSlabPool->nMaximumUsedSlotCount = pSlabPool->nUsedSlotCount;
+  }
+
+  return pSlot;
+}
+
+/**
+ * Returns a slot to the pool.
+ * @param[in,out] pSlabPool The pool that the slot was taken from.
+ * @param pSlot The slot to return.
+ */
+void freeSlabSlot(SlabPool *pSlabPool, void *pSlot) {
+  *(void **)pSlot = pSlabPool->pFreeSlot;
+  pSlabPool->pFreeSlot = pSlot;
+  pSlabPool->nUsedSlotCount--;
+}
+
+/**
+ * Gets the number of slots that the pool has allocated, whether they are in use or not.
+ * @param pSlabPool The pool to inspect.
+ * @returns The number of slots.
+ */
+long getSlabSlotCount(const SlabPool *pSlabPool) { return (long)pSlabPool->nBlockCount * SLAB_BLOCK_SLOT_COUNT; }
+
+/**
+ * Sets up an arena without any chunks, whose chunks are taken from a pool of `ARENA_CHUNK_SIZE` slots.
+ * @param[out] pSessionArena The arena to set up.
+ */
+void openSessionArena(SessionArena *pSessionArena) {
+  pSessionArena->pFirstChunk = NULL;
+  pSessionArena->pLastChunk = NULL;
+  pSessionArena->nFirstChunkOffset = 0;
+}
+
+/**
+ * Appends the passed bytes to the arena, taking as many chunks from the pool as they need.
+ * @param[in,out] pSessionArena The arena to append to.
+ * @param[in,out] pChunkPool The pool of chunks.
+ * @param pBytes The bytes to append.
+ * @param nByteCount The number of bytes to append.
+ * @returns `0` if every byte was appended or `-1` if a chunk could not be allocated.
+ */
+int appendSessionArena(SessionArena *pSessionArena, SlabPool *pChunkPool, const char *pBytes, size_t nByteCount) {
+  size_t nChunkCapacity = ARENA_CHUNK_SIZE - sizeof(ArenaChunk);
+
+  while (nByteCount > 0) {
+    ArenaChunk *pChunk = pSessionArena->pLastChunk;
+
+    if (pChunk == NULL || pChunk->nLength == nChunkCapacity) {
+      if ((pChunk = allocateSlabSlot(pChunkPool)) == NULL) return -1;
+
+      pChunk->pNextChunk = NULL;
+      pChunk->nLength = 0;
+
+      if (pSessionArena->pLastChunk != NULL) {
+        pSessionArena->pLastChunk->pNextChunk = pChunk;
+      } else {
+        pSessionArena->pFirstChunk = pChunk;
+      }
+
+      pSessionArena->pLastChunk = pChunk;
+    }
+
+    size_t nCopiedCount = nChunkCapacity - pChunk->nLength < nByteCount ? nChunkCapacity - pChunk->nLength : nByteCount;
+
+    memcpy(pChunk->pBytes + pChunk->nLength, pBytes, nCopiedCount);
+    pChunk->nLength += nCopiedCount;
+    pBytes += nCopiedCount;
+    nByteCount -= nCopiedCount;
+  }
+
+  return 0;
+}
+
+/**
+ * Gets the bytes at the start of the arena that are held in a single chunk.
+ * @param pSessionArena The arena to inspect.
+ * @param[out] nByteCount The number of bytes, which is `0` if the arena is empty.
+ * @returns The first byte.
+ */
+const char *peekSessionArena(const SessionArena *pSessionArena, size_t *nByteCount) {
+  const ArenaChunk *pChunk = pSessionArena->pFirstChunk;
+
+  if (pChunk == NULL) {
+    *nByteCount = 0;
+
+    return NULL;
+  }
+
+  *nByteCount = pChunk->nLength - pSessionArena->nFirstChunkOffset;
+
+  return pChunk->pBytes + pSessionArena->nFirstChunkOffset;
+}
+
+/**
+ * Consumes bytes from the start of the arena, returning every chunk that has been fully consumed to the pool.
+ * @param[in,out] pSessionArena The arena to consume from.
+ * @param[in,out] pChunkPool The pool of chunks.
+ * @param nByteCount The number of bytes to consume, which must be at most what the arena holds.
+ */
+void consumeSessionArena(SessionArena *pSessionArena, SlabPool *pChunkPool, size_t nByteCount) {
+  while (pSessionArena->pFirstChunk != NULL) {
+    ArenaChunk *pChunk = pSessionArena->pFirstChunk;
+    size_t nChunkByteCount = pChunk->nLength - pSessionArena->nFirstChunkOffset;
+
+    if (nByteCount < nChunkByteCount) {
+      pSessionArena->nFirstChunkOffset += nByteCount;
+
+      return;
+    }
+
+    nByteCount -= nChunkByteCount;
+    pSessionArena->pFirstChunk = pChunk->pNextChunk;
+    pSessionArena->nFirstChunkOffset = 0;
+
+    if (pSessionArena->pFirstChunk == NULL) pSessionArena->pLastChunk = NULL;
+
+    freeSlabSlot(pChunkPool, pChunk);
+  }
+}
+
+/**
+ * Empties the arena, returning every chunk it holds to the pool.
+ * @param[in,out] pSessionArena The arena to empty.
+ * @param[in,out] pChunkPool The pool of chunks.
+ */
+void resetSessionArena(SessionArena *pSessionArena, SlabPool *pChunkPool) {
+  while (pSessionArena->pFirstChunk != NULL) {
+    ArenaChunk *pChunk = pSessionArena->pFirstChunk;
+
+    pSessionArena->pFirstChunk = pChunk->pNextChunk;
+    freeSlabSlot(pChunkPool, pChunk);
+  }
+
+  openSessionArena(pSessionArena);
+}
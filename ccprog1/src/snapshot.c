@@ -0,0 +1,295 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "snapshot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trading.h"
+#include "weather.h"
+
+#define GAME_SNAPSHOT_SIGNATURE "TDSS"
+#define GAME_SNAPSHOT_CHECKSUM_OFFSET (GAME_SNAPSHOT_SIZE - 4)
+
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+#define QUITTING_SNAPSHOT_FLAG 0x01
+#define NEW_STORM_SNAPSHOT_FLAG 0x02
+
+/**
+ * Writes the passed integer into a snapshot in little-endian byte order.
+ * @param[out] pSnapshotBytes The bytes of the snapshot.
+ * @param nOffset The offset of the field.
+ * @param nValue The integer to write.
+ * @param nByteCount The width of the field in bytes.
+ */
+static void putSnapshotField(uint8_t *pSnapshotBytes, int nOffset, uint64_t nValue, int nByteCount) {
+  for (int nByteIndex = 0; nByteIndex < nByteCount; nByteIndex++) {
+    pSnapshotBytes[nOffset + nByteIndex] = (uint8_t)(nValue >> (nByteIndex * 8));
+  }
+}
+
+/**
+ * Reads a little-endian integer from a snapshot.
+ * @param pSnapshotBytes The bytes of the snapshot.
+ * @param nOffset The offset of the field.
+ * @param nByteCount The width of the field in bytes.
+ * @returns The unsigned value of the field.
+ */
+static uint64_t getSnapshotField(const uint8_t *pSnapshotBytes, int nOffset, int nByteCount) {
+  uint64_t nValue = 0;
+
+  for (int nByteIndex = 0; nByteIndex < nByteCount; nByteIndex++) {
+    nValue |= (uint64_t)pSnapshotBytes[nOffset + nByteIndex] << (nByteIndex * 8);
+  }
+
+  return nValue;
+}
+
+/**
+ * Reads a signed 32-bit integer from a snapshot.
+ * @param pSnapshotBytes The bytes of the snapshot.
+ * @param nOffset The offset of the field.
+ * @returns The value of the field.
+ */
+static int getSignedSnapshotField(const uint8_t *pSnapshotBytes, int nOffset) {
+  uint32_t nValue = (uint32_t)getSnapshotField(pSnapshotBytes, nOffset, 4);
+
+  return nValue > INT32_MAX ? -(int)(UINT32_MAX - nValue) - 1 : (int)nValue;
+}
+
+/**
+ * Calculates the FNV-1a checksum of everything in a snapshot before its checksum.
+ * @param pSnapshotBytes The bytes of the snapshot.
+ * @returns The checksum.
+ */
+static uint32_t calculateSnapshotChecksum(const uint8_t *pSnapshotBytes) {
+  uint32_t nChecksum = FNV_OFFSET_BASIS;
+
+  for (int nByteIndex = 0; nByteIndex < GAME_SNAPSHOT_CHECKSUM_OFFSET; nByteIndex++) {
+    nChecksum = (nChecksum ^ pSnapshotBytes[nByteIndex]) * FNV_PRIME;
+  }
+
+  return nChecksum;
+}
+
+/**
+ * Encodes the passed game as a snapshot, a fixed-layout little-endian record that holds everything needed to resume
+ * the game, including the state of its random number generator, and ends with a checksum of the rest of the record.
+ * @param pGameState The game to encode.
+ * @param[out] pSnapshotBytes The `GAME_SNAPSHOT_SIZE` bytes of the snapshot.
+ * @returns `0` if the game was encoded or `-1` if one of its values does not fit in the snapshot's layout.
+ */
+int encodeGameSnapshot(const GameState *pGameState, uint8_t *pSnapshotBytes) {
+  const int nCargoValues[] = {pGameState->nShipCargoLimit,      pGameState->nShipCoconutCargoAmount,
+                              pGameState->nShipRiceCargoAmount, pGameState->nShipSilkCargoAmount,
+                              pGameState->nShipGunCargoAmount,  pGameState->nCoconutMarketPrice,
+                              pGameState->nRiceMarketPrice,     pGameState->nSilkMarketPrice,
+                              pGameState->nGunMarketPrice};
+  const int nCargoValueCount = sizeof(nCargoValues) / sizeof(nCargoValues[0]);
+
+  // The values that the engine keeps within small ranges are stored in one or two bytes.
+  for (int nValueIndex = 0; nValueIndex < nCargoValueCount; nValueIndex++) {
+    if (nCargoValues[nValueIndex] < 0 || nCargoValues[nValueIndex] > UINT16_MAX) return -1;
+  }
+
+  if (pGameState->nPlayerMerchantId < 0 || pGameState->nPlayerMerchantId > UINT16_MAX ||
+      pGameState->nPlayerTurns < 0 || pGameState->nPlayerTurns > UINT8_MAX || pGameState->nStormWindSignalNumber < 0 ||
+      pGameState->nStormWindSignalNumber > UINT8_MAX || pGameState->nStormTurnDuration < INT8_MIN ||
+      pGameState->nStormTurnDuration > INT8_MAX || pGameState->nPostponedDepartureChance < 0 ||
+      pGameState->nPostponedDepartureChance > UINT8_MAX) {
+    return -1;
+  }
+
+  memcpy(pSnapshotBytes, GAME_SNAPSHOT_SIGNATURE, 4);
+  putSnapshotField(pSnapshotBytes, 4, GAME_SNAPSHOT_VERSION, 1);
+  putSnapshotField(pSnapshotBytes, 5, (unsigned char)pGameState->cCurrentPortId, 1);
+  putSnapshotField(pSnapshotBytes, 6, (uint64_t)pGameState->nPlayerTurns, 1);
+  putSnapshotField(pSnapshotBytes, 7,
+                   (pGameState->bIsQuitting ? QUITTING_SNAPSHOT_FLAG : 0) |
+                     (pGameState->bIsNewStorm ? NEW_STORM_SNAPSHOT_FLAG : 0),
+                   1);
+  putSnapshotField(pSnapshotBytes, 8, (uint64_t)pGameState->nPlayerMerchantId, 2);
+  putSnapshotField(pSnapshotBytes, 10, (uint64_t)pGameState->nStormWindSignalNumber, 1);
+  putSnapshotField(pSnapshotBytes, 11, (uint8_t)(int8_t)pGameState->nStormTurnDuration, 1);
+  putSnapshotField(pSnapshotBytes, 12, (uint64_t)pGameState->nPostponedDepartureChance, 1);
+  putSnapshotField(pSnapshotBytes, 13, 0, 1);
+
+  for (int nValueIndex = 0; nValueIndex < nCargoValueCount; nValueIndex++) {
+    putSnapshotField(pSnapshotBytes, 14 + nValueIndex * 2, (uint64_t)nCargoValues[nValueIndex], 2);
+  }
+
+  putSnapshotField(pSnapshotBytes, 32, (uint32_t)pGameState->nPlayerInitialBalance, 4);
+  putSnapshotField(pSnapshotBytes, 36, (uint32_t)pGameState->nPlayerBalance, 4);
+  putSnapshotField(pSnapshotBytes, 40, (uint32_t)pGameState->nPlayerProfitTarget, 4);
+  putSnapshotField(pSnapshotBytes, 44, (uint32_t)pGameState->nPlayerProfit, 4);
+  putSnapshotField(pSnapshotBytes, 48, pGameState->randomGenerator.nState, 8);
+  putSnapshotField(pSnapshotBytes, 56, pGameState->randomGenerator.nIncrement, 8);
+  putSnapshotField(pSnapshotBytes, GAME_SNAPSHOT_CHECKSUM_OFFSET, calculateSnapshotChecksum(pSnapshotBytes), 4);
+
+  return 0;
+}
+
+/**
+ * Checks whether a decoded game is one that the engine could have reached, since the checksum only catches corruption
+ * and not a snapshot written with a forged checksum.
+ * @param pGameState The decoded game.
+ * @returns `1` if the game is valid or `0` if one of its values is out of range.
+ */
+static int isGameSnapshotValid(const GameState *pGameState) {
+  if (memchr(PORT_IDS, pGameState->cCurrentPortId, PORT_COUNT) == NULL || pGameState->nPlayerTurns < 0 ||
+      pGameState->nPlayerTurns >= MAXIMUM_PLAYER_TURNS) {
+    return 0;
+  }
+
+  if ((pGameState->nShipCargoLimit != TIER_ONE_SHIP_CARGO_LIMIT &&
+       pGameState->nShipCargoLimit != TIER_TWO_SHIP_CARGO_LIMIT &&
+       pGameState->nShipCargoLimit != TIER_THREE_SHIP_CARGO_LIMIT &&
+       pGameState->nShipCargoLimit != TIER_FOUR_SHIP_CARGO_LIMIT) ||
+      getShipTotalCargoAmount(pGameState) > pGameState->nShipCargoLimit) {
+    return 0;
+  }
+
+  // A storm lasts at most its maximum duration, and is at `-1` for the turn after it ends.
+  if (pGameState->nStormWindSignalNumber < 0 || pGameState->nStormWindSignalNumber > MAXIMUM_WIND_SIGNAL_NUMBER ||
+      pGameState->nStormTurnDuration < -1 || pGameState->nStormTurnDuration > MAXIMUM_STORM_TURN_DURATION ||
+      pGameState->nPostponedDepartureChance > 100) {
+    return 0;
+  }
+
+  const int nMarketPrices[CARGO_COUNT] = {pGameState->nCoconutMarketPrice, pGameState->nRiceMarketPrice,
+                                          pGameState->nSilkMarketPrice, pGameState->nGunMarketPrice};
+  int nPortIndex = getPortIndex(pGameState->cCurrentPortId);
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+    int nMinimumPrice = MINIMUM_CARGO_PRICES[nPortIndex][nCargoIndex];
+
+    if (nMarketPrices[nCargoIndex] < nMinimumPrice ||
+        nMarketPrices[nCargoIndex] >= nMinimumPrice + (int)CARGO_PRICE_RANGES[nPortIndex][nCargoIndex]) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * Decodes a snapshot written by `encodeGameSnapshot`.
+ * @param pSnapshotBytes The `GAME_SNAPSHOT_SIZE` bytes of the snapshot.
+ * @param[out] pGameState The resumed game.
+ * @returns `0` if the game was decoded or `-1` if the snapshot has another version, a wrong checksum, or a game that
+ * the engine could not have reached.
+ */
+int decodeGameSnapshot(const uint8_t *pSnapshotBytes, GameState *pGameState) {
+  if (memcmp(pSnapshotBytes, GAME_SNAPSHOT_SIGNATURE, 4) != 0 ||
+      getSnapshotField(pSnapshotBytes, 4, 1) != GAME_SNAPSHOT_VERSION ||
+      getSnapshotField(pSnapshotBytes, GAME_SNAPSHOT_CHECKSUM_OFFSET, 4) != calculateSnapshotChecksum(pSnapshotBytes)) {
+    return -1;
+  }
+
+  int nFlags = (int)getSnapshotField(pSnapshotBytes, 7, 1);
+
+  pGameState->cCurrentPortId = (char)getSnapshotField(pSnapshotBytes, 5, 1);
+  pGameState->nPlayerTurns = (int)getSnapshotField(pSnapshotBytes, 6, 1);
+  pGameState->bIsQuitting = (nFlags & QUITTING_SNAPSHOT_FLAG) != 0;
+  pGameState->bIsNewStorm = (nFlags & NEW_STORM_SNAPSHOT_FLAG) != 0;
+  pGameState->nPlayerMerchantId = (int)getSnapshotField(pSnapshotBytes, 8, 2);
+  pGameState->nStormWindSignalNumber = (int)getSnapshotField(pSnapshotBytes, 10, 1);
+  pGameState->nStormTurnDuration = (int8_t)getSnapshotField(pSnapshotBytes, 11, 1);
+  pGameState->nPostponedDepartureChance = (int)getSnapshotField(pSnapshotBytes, 12, 1);
+  pGameState->nShipCargoLimit = (int)getSnapshotField(pSnapshotBytes, 14, 2);
+  pGameState->nShipCoconutCargoAmount = (int)getSnapshotField(pSnapshotBytes, 16, 2);
+  pGameState->nShipRiceCargoAmount = (int)getSnapshotField(pSnapshotBytes, 18, 2);
+  pGameState->nShipSilkCargoAmount = (int)getSnapshotField(pSnapshotBytes, 20, 2);
+  pGameState->nShipGunCargoAmount = (int)getSnapshotField(pSnapshotBytes, 22, 2);
+  pGameState->nCoconutMarketPrice = (int)getSnapshotField(pSnapshotBytes, 24, 2);
+  pGameState->nRiceMarketPrice = (int)getSnapshotField(pSnapshotBytes, 26, 2);
+  pGameState->nSilkMarketPrice = (int)getSnapshotField(pSnapshotBytes, 28, 2);
+  pGameState->nGunMarketPrice = (int)getSnapshotField(pSnapshotBytes, 30, 2);
+  pGameState->nPlayerInitialBalance = getSignedSnapshotField(pSnapshotBytes, 32);
+  pGameState->nPlayerBalance = getSignedSnapshotField(pSnapshotBytes, 36);
+  pGameState->nPlayerProfitTarget = getSignedSnapshotField(pSnapshotBytes, 40);
+  pGameState->nPlayerProfit = getSignedSnapshotField(pSnapshotBytes, 44);
+  pGameState->randomGenerator.nState = getSnapshotField(pSnapshotBytes, 48, 8);
+  pGameState->randomGenerator.nIncrement = getSnapshotField(pSnapshotBytes, 56, 8);
+
+  return isGameSnapshotValid(pGameState) ? 0 : -1;
+}
+
+/**
+ * Saves the passed game to a snapshot file, which is written next to its final path and then renamed over it so that
+ * an interrupted save never leaves a partial snapshot behind.
+ * @param pGameState The game to save.
+ * @param strFilePath The path of the file to write.
+ * @returns `0` if the game was saved or `-1` if it could not be encoded or written.
+ */
+int saveGameSnapshot(const GameState *pGameState, const char *strFilePath) {
+  uint8_t nSnapshotBytes[GAME_SNAPSHOT_SIZE];
+
+  if (encodeGameSnapshot(pGameState, nSnapshotBytes) != 0) return -1;
+
+  size_t nTemporaryFilePathSize = strlen(strFilePath) + sizeof(".tmp");
+  char *strTemporaryFilePath = malloc(nTemporaryFilePathSize);
+
+  if (strTemporaryFilePath == NULL) return -1;
+
+  snprintf(strTemporaryFilePath, nTemporaryFilePathSize, "%s.tmp", strFilePath);
+
+  FILE *pFile = fopen(strTemporaryFilePath, "wb");
+  int bIsWritten = pFile != NULL && fwrite(nSnapshotBytes, 1, GAME_SNAPSHOT_SIZE, pFile) == GAME_SNAPSHOT_SIZE;
+
+  if (pFile != NULL && fclose(pFile) != 0) bIsWritten = 0;
+
+  // Windows cannot rename over an existing file, so the old snapshot is removed first there.
+#ifdef _WIN32
+  if (bIsWritten) remove(strFilePath);
+#endif
+
+  if (bIsWritten && rename(strTemporaryFilePath, strFilePath) != 0) bIsWritten = 0;
+
+  if (!bIsWritten && pFile != NULL) remove(strTemporaryFilePath);
+
+  free(strTemporaryFilePath);
+
+  return bIsWritten ? 0 : -1;
+}
+
+/**
+ * Loads a game saved by `saveGameSnapshot` with a single read.
+ * @param[out] pGameState The resumed game.
+ * @param strFilePath The path of the file to read.
+ * @returns `0` if the game was loaded or `-1` if the file could not be read or is not a valid snapshot.
+ */
+int loadGameSnapshot(GameState *pGameState, const char *strFilePath) {
+  uint8_t nSnapshotBytes[GAME_SNAPSHOT_SIZE + 1];
+  FILE *pFile = fopen(strFilePath, "rb");
+
+  if (pFile == NULL) return -1;
+
+  // Asking for one byte more than a snapshot also rejects files with anything after the snapshot.
+  size_t nReadByteCount = fread(nSnapshotBytes, 1, sizeof(nSnapshotBytes), pFile);
+
+  fclose(pFile);
+
+  if (nReadByteCount != GAME_SNAPSHOT_SIZE) return -1;
+
+  return decodeGameSnapshot(nSnapshotBytes, pGameState);
+}
@@ -0,0 +1,689 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "solver.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "prompts.h"
+#include "thread_pool.h"
+#include "weather.h"
+
+#define SOLVER_FILE_SIGNATURE "TIDESDP1"
+#define SOLVER_MAXIMUM_PRICE_RANGE 128
+#define SOLVER_MAXIMUM_BALANCE ((double)SOLVER_BALANCE_STEPS_PER_OCTAVE * (1 << SOLVER_BALANCE_OCTAVE_COUNT))
+#define SOLVER_LAYER_VALUE_COUNT \
+  ((long)PORT_COUNT * SOLVER_TIER_COUNT * SOLVER_HOLDING_COUNT * SOLVER_BALANCE_BUCKET_COUNT)
+
+#define STORM_DURATION_STATE_COUNT (MAXIMUM_STORM_TURN_DURATION + 2)
+
+/** The values of a single day that is being solved, which are shared by the workers computing it. */
+typedef struct {
+  SolvedPolicy *pSolvedPolicy;
+  int nDay;
+  float *pNavigationValues;
+  float *pSpendingValues;
+} SolverLayer;
+
+/**
+ * Gets the balance of the passed balance step.
+ * @param nBalanceIndex The index of the balance step.
+ * @returns A non-negative balance.
+ */
+static double getSolverBalance(int nBalanceIndex) {
+  if (nBalanceIndex < SOLVER_BALANCE_STEPS_PER_OCTAVE) return nBalanceIndex;
+
+  int nOctave = (nBalanceIndex - SOLVER_BALANCE_STEPS_PER_OCTAVE) / SOLVER_BALANCE_STEPS_PER_OCTAVE;
+  int nStep = (nBalanceIndex - SOLVER_BALANCE_STEPS_PER_OCTAVE) % SOLVER_BALANCE_STEPS_PER_OCTAVE;
+
+  return (double)(SOLVER_BALANCE_STEPS_PER_OCTAVE + nStep) * (1 << nOctave);
+}
+
+/**
+ * Gets the value of the passed balance by interpolating between the values of the two nearest balance steps. Balances
+ * above the last step are worth the value of the last step plus the difference, since extra gold is simply kept.
+ * @param pRow The values of every balance step.
+ * @param nBalance The balance.
+ * @returns The interpolated value.
+ */
+static double interpolateBalanceValue(const float *pRow, double nBalance) {
+  if (nBalance >= SOLVER_MAXIMUM_BALANCE) {
+    return pRow[SOLVER_BALANCE_BUCKET_COUNT - 1] + (nBalance - SOLVER_MAXIMUM_BALANCE);
+  }
+
+  int nBalanceIndex;
+  double nFraction;
+
+  if (nBalance < SOLVER_BALANCE_STEPS_PER_OCTAVE) {
+    nBalanceIndex = (int)nBalance;
+    nFraction = nBalance - nBalanceIndex;
+  } else {
+    int nExponent;
+    double nPosition = (2 * frexp(nBalance / SOLVER_BALANCE_STEPS_PER_OCTAVE, &nExponent) - 1) *
+                       SOLVER_BALANCE_STEPS_PER_OCTAVE;
+    int nStep = (int)nPosition;
+
+    nBalanceIndex = SOLVER_BALANCE_STEPS_PER_OCTAVE * nExponent + nStep;
+    nFraction = nPosition - nStep;
+  }
+
+  return pRow[nBalanceIndex] + (pRow[nBalanceIndex + 1] - pRow[nBalanceIndex]) * nFraction;
+}
+
+/**
+ * Gets the value of carrying the passed cargo by interpolating between the two nearest amount steps.
+ * @param pHoldingRows The values of every holding and balance step of a single port and ship tier.
+ * @param nCargoIndex The index of the carried cargo, which is ignored when no cargo is carried.
+ * @param nCargoAmount The amount of the carried cargo.
+ * @param nBalance The balance.
+ * @returns The interpolated value.
+ */
+static double interpolateHoldingValue(const float *pHoldingRows, int nCargoIndex, int nCargoAmount, double nBalance) {
+  if (nCargoAmount <= 0) return interpolateBalanceValue(pHoldingRows, nBalance);
+
+  int nAmountIndex = nCargoAmount / SOLVER_AMOUNT_STEP;
+  const float *pRow =
+    pHoldingRows + (long)(1 + nCargoIndex * SOLVER_AMOUNT_BUCKET_COUNT + nAmountIndex) * SOLVER_BALANCE_BUCKET_COUNT;
+  double nValue = interpolateBalanceValue(pRow, nBalance);
+
+  if (nAmountIndex >= SOLVER_AMOUNT_BUCKET_COUNT - 1) return nValue;
+
+  double nFraction = (double)(nCargoAmount - nAmountIndex * SOLVER_AMOUNT_STEP) / SOLVER_AMOUNT_STEP;
+
+  return nValue + (interpolateBalanceValue(pRow + SOLVER_BALANCE_BUCKET_COUNT, nBalance) - nValue) * nFraction;
+}
+
+/**
+ * Gets the values of every holding and balance step of a single day, port, and ship tier.
+ * @param pSolvedPolicy The policy to inspect.
+ * @param nDay The number of turns taken so far.
+ * @param nPortIndex The index of the port.
+ * @param nTier The ship tier, which is `0` for the smallest ship.
+ * @returns A pointer to the first value.
+ */
+static const float *getSolvedHoldingRows(const SolvedPolicy *pSolvedPolicy, int nDay, int nPortIndex, int nTier) {
+  return pSolvedPolicy->pValues +
+         (((long)nDay * PORT_COUNT + nPortIndex) * SOLVER_TIER_COUNT + nTier) * SOLVER_HOLDING_COUNT *
+           SOLVER_BALANCE_BUCKET_COUNT;
+}
+
+/**
+ * Gets the cost of upgrading the ship from the passed tier.
+ * @param nTier The ship tier, which is `0` for the smallest ship.
+ * @returns The upgrade cost or `0` if the ship is already in the highest tier.
+ */
+static int getTierUpgradeCost(int nTier) {
+  int nShipUpgradeCost;
+  int nShipNewCargoLimit;
+
+  if (!getShipUpgrade((nTier + 1) * TIER_ONE_SHIP_CARGO_LIMIT, &nShipUpgradeCost, &nShipNewCargoLimit)) return 0;
+
+  return nShipUpgradeCost;
+}
+
+/**
+ * Calculates the chance of a postponed departure on each day by following every possible storm from the calm first day.
+ * @param[out] nDepartureFailureChances The chance of each day, as a fraction.
+ */
+static void calculateDepartureFailureChances(float nDepartureFailureChances[MAXIMUM_PLAYER_TURNS]) {
+  // Indexed by the storm's remaining turn duration plus one, since `-1` marks the turn after a storm ends.
+  double nProbabilities[STORM_DURATION_STATE_COUNT][MAXIMUM_WIND_SIGNAL_NUMBER + 1] = {{0}};
+
+  nProbabilities[1][0] = 1;
+
+  for (int nDay = 0; nDay < MAXIMUM_PLAYER_TURNS; nDay++) {
+    double nNextProbabilities[STORM_DURATION_STATE_COUNT][MAXIMUM_WIND_SIGNAL_NUMBER + 1] = {{0}};
+    double nDepartureFailureChance = 0;
+
+    for (int nDurationIndex = 0; nDurationIndex < STORM_DURATION_STATE_COUNT; nDurationIndex++) {
+      for (int nSignal = 0; nSignal <= MAXIMUM_WIND_SIGNAL_NUMBER; nSignal++) {
+        double nProbability = nProbabilities[nDurationIndex][nSignal];
+        int nStormTurnDuration = nDurationIndex - 1;
+
+        if (nProbability == 0) continue;
+
+        if (nStormTurnDuration > 0) {
+          int nStormWindSignalNumber;
+          int nPostponedDepartureChance;
+
+          setStormStrength(&nStormWindSignalNumber, nSignal, &nPostponedDepartureChance);
+
+          nDepartureFailureChance += nProbability * nPostponedDepartureChance / 100;
+        }
+
+        if (nStormTurnDuration == -1) {
+          nNextProbabilities[1][nSignal] += nProbability;
+        } else if (nStormTurnDuration == 0) {
+          nNextProbabilities[1][nSignal] += nProbability / 2;
+
+          for (int nNewDuration = 1; nNewDuration <= MAXIMUM_STORM_TURN_DURATION; nNewDuration++) {
+            nNextProbabilities[nNewDuration + 1][1] += nProbability / 2 / MAXIMUM_STORM_TURN_DURATION;
+          }
+        } else if (nStormTurnDuration == 1) {
+          nNextProbabilities[0][nSignal] += nProbability;
+        } else if (nSignal < MAXIMUM_WIND_SIGNAL_NUMBER) {
+          nNextProbabilities[nDurationIndex - 1][nSignal] += nProbability / 2;
+          nNextProbabilities[nDurationIndex - 1][nSignal + 1] += nProbability / 2;
+        } else {
+          nNextProbabilities[nDurationIndex - 1][nSignal] += nProbability;
+        }
+      }
+    }
+
+    nDepartureFailureChances[nDay] = (float)nDepartureFailureChance;
+
+    memcpy(nProbabilities, nNextProbabilities, sizeof(nProbabilities));
+  }
+}
+
+/**
+ * Computes the value of a row of states right before sailing, which either stays in port because the departure was
+ * postponed or reaches the best other port.
+ * @param pContext The day being solved.
+ * @param nTaskIndex The index of the row, which combines the port, ship tier, and holding.
+ * @param nWorkerIndex The index of the worker computing the row.
+ */
+static void computeNavigationValues(void *pContext, long nTaskIndex, int nWorkerIndex) {
+  SolverLayer *pSolverLayer = pContext;
+  const SolvedPolicy *pSolvedPolicy = pSolverLayer->pSolvedPolicy;
+  int nHolding = nTaskIndex % SOLVER_HOLDING_COUNT;
+  int nTier = nTaskIndex / SOLVER_HOLDING_COUNT % SOLVER_TIER_COUNT;
+  int nPortIndex = nTaskIndex / SOLVER_HOLDING_COUNT / SOLVER_TIER_COUNT;
+  double nDepartureFailureChance = pSolvedPolicy->nDepartureFailureChances[pSolverLayer->nDay];
+  float *pRow = pSolverLayer->pNavigationValues + nTaskIndex * SOLVER_BALANCE_BUCKET_COUNT;
+  const float *pStayingRow = getSolvedHoldingRows(pSolvedPolicy, pSolverLayer->nDay + 1, nPortIndex, nTier) +
+                             (long)nHolding * SOLVER_BALANCE_BUCKET_COUNT;
+
+  (void)nWorkerIndex;
+
+  for (int nBalanceIndex = 0; nBalanceIndex < SOLVER_BALANCE_BUCKET_COUNT; nBalanceIndex++) {
+    double nBestSailingValue = 0;
+
+    for (int nOtherPortIndex = 0; nOtherPortIndex < PORT_COUNT; nOtherPortIndex++) {
+      if (nOtherPortIndex == nPortIndex) continue;
+
+      double nSailingValue =
+        getSolvedHoldingRows(pSolvedPolicy, pSolverLayer->nDay + 1, nOtherPortIndex,
+                             nTier)[(long)nHolding * SOLVER_BALANCE_BUCKET_COUNT + nBalanceIndex];
+
+      if (nSailingValue > nBestSailingValue) nBestSailingValue = nSailingValue;
+    }
+
+    pRow[nBalanceIndex] = (float)(nDepartureFailureChance * pStayingRow[nBalanceIndex] +
+                                  (1 - nDepartureFailureChance) * nBestSailingValue);
+  }
+}
+
+/**
+ * Computes the expected value of a state with an empty hold that may buy one cargo before sailing. The best purchase
+ * depends on all four market prices, so its expectation is taken over the sorted values of each cargo, where the chance
+ * that the best value is at most `v` is the product of each cargo's chance of being at most `v`.
+ * @param pContext The day being solved.
+ * @param nTaskIndex The index of the state, which combines the port, ship tier, and balance step.
+ * @param nWorkerIndex The index of the worker computing the state.
+ */
+static void computeSpendingValue(void *pContext, long nTaskIndex, int nWorkerIndex) {
+  SolverLayer *pSolverLayer = pContext;
+  int nBalanceIndex = nTaskIndex % SOLVER_BALANCE_BUCKET_COUNT;
+  int nTier = nTaskIndex / SOLVER_BALANCE_BUCKET_COUNT % SOLVER_TIER_COUNT;
+  int nPortIndex = nTaskIndex / SOLVER_BALANCE_BUCKET_COUNT / SOLVER_TIER_COUNT;
+  double nBalance = getSolverBalance(nBalanceIndex);
+  int nShipCargoLimit = (nTier + 1) * TIER_ONE_SHIP_CARGO_LIMIT;
+  const float *pHoldingRows = pSolverLayer->pNavigationValues + (long)(nPortIndex * SOLVER_TIER_COUNT + nTier) *
+                                                                   SOLVER_HOLDING_COUNT * SOLVER_BALANCE_BUCKET_COUNT;
+  double nIdleValue = pHoldingRows[nBalanceIndex];
+  double nValues[CARGO_COUNT][SOLVER_MAXIMUM_PRICE_RANGE];
+  int nPriceRanges[CARGO_COUNT];
+  int nPositions[CARGO_COUNT] = {0};
+  int nTotalCount = 0;
+
+  (void)nWorkerIndex;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+    nPriceRanges[nCargoIndex] = (int)CARGO_PRICE_RANGES[nPortIndex][nCargoIndex];
+    nTotalCount += nPriceRanges[nCargoIndex];
+
+    // Cheaper prices are usually worth more, so walking down from the highest price leaves the values nearly sorted.
+    for (int nPriceIndex = 0; nPriceIndex < nPriceRanges[nCargoIndex]; nPriceIndex++) {
+      int nCargoPrice = MINIMUM_CARGO_PRICES[nPortIndex][nCargoIndex] + nPriceRanges[nCargoIndex] - 1 - nPriceIndex;
+      int nCargoAmount = (int)(nBalance / nCargoPrice);
+      double nValue = nIdleValue;
+
+      if (nCargoAmount > nShipCargoLimit) nCargoAmount = nShipCargoLimit;
+
+      if (nCargoAmount > 0) {
+        nValue = interpolateHoldingValue(pHoldingRows, nCargoIndex, nCargoAmount,
+                                         nBalance - (double)nCargoAmount * nCargoPrice);
+      }
+
+      if (nValue < nIdleValue) nValue = nIdleValue;
+
+      int nSortedIndex = nPriceIndex;
+
+      while (nSortedIndex > 0 && nValues[nCargoIndex][nSortedIndex - 1] > nValue) {
+        nValues[nCargoIndex][nSortedIndex] = nValues[nCargoIndex][nSortedIndex - 1];
+        nSortedIndex--;
+      }
+
+      nValues[nCargoIndex][nSortedIndex] = nValue;
+    }
+  }
+
+  double nCumulativeChance = 0;
+  double nExpectedValue = 0;
+
+  for (int nCount = 0; nCount < nTotalCount; nCount++) {
+    int nLowestCargoIndex = -1;
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      if (nPositions[nCargoIndex] < nPriceRanges[nCargoIndex] &&
+          (nLowestCargoIndex == -1 || nValues[nCargoIndex][nPositions[nCargoIndex]] <
+                                        nValues[nLowestCargoIndex][nPositions[nLowestCargoIndex]])) {
+        nLowestCargoIndex = nCargoIndex;
+      }
+    }
+
+    double nValue = nValues[nLowestCargoIndex][nPositions[nLowestCargoIndex]++];
+    double nNextCumulativeChance = 1;
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      nNextCumulativeChance *= (double)nPositions[nCargoIndex] / nPriceRanges[nCargoIndex];
+    }
+
+    nExpectedValue += nValue * (nNextCumulativeChance - nCumulativeChance);
+    nCumulativeChance = nNextCumulativeChance;
+  }
+
+  pSolverLayer->pSpendingValues[nTaskIndex] = (float)nExpectedValue;
+}
+
+/**
+ * Computes the values of a row of states at the start of the day, before the market prices are known. A carried cargo
+ * is either kept or sold at its new price, after which the gold may be spent again.
+ * @param pContext The day being solved.
+ * @param nTaskIndex The index of the row, which combines the port, ship tier, and holding.
+ * @param nWorkerIndex The index of the worker computing the row.
+ */
+static void computeHoldingValues(void *pContext, long nTaskIndex, int nWorkerIndex) {
+  SolverLayer *pSolverLayer = pContext;
+  int nHolding = nTaskIndex % SOLVER_HOLDING_COUNT;
+  int nTier = nTaskIndex / SOLVER_HOLDING_COUNT % SOLVER_TIER_COUNT;
+  int nPortIndex = nTaskIndex / SOLVER_HOLDING_COUNT / SOLVER_TIER_COUNT;
+  float *pRow = pSolverLayer->pSolvedPolicy->pValues + (long)pSolverLayer->nDay * SOLVER_LAYER_VALUE_COUNT +
+                nTaskIndex * SOLVER_BALANCE_BUCKET_COUNT;
+  const float *pNavigationRow = pSolverLayer->pNavigationValues + nTaskIndex * SOLVER_BALANCE_BUCKET_COUNT;
+  const float *pSpendingRow =
+    pSolverLayer->pSpendingValues + (long)(nPortIndex * SOLVER_TIER_COUNT + nTier) * SOLVER_BALANCE_BUCKET_COUNT;
+
+  (void)nWorkerIndex;
+
+  if (nHolding == 0) {
+    memcpy(pRow, pSpendingRow, sizeof(float) * SOLVER_BALANCE_BUCKET_COUNT);
+
+    return;
+  }
+
+  int nCargoIndex = (nHolding - 1) / SOLVER_AMOUNT_BUCKET_COUNT;
+  int nCargoAmount = (nHolding - 1) % SOLVER_AMOUNT_BUCKET_COUNT * SOLVER_AMOUNT_STEP;
+  int nMinimumPrice = MINIMUM_CARGO_PRICES[nPortIndex][nCargoIndex];
+  int nPriceRange = (int)CARGO_PRICE_RANGES[nPortIndex][nCargoIndex];
+
+  for (int nBalanceIndex = 0; nBalanceIndex < SOLVER_BALANCE_BUCKET_COUNT; nBalanceIndex++) {
+    double nBalance = getSolverBalance(nBalanceIndex);
+    double nKeepingValue = pNavigationRow[nBalanceIndex];
+    double nValueSum = 0;
+
+    for (int nCargoPrice = nMinimumPrice; nCargoPrice < nMinimumPrice + nPriceRange; nCargoPrice++) {
+      double nSellingValue = interpolateBalanceValue(pSpendingRow, nBalance + (double)nCargoAmount * nCargoPrice);
+
+      nValueSum += nSellingValue > nKeepingValue ? nSellingValue : nKeepingValue;
+    }
+
+    pRow[nBalanceIndex] = (float)(nValueSum / nPriceRange);
+  }
+}
+
+/**
+ * Computes the expected final balance of every state by dynamic programming from the last day back to the first,
+ * where each day's states are computed in parallel.
+ * @param[out] pSolvedPolicy The policy to compute, which must be destroyed afterwards.
+ * @param nWorkerCount The number of worker threads to use.
+ * @returns `0` if the policy was computed or `-1` if it could not be allocated.
+ */
+int solveGame(SolvedPolicy *pSolvedPolicy, int nWorkerCount) {
+  SolverLayer solverLayer;
+  int nStatus = 0;
+
+  for (int nPortIndex = 0; nPortIndex < PORT_COUNT; nPortIndex++) {
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+      if (CARGO_PRICE_RANGES[nPortIndex][nCargoIndex] > SOLVER_MAXIMUM_PRICE_RANGE) return -1;
+    }
+  }
+
+  calculateDepartureFailureChances(pSolvedPolicy->nDepartureFailureChances);
+
+  pSolvedPolicy->pValues = malloc(sizeof(float) * SOLVER_VALUE_COUNT);
+  solverLayer.pSolvedPolicy = pSolvedPolicy;
+  solverLayer.pNavigationValues = malloc(sizeof(float) * SOLVER_LAYER_VALUE_COUNT);
+  solverLayer.pSpendingValues =
+    malloc(sizeof(float) * PORT_COUNT * SOLVER_TIER_COUNT * SOLVER_BALANCE_BUCKET_COUNT);
+
+  if (pSolvedPolicy->pValues == NULL || solverLayer.pNavigationValues == NULL ||
+      solverLayer.pSpendingValues == NULL) {
+    destroySolvedPolicy(pSolvedPolicy);
+    free(solverLayer.pNavigationValues);
+    free(solverLayer.pSpendingValues);
+
+    return -1;
+  }
+
+  // The game ends after the last day, where any cargo still carried is worthless.
+  float *pLastRow = pSolvedPolicy->pValues + (long)(SOLVER_DAY_COUNT - 1) * SOLVER_LAYER_VALUE_COUNT;
+
+  for (long nValueIndex = 0; nValueIndex < SOLVER_LAYER_VALUE_COUNT; nValueIndex++) {
+    pLastRow[nValueIndex] = (float)getSolverBalance(nValueIndex % SOLVER_BALANCE_BUCKET_COUNT);
+  }
+
+  for (int nDay = MAXIMUM_PLAYER_TURNS - 1; nDay >= 0 && nStatus == 0; nDay--) {
+    solverLayer.nDay = nDay;
+
+    nStatus |= runThreadPoolTasks((long)PORT_COUNT * SOLVER_TIER_COUNT * SOLVER_HOLDING_COUNT, nWorkerCount,
+                                  computeNavigationValues, &solverLayer);
+    nStatus |= runThreadPoolTasks((long)PORT_COUNT * SOLVER_TIER_COUNT * SOLVER_BALANCE_BUCKET_COUNT, nWorkerCount,
+                                  computeSpendingValue, &solverLayer);
+
+    // Upgrading leads to a state of the next tier, so the highest tiers are settled first.
+    for (int nPortIndex = 0; nPortIndex < PORT_COUNT; nPortIndex++) {
+      for (int nTier = SOLVER_TIER_COUNT - 2; nTier >= 0; nTier--) {
+        float *pRow =
+          solverLayer.pSpendingValues + (long)(nPortIndex * SOLVER_TIER_COUNT + nTier) * SOLVER_BALANCE_BUCKET_COUNT;
+        int nShipUpgradeCost = getTierUpgradeCost(nTier);
+
+        for (int nBalanceIndex = 0; nBalanceIndex < SOLVER_BALANCE_BUCKET_COUNT; nBalanceIndex++) {
+          double nBalance = getSolverBalance(nBalanceIndex);
+
+          if (nBalance < nShipUpgradeCost) continue;
+
+          double nUpgradingValue =
+            interpolateBalanceValue(pRow + SOLVER_BALANCE_BUCKET_COUNT, nBalance - nShipUpgradeCost);
+
+          if (nUpgradingValue > pRow[nBalanceIndex]) pRow[nBalanceIndex] = (float)nUpgradingValue;
+        }
+      }
+    }
+
+    nStatus |= runThreadPoolTasks((long)PORT_COUNT * SOLVER_TIER_COUNT * SOLVER_HOLDING_COUNT, nWorkerCount,
+                                  computeHoldingValues, &solverLayer);
+  }
+
+  free(solverLayer.pNavigationValues);
+  free(solverLayer.pSpendingValues);
+
+  if (nStatus != 0) {
+    destroySolvedPolicy(pSolvedPolicy);
+
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * Frees the values of the passed policy.
+ * @param[in,out] pSolvedPolicy The policy to free.
+ */
+void destroySolvedPolicy(SolvedPolicy *pSolvedPolicy) {
+  free(pSolvedPolicy->pValues);
+
+  pSolvedPolicy->pValues = NULL;
+}
+
+/**
+ * Writes the passed policy to a binary file, which stores floats in the machine's own byte order.
+ * @param pSolvedPolicy The policy to write.
+ * @param strFilePath The path of the file to write.
+ * @returns `0` if the policy was written or `-1` if it could not be.
+ */
+int saveSolvedPolicy(const SolvedPolicy *pSolvedPolicy, const char *strFilePath) {
+  FILE *pFile = fopen(strFilePath, "wb");
+  int32_t nDimensions[5] = {SOLVER_DAY_COUNT, PORT_COUNT, SOLVER_TIER_COUNT, SOLVER_HOLDING_COUNT,
+                            SOLVER_BALANCE_BUCKET_COUNT};
+
+  if (pFile == NULL) return -1;
+
+  int bIsWritten = fwrite(SOLVER_FILE_SIGNATURE, 1, 8, pFile) == 8 &&
+                   fwrite(nDimensions, sizeof(nDimensions), 1, pFile) == 1 &&
+                   fwrite(pSolvedPolicy->nDepartureFailureChances,
+                          sizeof(pSolvedPolicy->nDepartureFailureChances), 1, pFile) == 1 &&
+                   fwrite(pSolvedPolicy->pValues, sizeof(float), SOLVER_VALUE_COUNT, pFile) == SOLVER_VALUE_COUNT;
+
+  if (fclose(pFile) != 0) bIsWritten = 0;
+
+  return bIsWritten ? 0 : -1;
+}
+
+/**
+ * Reads a policy written by `saveSolvedPolicy`.
+ * @param[out] pSolvedPolicy The policy to read, which must be destroyed afterwards.
+ * @param strFilePath The path of the file to read.
+ * @returns `0` if the policy was read or `-1` if the file could not be read or has other dimensions.
+ */
+int loadSolvedPolicy(SolvedPolicy *pSolvedPolicy, const char *strFilePath) {
+  FILE *pFile = fopen(strFilePath, "rb");
+  char strSignature[8];
+  int32_t nDimensions[5];
+  int32_t nExpectedDimensions[5] = {SOLVER_DAY_COUNT, PORT_COUNT, SOLVER_TIER_COUNT, SOLVER_HOLDING_COUNT,
+                                    SOLVER_BALANCE_BUCKET_COUNT};
+
+  pSolvedPolicy->pValues = NULL;
+
+  if (pFile == NULL) return -1;
+
+  int bIsRead = fread(strSignature, 1, 8, pFile) == 8 && memcmp(strSignature, SOLVER_FILE_SIGNATURE, 8) == 0 &&
+                fread(nDimensions, sizeof(nDimensions), 1, pFile) == 1 &&
+                memcmp(nDimensions, nExpectedDimensions, sizeof(nDimensions)) == 0 &&
+                fread(pSolvedPolicy->nDepartureFailureChances, sizeof(pSolvedPolicy->nDepartureFailureChances), 1,
+                      pFile) == 1;
+
+  if (bIsRead) {
+    pSolvedPolicy->pValues = malloc(sizeof(float) * SOLVER_VALUE_COUNT);
+
+    bIsRead = pSolvedPolicy->pValues != NULL &&
+              fread(pSolvedPolicy->pValues, sizeof(float), SOLVER_VALUE_COUNT, pFile) == SOLVER_VALUE_COUNT;
+  }
+
+  fclose(pFile);
+
+  if (!bIsRead) {
+    destroySolvedPolicy(pSolvedPolicy);
+
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * Gets the expected final balance of a new game when it is played with the passed policy.
+ * @param pSolvedPolicy The policy to inspect.
+ * @param nPlayerInitialBalance The player's initial gold coin balance.
+ * @returns The expected final balance, interpolated between the nearest balance steps.
+ */
+double getSolvedExpectedBalance(const SolvedPolicy *pSolvedPolicy, int nPlayerInitialBalance) {
+  return interpolateBalanceValue(getSolvedHoldingRows(pSolvedPolicy, 0, getPortIndex(INITIAL_PORT_ID), 0),
+                                 nPlayerInitialBalance);
+}
+
+/**
+ * Gets the expected final balance of sailing with the passed holding, which also picks the best port to sail to.
+ * @param pSolvedPolicy The policy to inspect.
+ * @param pGameState The game that is sailing.
+ * @param nTier The ship tier, which is `0` for the smallest ship.
+ * @param nCargoIndex The index of the carried cargo.
+ * @param nCargoAmount The amount of the carried cargo.
+ * @param nBalance The balance.
+ * @param[out] pPortIndex The index of the best port to sail to, which can be `NULL`.
+ * @returns The expected final balance.
+ */
+static double getSolvedSailingValue(const SolvedPolicy *pSolvedPolicy, const GameState *pGameState, int nTier,
+                                    int nCargoIndex, int nCargoAmount, double nBalance, int *pPortIndex) {
+  int nDay = pGameState->nPlayerTurns;
+  int nCurrentPortIndex = getPortIndex(pGameState->cCurrentPortId);
+  double nDepartureFailureChance = pSolvedPolicy->nDepartureFailureChances[nDay];
+  double nBestSailingValue = -1;
+
+  for (int nPortIndex = 0; nPortIndex < PORT_COUNT; nPortIndex++) {
+    if (nPortIndex == nCurrentPortIndex) continue;
+
+    double nSailingValue = interpolateHoldingValue(getSolvedHoldingRows(pSolvedPolicy, nDay + 1, nPortIndex, nTier),
+                                                   nCargoIndex, nCargoAmount, nBalance);
+
+    if (nSailingValue > nBestSailingValue) {
+      nBestSailingValue = nSailingValue;
+
+      if (pPortIndex != NULL) *pPortIndex = nPortIndex;
+    }
+  }
+
+  double nStayingValue =
+    interpolateHoldingValue(getSolvedHoldingRows(pSolvedPolicy, nDay + 1, nCurrentPortIndex, nTier), nCargoIndex,
+                            nCargoAmount, nBalance);
+
+  return nDepartureFailureChance * nStayingValue + (1 - nDepartureFailureChance) * nBestSailingValue;
+}
+
+/**
+ * Gets the expected final balance of spending the passed balance with an empty hold at the current market prices,
+ * which is either sailing empty, buying as much of a single cargo as possible, or upgrading the ship first.
+ * @param pSolvedPolicy The policy to inspect.
+ * @param pGameState The game that is spending.
+ * @param nTier The ship tier, which is `0` for the smallest ship.
+ * @param nBalance The balance.
+ * @param[out] pAction The first action of the best choice.
+ * @returns The expected final balance.
+ */
+static double getSolvedSpendingValue(const SolvedPolicy *pSolvedPolicy, const GameState *pGameState, int nTier,
+                                     int nBalance, GameAction *pAction) {
+  int nShipCargoLimit = (nTier + 1) * TIER_ONE_SHIP_CARGO_LIMIT;
+  int nShipUpgradeCost = getTierUpgradeCost(nTier);
+  double nBestValue = getSolvedSailingValue(pSolvedPolicy, pGameState, nTier, 0, 0, nBalance, NULL);
+
+  pAction->cActionId = NAVIGATE_ACTION_ID;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+    int nCargoPrice = getCargoMarketPrice(pGameState, CARGO_IDS[nCargoIndex]);
+    int nCargoAmount = nBalance / nCargoPrice;
+
+    if (nCargoAmount > nShipCargoLimit) nCargoAmount = nShipCargoLimit;
+
+    if (nCargoAmount <= 0) continue;
+
+    double nValue = getSolvedSailingValue(pSolvedPolicy, pGameState, nTier, nCargoIndex, nCargoAmount,
+                                          nBalance - nCargoAmount * nCargoPrice, NULL);
+
+    if (nValue > nBestValue) {
+      nBestValue = nValue;
+
+      pAction->cActionId = BUY_ACTION_ID;
+      pAction->cCargoId = CARGO_IDS[nCargoIndex];
+      pAction->nCargoAmount = nCargoAmount;
+    }
+  }
+
+  if (nShipUpgradeCost > 0 && nBalance >= nShipUpgradeCost) {
+    GameAction upgradedAction;
+    double nValue = getSolvedSpendingValue(pSolvedPolicy, pGameState, nTier + 1, nBalance - nShipUpgradeCost,
+                                           &upgradedAction);
+
+    if (nValue > nBestValue) {
+      nBestValue = nValue;
+
+      pAction->cActionId = UPGRADE_ACTION_ID;
+    }
+  }
+
+  return nBestValue;
+}
+
+/**
+ * Chooses the action with the highest expected final balance, which compares every sale, upgrade, and purchase at the
+ * current market prices against the values of the next day.
+ * @param pSolvedPolicy The policy to play with.
+ * @param pGameState The game to choose an action for.
+ * @returns A valid action.
+ */
+GameAction chooseSolvedAction(const SolvedPolicy *pSolvedPolicy, const GameState *pGameState) {
+  GameAction action = {0};
+  int nTier = pGameState->nShipCargoLimit / TIER_ONE_SHIP_CARGO_LIMIT - 1;
+  int nHeldCargoIndex = -1;
+  int nHeldCargoAmount = 0;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+    int nShipCargoAmount = getShipCargoAmount(pGameState, CARGO_IDS[nCargoIndex]);
+
+    if (nShipCargoAmount == 0) continue;
+
+    // The policy only ever carries a single cargo, so any other cargo is sold first.
+    if (nHeldCargoIndex != -1) {
+      action.cActionId = SELL_ACTION_ID;
+      action.cCargoId = CARGO_IDS[nCargoIndex];
+      action.nCargoAmount = nShipCargoAmount;
+
+      return action;
+    }
+
+    nHeldCargoIndex = nCargoIndex;
+    nHeldCargoAmount = nShipCargoAmount;
+  }
+
+  if (nHeldCargoIndex == -1) {
+    getSolvedSpendingValue(pSolvedPolicy, pGameState, nTier, pGameState->nPlayerBalance, &action);
+  } else {
+    char cHeldCargoId = CARGO_IDS[nHeldCargoIndex];
+    GameAction spendingAction;
+    double nKeepingValue = getSolvedSailingValue(pSolvedPolicy, pGameState, nTier, nHeldCargoIndex, nHeldCargoAmount,
+                                                 pGameState->nPlayerBalance, NULL);
+    double nSellingValue = getSolvedSpendingValue(
+      pSolvedPolicy, pGameState, nTier,
+      pGameState->nPlayerBalance + nHeldCargoAmount * getCargoMarketPrice(pGameState, cHeldCargoId), &spendingAction);
+
+    action.cActionId = NAVIGATE_ACTION_ID;
+
+    if (nSellingValue > nKeepingValue) {
+      action.cActionId = SELL_ACTION_ID;
+      action.cCargoId = cHeldCargoId;
+      action.nCargoAmount = nHeldCargoAmount;
+
+      return action;
+    }
+  }
+
+  if (action.cActionId == NAVIGATE_ACTION_ID) {
+    int nPortIndex = 0;
+
+    getSolvedSailingValue(pSolvedPolicy, pGameState, nTier, nHeldCargoIndex, nHeldCargoAmount,
+                          pGameState->nPlayerBalance, &nPortIndex);
+
+    action.cPortId = PORT_IDS[nPortIndex];
+  }
+
+  return action;
+}
@@ -20,43 +20,36 @@
 
 #include <stdio.h>
 
+#include "art_assets.h"
 #include "console.h"
+#include "frame.h"
 #include "prompts.h"
 #include "trading.h"
 
 /** Prints out a pre-formatted separator line to the console. */
 void printSeparator(void) {
-  printf("\n\n\n");
+  beginFrame();
 
-  for (int nPrintedDashCount = 0; nPrintedDashCount < CONSOLE_MAX_WIDTH; nPrintedDashCount++) printf("━");
+  appendArtAsset(SEPARATOR_ART_ASSET);
 
-  printf("\n\n\n\n");
+  emitFrame();
 }
 
 /** Prints out the game's start screen, which contains the game's title, to the console. */
 void printGameStartScreen(void) {
+  beginFrame();
+
   printSeparator();
 
-  printf(
-    "     ███      ▄█  ████████▄     ▄████████    ▄████████       ▄██████▄     ▄████████        ▄▄▄▄███▄▄▄▄      ▄████████ ███▄▄▄▄    ▄█   ▄█          ▄████████\n"
-    " ▀█████████▄ ███  ███   ▀███   ███    ███   ███    ███      ███    ███   ███    ███      ▄██▀▀▀███▀▀▀██▄   ███    ███ ███▀▀▀██▄ ███  ███         ███    ███\n"
-    "    ▀███▀▀██ ███▌ ███    ███   ███    █▀    ███    █▀       ███    ███   ███    █▀       ███   ███   ███   ███    ███ ███   ███ ███▌ ███         ███    ███\n"
-    "     ███   ▀ ███▌ ███    ███  ▄███▄▄▄       ███             ███    ███  ▄███▄▄▄          ███   ███   ███   ███    ███ ███   ███ ███▌ ███         ███    ███\n"
-    "     ███     ███▌ ███    ███ ▀▀███▀▀▀     ▀███████████      ███    ███ ▀▀███▀▀▀          ███   ███   ███ ▀███████████ ███   ███ ███▌ ███       ▀███████████\n"
-    "     ███     ███  ███    ███   ███    █▄           ███      ███    ███   ███             ███   ███   ███   ███    ███ ███   ███ ███  ███         ███    ███\n"
-    "     ███     ███  ███   ▄███   ███    ███    ▄█    ███      ███    ███   ███             ███   ███   ███   ███    ███ ███   ███ ███  ███▌    ▄   ███    ███\n"
-    "    ▄████▀   █▀   ████████▀    ██████████  ▄████████▀        ▀██████▀    ███              ▀█   ███   █▀    ███    █▀   ▀█   █▀  █▀   █████▄▄██   ███    █▀\n"
-    "                                                                                                                                     ▀\n");
-
-  printf("\n");
-
-  printf(
-    "                                    ▗▄▖     ▗▖  ▗▖▗▄▄▄▖▗▄▄▖  ▗▄▄▖▗▖ ▗▖ ▗▄▖ ▗▖  ▗▖▗▄▄▄▖▗▄▄▖    ▗▄▄▄▖ ▗▖ ▗▖▗▄▄▄▖ ▗▄▄▖▗▄▄▄▖\n"
-    "                                   ▐▌ ▐▌    ▐▛▚▞▜▌▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▐▌▐▛▚▖▐▌  █ ▐▌       ▐▌ ▐▌ ▐▌ ▐▌▐▌   ▐▌     █\n"
-    "                                   ▐▛▀▜▌    ▐▌  ▐▌▐▛▀▀▘▐▛▀▚▖▐▌   ▐▛▀▜▌▐▛▀▜▌▐▌ ▝▜▌  █  ▝▀▚▖    ▐▌ ▐▌ ▐▌ ▐▌▐▛▀▀▘ ▝▀▚▖  █\n"
-    "                                   ▐▌ ▐▌    ▐▌  ▐▌▐▙▄▄▖▐▌ ▐▌▝▚▄▄▖▐▌ ▐▌▐▌ ▐▌▐▌  ▐▌  █ ▗▄▄▞▘    ▐▙▄▟▙▖▝▚▄▞▘▐▙▄▄▖▗▄▄▞▘  █\n");
-
-  printf("\n\n\n\n\n");
+  appendArtAsset(GAME_TITLE_ART_ASSET);
+
+  appendFrameText("\n");
+
+  appendArtAsset(GAME_SUBTITLE_ART_ASSET);
+
+  appendFrameText("\n\n\n\n\n");
+
+  emitFrame();
 }
 
 /**
@@ -64,65 +57,19 @@ void printGameStartScreen(void) {
  * @param nShipCargoLimit The maximum amount of cargo that the ship can carry.
  */
 void printShipSprite(int nShipCargoLimit) {
+  beginFrame();
+
   if (nShipCargoLimit <= TIER_ONE_SHIP_CARGO_LIMIT) {
-    printf(
-      "                                                               ~~~\n"
-      "                                                          ~~~~     ~~~~        |\n"
-      "                                                               ~~~            /|\n"
-      "                                                                             / |\\\n"
-      "                                                                            /  | \\\n"
-      "                                                                           /   |  \\\n"
-      "                                                                          /    |   \\\n"
-      "                                                                         /     |____\\\n"
-      "                                                                   _____/______|_________\n"
-      "                                                                    \\__________________/\n"
-      "                                                            ~~..             ...~~~.           ....~~~...\n");
+    appendArtAsset(TIER_ONE_SHIP_ART_ASSET);
   } else if (nShipCargoLimit <= TIER_TWO_SHIP_CARGO_LIMIT) {
-    printf(
-      "                                                          ~~~\n"
-      "                                                     ~~~~     ~~~~       |\n"
-      "                                                          ~~~          -----        |\n"
-      "                                                                       )___(        |\\\n"
-      "                                                                         |          | \\\n"
-      "                                                                      -------       |  \\\n"
-      "                                                                     /       \\      |   \\\n"
-      "                                                                    /_________\\     |____\\\n"
-      "                                                              ___________|__________|_________\n"
-      "                                                               \\____________________________/\n"
-      "                                                       ~~..             ...~~~.           ....~~~...     ..~\n");
+    appendArtAsset(TIER_TWO_SHIP_ART_ASSET);
   } else if (nShipCargoLimit <= TIER_THREE_SHIP_CARGO_LIMIT) {
-    printf(
-      "                                                      ~~~             |\n"
-      "                                                 ~~~~     ~~~~      -----              |\n"
-      "                                                      ~~~           )___(            -----\n"
-      "                                                                      |              )___(\n"
-      "                                                                  ---------            |\n"
-      "                                                                 /         \\        -------\n"
-      "                                                                /           \\      /       \\\n"
-      "                                                               /_____________\\    /_________\\\n"
-      "                                                          ____________|________________|__________\n"
-      "                                                           \\_                                  _/\n"
-      "                                                             \\________________________________/\n"
-      "                                                   ~~..             ...~~~.           ....~~~...     ..~\n");
+    appendArtAsset(TIER_THREE_SHIP_ART_ASSET);
   } else {
-    printf(
-      "                                                   ~~~             |\n"
-      "                                              ~~~~     ~~~~      -----                    |\n"
-      "                                                   ~~~           )___(                  -----\n"
-      "                                                                   |                    )___(\n"
-      "                                                               ---------                  |\n"
-      "                                                              /         \\              -------\n"
-      "                                                             /___________\\            /       \\\n"
-      "                                                                   |                 /_________\\\n"
-      "                                                            ---------------               |\n"
-      "                                                           /               \\        -------------\n"
-      "                                                          /                 \\      /             \\\n"
-      "                                                         /___________________\\    /_______________\\\n"
-      "                                                       ____________|______________________|__________\n"
-      "                                                        \\_                                        _/\n"
-      "                                                          \\______________________________________/\n"
-      "                                                   ~~..             ...~~~.           ....~~~...     ..~\n");
+    appendArtAsset(TIER_FOUR_SHIP_ART_ASSET);
   }
+
+  emitFrame();
 }
 
 /**
@@ -152,54 +99,36 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerMerchantId, int
                      int nShipCoconutCargoAmount, int nShipRiceCargoAmount, int nShipSilkCargoAmount,
                      int nShipGunCargoAmount, int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice,
                      int nGunMarketPrice) {
+  beginFrame();
+
   printSeparator();
 
   switch (cPortId) {
     case 'T': {
-      printf(
-        "                                                        ████████  ██████  ███    ██ ██████   ██████\n"
-        "                                                           ██    ██    ██ ████   ██ ██   ██ ██    ██\n"
-        "                                                           ██    ██    ██ ██ ██  ██ ██   ██ ██    ██\n"
-        "                                                           ██    ██    ██ ██  ██ ██ ██   ██ ██    ██\n"
-        "                                                           ██     ██████  ██   ████ ██████   ██████\n");
+      appendArtAsset(TONDO_BANNER_ART_ASSET);
 
       break;
     }
     case 'M': {
-      printf(
-        "                                                      ███    ███  █████  ███    ██ ██ ██       █████\n"
-        "                                                      ████  ████ ██   ██ ████   ██ ██ ██      ██   ██\n"
-        "                                                      ██ ████ ██ ███████ ██ ██  ██ ██ ██      ███████\n"
-        "                                                      ██  ██  ██ ██   ██ ██  ██ ██ ██ ██      ██   ██\n"
-        "                                                      ██      ██ ██   ██ ██   ████ ██ ███████ ██   ██\n");
+      appendArtAsset(MANILA_BANNER_ART_ASSET);
 
       break;
     }
     case 'P': {
-      printf(
-        "                                            ██████   █████  ███    ██ ██████   █████  ██   ██  █████  ███    ██\n"
-        "                                            ██   ██ ██   ██ ████   ██ ██   ██ ██   ██ ██  ██  ██   ██ ████   ██\n"
-        "                                            ██████  ███████ ██ ██  ██ ██   ██ ███████ █████   ███████ ██ ██  ██\n"
-        "                                            ██      ██   ██ ██  ██ ██ ██   ██ ██   ██ ██  ██  ██   ██ ██  ██ ██\n"
-        "                                            ██      ██   ██ ██   ████ ██████  ██   ██ ██   ██ ██   ██ ██   ████\n");
+      appendArtAsset(PANDAKAN_BANNER_ART_ASSET);
 
       break;
     }
     case 'S': {
-      printf(
-        "                                                                   ███████  █████  ██████   █████\n"
-        "                                                                   ██      ██   ██ ██   ██ ██   ██\n"
-        "                                                                   ███████ ███████ ██████  ███████\n"
-        "                                                                        ██ ██   ██ ██      ██   ██\n"
-        "                                                                   ███████ ██   ██ ██      ██   ██\n");
+      appendArtAsset(SAPA_BANNER_ART_ASSET);
 
       break;
     }
   }
 
-  printf("\n\n");
+  appendFrameText("\n\n");
 
-  printf(
+  appendFrameFormat(
     "   • Merchant ID: %3d                                                                                              • Balance: %d Gold Coins\n"
     "   • Profit:",
     nPlayerMerchantId, nPlayerBalance);
@@ -210,18 +139,18 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerMerchantId, int
     setConsoleColorToRed();
   }
 
-  printf(" %d%%\n", nPlayerProfit);
+  appendFrameFormat(" %d%%\n", nPlayerProfit);
   resetConsoleColor();
 
-  printf("   • Target Profit %d%%\n", nPlayerProfitTarget);
+  appendFrameFormat("   • Target Profit %d%%\n", nPlayerProfitTarget);
 
-  printf("\n\n");
+  appendFrameText("\n\n");
 
   printShipSprite(nShipCargoLimit);
 
-  printf("\n\n");
+  appendFrameText("\n\n");
 
-  printf(
+  appendFrameFormat(
     "   ║                                    ║                                                                          ║                                    ║\n"
     " ==X====================================X==                                                                      ==X====================================X==\n"
     "   ║    Total Cargo    |   %3d of %3d   ║                                                                          ║   Market Prices   |  Day %2d of 30  ║\n"
@@ -234,7 +163,9 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerMerchantId, int
     nCoconutMarketPrice, nSilkMarketPrice, nShipRiceCargoAmount, nShipGunCargoAmount, nRiceMarketPrice,
     nGunMarketPrice);
 
-  printf("\n\n\n");
+  appendFrameText("\n\n\n");
+
+  emitFrame();
 }
 
 /**
@@ -248,135 +179,112 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerMerchantId, int
  * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
  */
 void printTransactionScreen(char cTransactionType, char cCargoId, int nCargoAmount, int nCargoPrice) {
+  beginFrame();
+
   printSeparator();
 
   int nConsoleLeftPaddingSize;
 
   if (cCargoId == 'C') {
     if (cTransactionType == BUY_ACTION_ID) {
-      printf(
-        "                                         ▗▄▄▖ ▗▄▖  ▗▄▄▖ ▗▄▖ ▗▖  ▗▖▗▖ ▗▖▗▄▄▄▖ ▗▄▄▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
-        "                                        ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌ ▐▌  █  ▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
-        "                                        ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▝▜▌▐▌ ▐▌  █   ▝▀▚▖    ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
-        "                                        ▝▚▄▄▖▝▚▄▞▘▝▚▄▄▖▝▚▄▞▘▐▌  ▐▌▝▚▄▞▘  █  ▗▄▄▞▘    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n");
+      appendArtAsset(COCONUTS_BOUGHT_BANNER_ART_ASSET);
 
-      printf("\n\n");
+      appendFrameText("\n\n");
 
       nConsoleLeftPaddingSize = 40;
 
       setConsoleColorToGreen();
-      printf("%*c• You added %d coconuts to the ship's storage!\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
+      appendFrameFormat("%*c• You added %d coconuts to the ship's storage!\n", nConsoleLeftPaddingSize, ' ',
+                        nCargoAmount);
     } else {
-      printf(
-        "                                              ▗▄▄▖ ▗▄▖  ▗▄▄▖ ▗▄▖ ▗▖  ▗▖▗▖ ▗▖▗▄▄▄▖ ▗▄▄▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
-        "                                             ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌ ▐▌  █  ▐▌       ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
-        "                                             ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▝▜▌▐▌ ▐▌  █   ▝▀▚▖     ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
-        "                                             ▝▚▄▄▖▝▚▄▞▘▝▚▄▄▖▝▚▄▞▘▐▌  ▐▌▝▚▄▞▘  █  ▗▄▄▞▘    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n");
+      appendArtAsset(COCONUTS_SOLD_BANNER_ART_ASSET);
 
-      printf("\n\n");
+      appendFrameText("\n\n");
 
       nConsoleLeftPaddingSize = 45;
 
       setConsoleColorToRed();
-      printf("%*c• You removed %d coconuts from the ship's storage.\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
+      appendFrameFormat("%*c• You removed %d coconuts from the ship's storage.\n", nConsoleLeftPaddingSize, ' ',
+                        nCargoAmount);
     }
   } else if (cCargoId == 'R') {
     if (cTransactionType == BUY_ACTION_ID) {
-      printf(
-        "                                                   ▗▄▄▖ ▗▄▄▄▖ ▗▄▄▖▗▄▄▄▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
-        "                                                   ▐▌ ▐▌  █  ▐▌   ▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
-        "                                                   ▐▛▀▚▖  █  ▐▌   ▐▛▀▀▘    ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
-        "                                                   ▐▌ ▐▌▗▄█▄▖▝▚▄▄▖▐▙▄▄▖    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n");
+      appendArtAsset(RICE_BOUGHT_BANNER_ART_ASSET);
 
-      printf("\n\n");
+      appendFrameText("\n\n");
 
       nConsoleLeftPaddingSize = 51;
 
       setConsoleColorToGreen();
-      printf("%*c• You added %d rice to the ship's storage!\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
+      appendFrameFormat("%*c• You added %d rice to the ship's storage!\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
     } else {
-      printf(
-        "                                                        ▗▄▄▖ ▗▄▄▄▖ ▗▄▄▖▗▄▄▄▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
-        "                                                        ▐▌ ▐▌  █  ▐▌   ▐▌       ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
-        "                                                        ▐▛▀▚▖  █  ▐▌   ▐▛▀▀▘     ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
-        "                                                        ▐▌ ▐▌▗▄█▄▖▝▚▄▄▖▐▙▄▄▖    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n");
+      appendArtAsset(RICE_SOLD_BANNER_ART_ASSET);
 
-      printf("\n\n");
+      appendFrameText("\n\n");
 
       nConsoleLeftPaddingSize = 56;
 
       setConsoleColorToRed();
-      printf("%*c• You removed %d rice from the ship's storage.\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
+      appendFrameFormat("%*c• You removed %d rice from the ship's storage.\n", nConsoleLeftPaddingSize, ' ',
+                        nCargoAmount);
     }
   } else if (cCargoId == 'S') {
     if (cTransactionType == BUY_ACTION_ID) {
-      printf(
-        "                                                    ▗▄▄▖▗▄▄▄▖▗▖   ▗▖ ▗▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
-        "                                                   ▐▌     █  ▐▌   ▐▌▗▞▘    ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
-        "                                                    ▝▀▚▖  █  ▐▌   ▐▛▚▖     ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
-        "                                                   ▗▄▄▞▘▗▄█▄▖▐▙▄▄▖▐▌ ▐▌    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n");
+      appendArtAsset(SILK_BOUGHT_BANNER_ART_ASSET);
 
-      printf("\n\n");
+      appendFrameText("\n\n");
 
       nConsoleLeftPaddingSize = 51;
 
       setConsoleColorToGreen();
-      printf("%*c• You added %d silk to the ship's storage!\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
+      appendFrameFormat("%*c• You added %d silk to the ship's storage!\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
     } else {
-      printf(
-        "                                                         ▗▄▄▖▗▄▄▄▖▗▖   ▗▖ ▗▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
-        "                                                        ▐▌     █  ▐▌   ▐▌▗▞▘    ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
-        "                                                         ▝▀▚▖  █  ▐▌   ▐▛▚▖      ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
-        "                                                        ▗▄▄▞▘▗▄█▄▖▐▙▄▄▖▐▌ ▐▌    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n");
+      appendArtAsset(SILK_SOLD_BANNER_ART_ASSET);
 
-      printf("\n\n");
+      appendFrameText("\n\n");
 
       nConsoleLeftPaddingSize = 56;
 
       setConsoleColorToRed();
-      printf("%*c• You removed %d silk from the ship's storage.\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
+      appendFrameFormat("%*c• You removed %d silk from the ship's storage.\n", nConsoleLeftPaddingSize, ' ',
+                        nCargoAmount);
     }
   } else {
     if (cTransactionType == BUY_ACTION_ID) {
-      printf(
-        "                                                   ▗▄▄▖▗▖ ▗▖▗▖  ▗▖ ▗▄▄▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
-        "                                                  ▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
-        "                                                  ▐▌▝▜▌▐▌ ▐▌▐▌ ▝▜▌ ▝▀▚▖    ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
-        "                                                  ▝▚▄▞▘▝▚▄▞▘▐▌  ▐▌▗▄▄▞▘    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n");
+      appendArtAsset(GUNS_BOUGHT_BANNER_ART_ASSET);
 
-      printf("\n\n");
+      appendFrameText("\n\n");
 
       nConsoleLeftPaddingSize = 50;
 
       setConsoleColorToGreen();
-      printf("%*c• You added %d guns to the ship's storage!\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
+      appendFrameFormat("%*c• You added %d guns to the ship's storage!\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
     } else {
-      printf(
-        "                                                        ▗▄▄▖▗▖ ▗▖▗▖  ▗▖ ▗▄▄▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
-        "                                                       ▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌       ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
-        "                                                       ▐▌▝▜▌▐▌ ▐▌▐▌ ▝▜▌ ▝▀▚▖     ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
-        "                                                       ▝▚▄▞▘▝▚▄▞▘▐▌  ▐▌▗▄▄▞▘    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n");
+      appendArtAsset(GUNS_SOLD_BANNER_ART_ASSET);
 
-      printf("\n\n");
+      appendFrameText("\n\n");
 
       nConsoleLeftPaddingSize = 55;
 
       setConsoleColorToRed();
-      printf("%*c• You removed %d guns from the ship's storage.\n", nConsoleLeftPaddingSize, ' ', nCargoAmount);
+      appendFrameFormat("%*c• You removed %d guns from the ship's storage.\n", nConsoleLeftPaddingSize, ' ',
+                        nCargoAmount);
     }
   }
 
   if (cTransactionType == BUY_ACTION_ID) {
     setConsoleColorToRed();
-    printf("%*c• You spent %d gold coins.\n", nConsoleLeftPaddingSize, ' ', nCargoPrice * nCargoAmount);
+    appendFrameFormat("%*c• You spent %d gold coins.\n", nConsoleLeftPaddingSize, ' ', nCargoPrice * nCargoAmount);
     resetConsoleColor();
   } else {
     setConsoleColorToGreen();
-    printf("%*c• You earned %d gold coins!\n", nConsoleLeftPaddingSize, ' ', nCargoPrice * nCargoAmount);
+    appendFrameFormat("%*c• You earned %d gold coins!\n", nConsoleLeftPaddingSize, ' ', nCargoPrice * nCargoAmount);
     resetConsoleColor();
   }
 
-  printf("\n\n\n\n\n");
+  appendFrameText("\n\n\n\n\n");
+
+  emitFrame();
 }
 
 /**
@@ -385,15 +293,13 @@ void printTransactionScreen(char cTransactionType, char cCargoId, int nCargoAmou
  * @param nShipCargoLimit The maximum amount of cargo that the ship can carry.
  */
 void printShipUpgradeMenu(int nShipCargoLimit) {
+  beginFrame();
+
   printSeparator();
 
-  printf(
-    "                                                 ▗▄▄▖▗▖ ▗▖▗▄▄▄▖▗▄▄▖     ▗▖ ▗▖▗▄▄▖  ▗▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▄ ▗▄▄▄▖\n"
-    "                                                ▐▌   ▐▌ ▐▌  █  ▐▌ ▐▌    ▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌  █▐▌\n"
-    "                                                 ▝▀▚▖▐▛▀▜▌  █  ▐▛▀▘     ▐▌ ▐▌▐▛▀▘ ▐▌▝▜▌▐▛▀▚▖▐▛▀▜▌▐▌  █▐▛▀▀▘\n"
-    "                                                ▗▄▄▞▘▐▌ ▐▌▗▄█▄▖▐▌       ▝▚▄▞▘▐▌   ▝▚▄▞▘▐▌ ▐▌▐▌ ▐▌▐▙▄▄▀▐▙▄▄▖\n");
+  appendArtAsset(SHIP_UPGRADE_MENU_BANNER_ART_ASSET);
 
-  printf("\n\n");
+  appendFrameText("\n\n");
 
   int nShipUpgradeCost;
   int nShipNewCargoLimit;
@@ -419,17 +325,19 @@ void printShipUpgradeMenu(int nShipCargoLimit) {
     nShipAdditionalCargoLimit = TIER_FOUR_SHIP_CARGO_LIMIT - TIER_THREE_SHIP_CARGO_LIMIT;
   }
 
-  printf("\n\n");
+  appendFrameText("\n\n");
 
   int nConsoleLeftPaddingSize = 48;
 
-  printf(
+  appendFrameFormat(
     "%*c• Cost: %d\n"
     "%*c• Cargo Capacity: %d (+%d)\n",
     nConsoleLeftPaddingSize, ' ', nShipUpgradeCost, nConsoleLeftPaddingSize, ' ', nShipNewCargoLimit,
     nShipAdditionalCargoLimit);
 
-  printf("\n\n\n");
+  appendFrameText("\n\n\n");
+
+  emitFrame();
 }
 
 /**
@@ -439,27 +347,28 @@ void printShipUpgradeMenu(int nShipCargoLimit) {
  * @param nShipUpgradeCost The price of the ship upgrade.
  */
 void printShipUpgradeScreen(int nShipCargoLimitIncrease, int nShipUpgradeCost) {
+  beginFrame();
+
   printSeparator();
 
-  printf(
-    "                                               ▗▄▄▖▗▖ ▗▖▗▄▄▄▖▗▄▄▖     ▗▖ ▗▖▗▄▄▖  ▗▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▄ ▗▄▄▄▖▗▄▄▄\n"
-    "                                              ▐▌   ▐▌ ▐▌  █  ▐▌ ▐▌    ▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌  █▐▌   ▐▌  █\n"
-    "                                               ▝▀▚▖▐▛▀▜▌  █  ▐▛▀▘     ▐▌ ▐▌▐▛▀▘ ▐▌▝▜▌▐▛▀▚▖▐▛▀▜▌▐▌  █▐▛▀▀▘▐▌  █\n"
-    "                                              ▗▄▄▞▘▐▌ ▐▌▗▄█▄▖▐▌       ▝▚▄▞▘▐▌   ▝▚▄▞▘▐▌ ▐▌▐▌ ▐▌▐▙▄▄▀▐▙▄▄▖▐▙▄▄▀\n");
+  appendArtAsset(SHIP_UPGRADED_BANNER_ART_ASSET);
 
-  printf("\n\n");
+  appendFrameText("\n\n");
 
   int nConsoleLeftPaddingSize = 46;
 
   setConsoleColorToGreen();
-  printf("%*c• Your ship gained %d additional cargo spaces!\n", nConsoleLeftPaddingSize, ' ', nShipCargoLimitIncrease);
+  appendFrameFormat("%*c• Your ship gained %d additional cargo spaces!\n", nConsoleLeftPaddingSize, ' ',
+                    nShipCargoLimitIncrease);
   resetConsoleColor();
 
   setConsoleColorToRed();
-  printf("%*c• You spent %d gold coins.\n", nConsoleLeftPaddingSize, ' ', nShipUpgradeCost);
+  appendFrameFormat("%*c• You spent %d gold coins.\n", nConsoleLeftPaddingSize, ' ', nShipUpgradeCost);
   resetConsoleColor();
 
-  printf("\n\n\n\n\n");
+  appendFrameText("\n\n\n\n\n");
+
+  emitFrame();
 }
 
 /**
@@ -470,89 +379,44 @@ void printShipUpgradeScreen(int nShipCargoLimitIncrease, int nShipUpgradeCost) {
  * @pre @p nPlayerTurns must have a a 2-digit positive integer value.
  */
 void printNavigationMenu(char cCurrentPortId, int nPlayerTurns) {
+  beginFrame();
+
   printSeparator();
 
-  printf(
-    "                                                    ▗▖  ▗▖ ▗▄▖ ▗▖  ▗▖▗▄▄▄▖ ▗▄▄▖ ▗▄▖▗▄▄▄▖▗▄▄▄▖ ▗▄▖ ▗▖  ▗▖\n"
-    "                                                    ▐▛▚▖▐▌▐▌ ▐▌▐▌  ▐▌  █  ▐▌   ▐▌ ▐▌ █    █  ▐▌ ▐▌▐▛▚▖▐▌\n"
-    "                                                    ▐▌ ▝▜▌▐▛▀▜▌▐▌  ▐▌  █  ▐▌▝▜▌▐▛▀▜▌ █    █  ▐▌ ▐▌▐▌ ▝▜▌\n"
-    "                                                    ▐▌  ▐▌▐▌ ▐▌ ▝▚▞▘ ▗▄█▄▖▝▚▄▞▘▐▌ ▐▌ █  ▗▄█▄▖▝▚▄▞▘▐▌  ▐▌\n");
+  appendArtAsset(NAVIGATION_BANNER_ART_ASSET);
 
-  printf("\n\n");
+  appendFrameText("\n\n");
 
-  printf("%*cDay %2d of 30\n", 72, ' ', nPlayerTurns);
+  appendFrameFormat("%*cDay %2d of 30\n", 72, ' ', nPlayerTurns);
 
-  printf("\n");
+  appendFrameText("\n");
 
   switch (cCurrentPortId) {
-      // clang-format off
     case 'T': {
-      printf(
-        "                                           You are here!\n"
-        "                                                 ↓\n"
-        "                                               Tondo\n"
-        "                                                 ◯\n" COLOR_BLUE
-        "                                                 ║\n"
-        "                                                 ║\n"
-        "                                                 ║     "   COLOR_DEFAULT "Manila" COLOR_BLUE    "       ╔╗                    "                                    "╔╗\n"
-        "                                                 ╚═══════" COLOR_DEFAULT   "◯"    COLOR_BLUE "══════════╝║       "    COLOR_DEFAULT "Pandakan" COLOR_BLUE     "     ║╚═══════╗\n"
-        "                                                         " COLOR_DEFAULT   "↑"    COLOR_BLUE "           ╚══════════" COLOR_DEFAULT    "◯"     COLOR_BLUE "═════════╝       ╔╝    " COLOR_DEFAULT "Sapa" COLOR_BLUE "\n"
-        "                                                                                                  "                                                                        "╚══════" COLOR_DEFAULT "◯\n");
-      // clang-format on
+      appendArtAsset(TONDO_MAP_ART_ASSET);
 
       break;
     }
     case 'M': {
-      // clang-format off
-      printf(
-        "                                               Tondo\n"
-        "                                                 ◯\n" COLOR_BLUE
-        "                                                 ║\n"
-        "                                                 ║\n"
-        "                                                 ║     "   COLOR_DEFAULT "Manila" COLOR_BLUE       "       ╔╗                    "                                    "╔╗\n"
-        "                                                 ╚═══════" COLOR_DEFAULT   "◯"    COLOR_BLUE    "══════════╝║       "    COLOR_DEFAULT "Pandakan" COLOR_BLUE     "     ║╚═══════╗\n"
-        "                                                         " COLOR_DEFAULT   "↑"    COLOR_BLUE    "           ╚══════════" COLOR_DEFAULT    "◯"     COLOR_BLUE "═════════╝       ╔╝    " COLOR_DEFAULT "Sapa\n"
-        "                                                   "                 "You are here!" COLOR_BLUE "                                  "                                          "╚══════" COLOR_DEFAULT "◯\n");
-      // clang-format on
+      appendArtAsset(MANILA_MAP_ART_ASSET);
 
       break;
     }
     case 'P': {
-      // clang-format off
-      printf(
-        "                                               Tondo\n"
-        "                                                 ◯\n" COLOR_BLUE
-        "                                                 ║\n"
-        "                                                 ║\n"
-        "                                                 ║     "   COLOR_DEFAULT "Manila" COLOR_BLUE    "       ╔╗                    "                                    "╔╗\n"
-        "                                                 ╚═══════" COLOR_DEFAULT   "◯"    COLOR_BLUE "══════════╝║       "    COLOR_DEFAULT "Pandakan" COLOR_BLUE     "     ║╚═══════╗\n"
-        "                                                         " COLOR_DEFAULT   "↑"    COLOR_BLUE "           ╚══════════" COLOR_DEFAULT    "◯"     COLOR_BLUE "═════════╝       ╔╝    " COLOR_DEFAULT "Sapa" COLOR_BLUE "\n"
-        "                                                                                "                                                      "↑"     COLOR_BLUE "                 ╚══════" COLOR_DEFAULT "◯\n"
-        "                                                                          "                                                      "You are here!\n");
-      // clang-format on
+      appendArtAsset(PANDAKAN_MAP_ART_ASSET);
 
       break;
     }
     case 'S': {
-      // clang-format off
-      printf(
-        "                                               Tondo\n"
-        "                                                 ◯\n" COLOR_BLUE
-        "                                                 ║\n"
-        "                                                 ║\n"
-        "                                                 ║     "   COLOR_DEFAULT "Manila" COLOR_BLUE    "       ╔╗                    "                                    "╔╗\n"
-        "                                                 ╚═══════" COLOR_DEFAULT   "◯"    COLOR_BLUE "══════════╝║       "    COLOR_DEFAULT "Pandakan" COLOR_BLUE     "     ║╚═══════╗\n"
-        "                                                         " COLOR_DEFAULT   "↑"    COLOR_BLUE "           ╚══════════" COLOR_DEFAULT    "◯"     COLOR_BLUE "═════════╝       ╔╝    " COLOR_DEFAULT "Sapa" COLOR_BLUE "\n"
-        "                                                                                                  "                                                                        "╚══════" COLOR_DEFAULT "◯\n"
-        "                                                                                                         "                                                                                         "↑\n"
-        "                                                                                                   "                                                                                         "You are here!\n");
-      // clang-format on
+      appendArtAsset(SAPA_MAP_ART_ASSET);
 
       break;
     }
   }
 
-  printf("\n\n\n");
+  appendFrameText("\n\n\n");
+
+  emitFrame();
 }
 
 /**
@@ -566,70 +430,64 @@ void printNavigationMenu(char cCurrentPortId, int nPlayerTurns) {
  * @pre @p nPlayerTurns must have a a two-digit positive integer value.
  */
 void printNavigationScreen(int bIsSuccessful, char cPortId, int nPlayerTurns) {
+  beginFrame();
+
   printSeparator();
 
   if (bIsSuccessful) {
-    printf(
-      "                                               ▗▄▄▄ ▗▄▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▖▗▄▄▄▖▗▄▄▄▖▗▄▄▄     ▗▄▄▖  ▗▄▖ ▗▄▄▖▗▄▄▄▖\n"
-      "                                               ▐▌  █▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌ █  ▐▌   ▐▌  █    ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌ █\n"
-      "                                               ▐▌  █▐▛▀▀▘▐▛▀▘ ▐▛▀▜▌▐▛▀▚▖ █  ▐▛▀▀▘▐▌  █    ▐▛▀▘ ▐▌ ▐▌▐▛▀▚▖ █\n"
-      "                                               ▐▙▄▄▀▐▙▄▄▖▐▌   ▐▌ ▐▌▐▌ ▐▌ █  ▐▙▄▄▖▐▙▄▄▀    ▐▌   ▝▚▄▞▘▐▌ ▐▌ █\n");
+    appendArtAsset(DEPARTED_BANNER_ART_ASSET);
 
-    printf("\n\n");
+    appendFrameText("\n\n");
 
     setConsoleColorToGreen();
 
     switch (cPortId) {
       case 'T': {
-        printf("%*cYou have navigated to the port of Tondo!\n", 58, ' ');
+        appendFrameFormat("%*cYou have navigated to the port of Tondo!\n", 58, ' ');
 
         break;
       }
       case 'M': {
-        printf("%*cYou have navigated to the port of Manila!\n", 57, ' ');
+        appendFrameFormat("%*cYou have navigated to the port of Manila!\n", 57, ' ');
 
         break;
       }
       case 'P': {
-        printf("%*cYou have navigated to the port of Pandakan!\n", 56, ' ');
+        appendFrameFormat("%*cYou have navigated to the port of Pandakan!\n", 56, ' ');
 
         break;
       }
       case 'S': {
-        printf("%*cYou have navigated to the port of Sapa!\n", 58, ' ');
+        appendFrameFormat("%*cYou have navigated to the port of Sapa!\n", 58, ' ');
 
         break;
       }
     }
   } else {
-    printf(
-      "                               ▗▄▄▄ ▗▄▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▖▗▄▄▄▖▗▖ ▗▖▗▄▄▖ ▗▄▄▄▖    ▗▄▄▖  ▗▄▖  ▗▄▄▖▗▄▄▄▖▗▄▄▖  ▗▄▖ ▗▖  ▗▖▗▄▄▄▖▗▄▄▄ \n"
-      "                               ▐▌  █▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌ █  ▐▌ ▐▌▐▌ ▐▌▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌     █  ▐▌ ▐▌▐▌ ▐▌▐▛▚▖▐▌▐▌   ▐▌  █\n"
-      "                               ▐▌  █▐▛▀▀▘▐▛▀▘ ▐▛▀▜▌▐▛▀▚▖ █  ▐▌ ▐▌▐▛▀▚▖▐▛▀▀▘    ▐▛▀▘ ▐▌ ▐▌ ▝▀▚▖  █  ▐▛▀▘ ▐▌ ▐▌▐▌ ▝▜▌▐▛▀▀▘▐▌  █\n"
-      "                               ▐▙▄▄▀▐▙▄▄▖▐▌   ▐▌ ▐▌▐▌ ▐▌ █  ▝▚▄▞▘▐▌ ▐▌▐▙▄▄▖    ▐▌   ▝▚▄▞▘▗▄▄▞▘  █  ▐▌   ▝▚▄▞▘▐▌  ▐▌▐▙▄▄▖▐▙▄▄▀\n");
+    appendArtAsset(DEPARTURE_POSTPONED_BANNER_ART_ASSET);
 
-    printf("\n\n");
+    appendFrameText("\n\n");
 
     setConsoleColorToRed();
 
     switch (cPortId) {
       case 'T': {
-        printf("%*cYou could not depart for the port of Tondo due to the weather.\n", 47, ' ');
+        appendFrameFormat("%*cYou could not depart for the port of Tondo due to the weather.\n", 47, ' ');
 
         break;
       }
       case 'M': {
-        printf("%*cYou could not depart for the port of Manila due to the weather.\n", 46, ' ');
+        appendFrameFormat("%*cYou could not depart for the port of Manila due to the weather.\n", 46, ' ');
 
         break;
       }
       case 'P': {
-        printf("%*cYou could not depart for the port of Pandakan due to the weather.\n", 45, ' ');
+        appendFrameFormat("%*cYou could not depart for the port of Pandakan due to the weather.\n", 45, ' ');
 
         break;
       }
       case 'S': {
-        printf("%*cYou could not depart for the port of Sapa due to the weather.\n", 47, ' ');
+        appendFrameFormat("%*cYou could not depart for the port of Sapa due to the weather.\n", 47, ' ');
 
         break;
       }
@@ -638,11 +496,13 @@ void printNavigationScreen(int bIsSuccessful, char cPortId, int nPlayerTurns) {
 
   resetConsoleColor();
 
-  printf("\n");
+  appendFrameText("\n");
 
-  printf("%*cDay %2d → %2d", 72, ' ', nPlayerTurns, nPlayerTurns + 1);
+  appendFrameFormat("%*cDay %2d → %2d", 72, ' ', nPlayerTurns, nPlayerTurns + 1);
 
-  printf("\n\n\n\n\n");
+  appendFrameText("\n\n\n\n\n");
+
+  emitFrame();
 }
 
 /**
@@ -657,127 +517,64 @@ void printNavigationScreen(int bIsSuccessful, char cPortId, int nPlayerTurns) {
  */
 void printWeatherReportScreen(int bIsNewStorm, int nStormOldWindSignalNumber, int nStormNewWindSignalNumber,
                               int nPostponedDepartureChance, int nStormTurnDuration) {
+  beginFrame();
+
   printSeparator();
 
-  setConsoleColorToBlue();
-  printf(
-    "                                            ▗▖ ▗▖▗▄▄▄▖ ▗▄▖▗▄▄▄▖▗▖ ▗▖▗▄▄▄▖▗▄▄▖     ▗▄▄▖ ▗▄▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▖▗▄▄▄▖\n"
-    "                                            ▐▌ ▐▌▐▌   ▐▌ ▐▌ █  ▐▌ ▐▌▐▌   ▐▌ ▐▌    ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌ █\n"
-    "                                            ▐▌ ▐▌▐▛▀▀▘▐▛▀▜▌ █  ▐▛▀▜▌▐▛▀▀▘▐▛▀▚▖    ▐▛▀▚▖▐▛▀▀▘▐▛▀▘ ▐▌ ▐▌▐▛▀▚▖ █\n"
-    "                                            ▐▙█▟▌▐▙▄▄▖▐▌ ▐▌ █  ▐▌ ▐▌▐▙▄▄▖▐▌ ▐▌    ▐▌ ▐▌▐▙▄▄▖▐▌   ▝▚▄▞▘▐▌ ▐▌ █\n");
-  resetConsoleColor();
+  appendArtAsset(WEATHER_REPORT_BANNER_ART_ASSET);
 
-  printf("\n\n");
+  appendFrameText("\n\n");
 
   if (nStormTurnDuration > 0) {
     if (bIsNewStorm) {
       setConsoleColorToRed();
-      printf("%*cA new storm has formed.\n", 66, ' ');
+      appendFrameFormat("%*cA new storm has formed.\n", 66, ' ');
       resetConsoleColor();
 
-      printf("\n");
+      appendFrameText("\n");
     }
 
     if (nStormOldWindSignalNumber != nStormNewWindSignalNumber) {
-      printf("%*cWind Signal Number %d → %d", 66, ' ', nStormOldWindSignalNumber, nStormNewWindSignalNumber);
+      appendFrameFormat("%*cWind Signal Number %d → %d", 66, ' ', nStormOldWindSignalNumber, nStormNewWindSignalNumber);
     } else {
-      printf("%*cWind Signal Number %d", 68, ' ', nStormNewWindSignalNumber);
+      appendFrameFormat("%*cWind Signal Number %d", 68, ' ', nStormNewWindSignalNumber);
     }
 
-    printf("\n");
+    appendFrameText("\n");
 
     if (nStormNewWindSignalNumber == 1) {
-      printf(
-        "                                          .----------------.\n"
-        "                                         | .--------------. |\n"
-        "                                         | |     __       | |\n"
-        "                                         | |    /  |      | |\n"
-        "                                         | |    `| |      | |        Tropical Depression (TD)\n"
-        "                                         | |     | |      | |        <= 61 km/h\n"
-        "                                         | |    _| |_     | |        Minimal to minor threat to life and property.\n"
-        "                                         | |   |_____|    | |\n"
-        "                                         | |              | |\n"
-        "                                         | '--------------' |\n"
-        "                                          '----------------'\n");
+      appendArtAsset(SIGNAL_ONE_CARD_ART_ASSET);
     } else if (nStormNewWindSignalNumber == 2) {
-      setConsoleColorToCyan();
-      printf(
-        "                                          .----------------.\n"
-        "                                         | .--------------. |\n"
-        "                                         | |    _____     | |\n"
-        "                                         | |   / ___ `.   | |\n"
-        "                                         | |  |_/___) |   | |        Tropical Storm (TS)\n"
-        "                                         | |   .'____.'   | |        62 - 88 km/h\n"
-        "                                         | |  / /____     | |        Minor to moderate threat to life and property.\n"
-        "                                         | |  |_______|   | |\n"
-        "                                         | |              | |\n"
-        "                                         | '--------------' |\n"
-        "                                          '----------------'\n");
+      appendArtAsset(SIGNAL_TWO_CARD_ART_ASSET);
     } else if (nStormNewWindSignalNumber == 3) {
-      setConsoleColorToYellow();
-      printf(
-        "                                       .----------------.\n"
-        "                                      | .--------------. |\n"
-        "                                      | |    ______    | |\n"
-        "                                      | |   / ____ `.  | |\n"
-        "                                      | |   `'  __) |  | |        Severe Tropical Storm (STS)\n"
-        "                                      | |   _  |__ '.  | |        89 - 117 km/h\n"
-        "                                      | |  | \\____) |  | |        Moderate to significant threat to life and property.\n"
-        "                                      | |   \\______.'  | |\n"
-        "                                      | |              | |\n"
-        "                                      | '--------------' |\n"
-        "                                       '----------------'\n");
+      appendArtAsset(SIGNAL_THREE_CARD_ART_ASSET);
     } else if (nStormNewWindSignalNumber == 4) {
-      setConsoleColorToRed();
-      printf(
-        "                                        .----------------.\n"
-        "                                       | .--------------. |\n"
-        "                                       | |   _    _     | |\n"
-        "                                       | |  | |  | |    | |\n"
-        "                                       | |  | |__| |_   | |        Typhoon (TY)\n"
-        "                                       | |  |____   _|  | |        118 - 184 km/h\n"
-        "                                       | |      _| |_   | |        Significant to severe threat to life and property.\n"
-        "                                       | |     |_____|  | |\n"
-        "                                       | |              | |\n"
-        "                                       | '--------------' |\n"
-        "                                        '----------------'\n");
+      appendArtAsset(SIGNAL_FOUR_CARD_ART_ASSET);
     } else {
-      setConsoleColorToPurple();
-      printf(
-        "                                               .----------------.\n"
-        "                                              | .--------------. |\n"
-        "                                              | |   _______    | |\n"
-        "                                              | |  |  _____|   | |\n"
-        "                                              | |  | |____     | |        Super Typhoon (STY)\n"
-        "                                              | |  '_.____''.  | |        >= 185 km/h\n"
-        "                                              | |  | \\____) |  | |        Extreme threat to life and property.\n"
-        "                                              | |   \\______.'  | |\n"
-        "                                              | |              | |\n"
-        "                                              | '--------------' |\n"
-        "                                               '----------------'\n");
+      appendArtAsset(SIGNAL_FIVE_CARD_ART_ASSET);
     }
 
-    if (nStormNewWindSignalNumber > 1) resetConsoleColor();
-
-    printf("\n\n");
+    appendFrameText("\n\n");
 
     int nConsoleLeftPaddingSize = 44;
 
     if (nStormNewWindSignalNumber > 2) {
       setConsoleColorToRed();
-      printf("%*c• The chances of a postponed departure are %d%%.\n", nConsoleLeftPaddingSize, ' ',
-             nPostponedDepartureChance);
+      appendFrameFormat("%*c• The chances of a postponed departure are %d%%.\n", nConsoleLeftPaddingSize, ' ',
+                        nPostponedDepartureChance);
       resetConsoleColor();
     }
 
-    printf("%*c• The storm will last for %d more day/s.", nConsoleLeftPaddingSize, ' ', nStormTurnDuration);
+    appendFrameFormat("%*c• The storm will last for %d more day/s.", nConsoleLeftPaddingSize, ' ', nStormTurnDuration);
   } else {
     setConsoleColorToGreen();
-    printf("%*cThe storm has left the area of responsibility!\n", 55, ' ');
+    appendFrameFormat("%*cThe storm has left the area of responsibility!\n", 55, ' ');
     resetConsoleColor();
   }
 
-  printf("\n\n\n\n\n");
+  appendFrameText("\n\n\n\n\n");
+
+  emitFrame();
 }
 
 /**
@@ -790,55 +587,31 @@ void printWeatherReportScreen(int bIsNewStorm, int nStormOldWindSignalNumber, in
  */
 void printGameEndScreen(int nPlayerFinalProfit, int nPlayerProfitTarget, int nPlayerFinalBalance,
                         int nPlayerInitialBalance, int nPlayerFinalTurns) {
+  beginFrame();
+
   printSeparator();
 
   int nConsoleLeftPaddingSize;
 
   if (nPlayerFinalProfit >= nPlayerProfitTarget) {
-    setConsoleColorToYellow();
-    printf(
-      "                                              ██╗   ██╗ ██████╗ ██╗   ██╗    ██╗    ██╗ ██████╗ ███╗   ██╗██╗\n"
-      "                                              ╚██╗ ██╔╝██╔═══██╗██║   ██║    ██║    ██║██╔═══██╗████╗  ██║██║\n"
-      "                                               ╚████╔╝ ██║   ██║██║   ██║    ██║ █╗ ██║██║   ██║██╔██╗ ██║██║\n"
-      "                                                ╚██╔╝  ██║   ██║██║   ██║    ██║███╗██║██║   ██║██║╚██╗██║╚═╝\n"
-      "                                                 ██║   ╚██████╔╝╚██████╔╝    ╚███╔███╔╝╚██████╔╝██║ ╚████║██╗\n"
-      "                                                 ╚═╝    ╚═════╝  ╚═════╝      ╚══╝╚══╝  ╚═════╝ ╚═╝  ╚═══╝╚═╝\n");
-
-    printf("\n");
-
-    printf(
-      "                                                                       ___________\n"
-      "                                                                      '._==_==_=_.'\n"
-      "                                                                      .-\\:      /-.\n"
-      "                                                                      | (|:.    ) |\n"
-      "                                                                      '-|:.     |-'\n"
-      "                                                                        \\::.    /\n"
-      "                                                                         '::. .'\n"
-      "                                                                           ) (\n"
-      "                                                                         _.' '._\n"
-      "                                                                        `\"\"\"\"\"\"\"`\n");
-    resetConsoleColor();
+    appendArtAsset(VICTORY_BANNER_ART_ASSET);
+
+    appendFrameText("\n");
+
+    appendArtAsset(VICTORY_TROPHY_ART_ASSET);
 
-    printf("\n\n");
+    appendFrameText("\n\n");
 
     nConsoleLeftPaddingSize = 46;
   } else {
-    setConsoleColorToRed();
-    printf(
-      "                                            ██╗   ██╗ ██████╗ ██╗   ██╗    ██╗      ██████╗ ███████╗████████╗██╗\n"
-      "                                            ╚██╗ ██╔╝██╔═══██╗██║   ██║    ██║     ██╔═══██╗██╔════╝╚══██╔══╝██║\n"
-      "                                             ╚████╔╝ ██║   ██║██║   ██║    ██║     ██║   ██║███████╗   ██║   ██║\n"
-      "                                              ╚██╔╝  ██║   ██║██║   ██║    ██║     ██║   ██║╚════██║   ██║   ╚═╝\n"
-      "                                               ██║   ╚██████╔╝╚██████╔╝    ███████╗╚██████╔╝███████║   ██║   ██╗\n"
-      "                                               ╚═╝    ╚═════╝  ╚═════╝     ╚══════╝ ╚═════╝ ╚══════╝   ╚═╝   ╚═╝\n");
-    resetConsoleColor();
+    appendArtAsset(DEFEAT_BANNER_ART_ASSET);
 
-    printf("\n\n");
+    appendFrameText("\n\n");
 
     nConsoleLeftPaddingSize = 44;
   }
 
-  printf("%*c• Final profit made:", nConsoleLeftPaddingSize, ' ');
+  appendFrameFormat("%*c• Final profit made:", nConsoleLeftPaddingSize, ' ');
 
   if (nPlayerFinalProfit >= nPlayerProfitTarget) {
     setConsoleColorToGreen();
@@ -846,10 +619,12 @@ void printGameEndScreen(int nPlayerFinalProfit, int nPlayerProfitTarget, int nPl
     setConsoleColorToRed();
   }
 
-  printf(" %d%% (%d gold coins)\n", nPlayerFinalProfit, nPlayerFinalBalance - nPlayerInitialBalance);
+  appendFrameFormat(" %d%% (%d gold coins)\n", nPlayerFinalProfit, nPlayerFinalBalance - nPlayerInitialBalance);
   resetConsoleColor();
 
-  printf("%*c• Number of turns (days) exhausted: %d\n", nConsoleLeftPaddingSize, ' ', nPlayerFinalTurns);
+  appendFrameFormat("%*c• Number of turns (days) exhausted: %d\n", nConsoleLeftPaddingSize, ' ', nPlayerFinalTurns);
+
+  appendFrameText("\n\n\n");
 
-  printf("\n\n\n");
+  emitFrame();
 }
@@ -0,0 +1,212 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "thread_pool.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define THREAD_POOL_CHUNK_SIZE 256
+
+/** A contiguous range of task indices owned by a single worker. */
+typedef struct {
+  pthread_mutex_t mutex;
+  long nNextTaskIndex;
+  long nEndTaskIndex;
+} TaskRange;
+
+/** The state shared by all workers of a single run. */
+typedef struct {
+  TaskRange *pTaskRanges;
+  int nWorkerCount;
+  ThreadPoolTask task;
+  void *pContext;
+} ThreadPool;
+
+/** The arguments of a single worker thread. */
+typedef struct {
+  ThreadPool *pThreadPool;
+  int nWorkerIndex;
+} ThreadPoolWorker;
+
+/**
+ * Takes a chunk of tasks from the front of the passed range.
+ * @param[in,out] pTaskRange The range to take from.
+ * @param[out] nBeginTaskIndex The index of the first task taken.
+ * @param[out] nEndTaskIndex The index after the last task taken.
+ * @returns `1` if any tasks were taken or `0` if the range is empty.
+ */
+static int takeTaskChunk(TaskRange *pTaskRange, long *nBeginTaskIndex, long *nEndTaskIndex) {
+  int bIsTaken = 0;
+
+  pthread_mutex_lock(&pTaskRange->mutex);
+
+  if (pTaskRange->nNextTaskIndex < pTaskRange->nEndTaskIndex) {
+    *nBeginTaskIndex = pTaskRange->nNextTaskIndex;
+    *nEndTaskIndex = *nBeginTaskIndex + THREAD_POOL_CHUNK_SIZE;
+
+    if (*nEndTaskIndex > pTaskRange->nEndTaskIndex) *nEndTaskIndex = pTaskRange->nEndTaskIndex;
+
+    pTaskRange->nNextTaskIndex = *nEndTaskIndex;
+    bIsTaken = 1;
+  }
+
+  pthread_mutex_unlock(&pTaskRange->mutex);
+
+  return bIsTaken;
+}
+
+/**
+ * Steals the back half of the first non-empty range of another worker and makes it the thief's own range.
+ * @param[in,out] pThreadPool The thread pool of the run.
+ * @param nThiefWorkerIndex The index of the worker that ran out of tasks.
+ * @returns `1` if any tasks were stolen or `0` if every range is empty.
+ */
+static int stealTaskRange(ThreadPool *pThreadPool, int nThiefWorkerIndex) {
+  for (int nOffset = 1; nOffset < pThreadPool->nWorkerCount; nOffset++) {
+    TaskRange *pVictimTaskRange = &pThreadPool->pTaskRanges[(nThiefWorkerIndex + nOffset) % pThreadPool->nWorkerCount];
+    long nStolenBeginTaskIndex = 0;
+    long nStolenEndTaskIndex = 0;
+
+    pthread_mutex_lock(&pVictimTaskRange->mutex);
+
+    long nRemainingTaskCount = pVictimTaskRange->nEndTaskIndex - pVictimTaskRange->nNextTaskIndex;
+
+    if (nRemainingTaskCount > 0) {
+      nStolenEndTaskIndex = pVictimTaskRange->nEndTaskIndex;
+      nStolenBeginTaskIndex = nStolenEndTaskIndex - (nRemainingTaskCount + 1) / 2;
+      pVictimTaskRange->nEndTaskIndex = nStolenBeginTaskIndex;
+    }
+
+    pthread_mutex_unlock(&pVictimTaskRange->mutex);
+
+    if (nStolenBeginTaskIndex < nStolenEndTaskIndex) {
+      TaskRange *pThiefTaskRange = &pThreadPool->pTaskRanges[nThiefWorkerIndex];
+
+      pthread_mutex_lock(&pThiefTaskRange->mutex);
+      pThiefTaskRange->nNextTaskIndex = nStolenBeginTaskIndex;
+      pThiefTaskRange->nEndTaskIndex = nStolenEndTaskIndex;
+      pthread_mutex_unlock(&pThiefTaskRange->mutex);
+
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Runs tasks from the worker's own range, stealing from other workers until no tasks are left.
+ * @param pArgument The worker's arguments.
+ * @returns `NULL`.
+ */
+static void *runThreadPoolWorker(void *pArgument) {
+  ThreadPoolWorker *pWorker = pArgument;
+  ThreadPool *pThreadPool = pWorker->pThreadPool;
+  TaskRange *pOwnTaskRange = &pThreadPool->pTaskRanges[pWorker->nWorkerIndex];
+  long nBeginTaskIndex;
+  long nEndTaskIndex;
+
+  do {
+    while (takeTaskChunk(pOwnTaskRange, &nBeginTaskIndex, &nEndTaskIndex)) {
+      for (long nTaskIndex = nBeginTaskIndex; nTaskIndex < nEndTaskIndex; nTaskIndex++) {
+        pThreadPool->task(pThreadPool->pContext, nTaskIndex, pWorker->nWorkerIndex);
+      }
+    }
+  } while (stealTaskRange(pThreadPool, pWorker->nWorkerIndex));
+
+  return NULL;
+}
+
+/**
+ * Runs the passed number of tasks across the passed number of worker threads. Each worker starts with an equal share
+ * of the tasks and steals half of another worker's remaining share once it runs out, so uneven tasks still keep every
+ * core busy.
+ * @param nTaskCount The number of tasks to run.
+ * @param nWorkerCount The number of worker threads to use.
+ * @param task The function that runs a single task.
+ * @param pContext The context passed to every task.
+ * @returns `0` if all tasks were run or `-1` if the thread pool could not be allocated.
+ */
+int runThreadPoolTasks(long nTaskCount, int nWorkerCount, ThreadPoolTask task, void *pContext) {
+  if (nWorkerCount < 1) nWorkerCount = 1;
+
+  ThreadPool threadPool;
+  ThreadPoolWorker *pWorkers = malloc(sizeof(ThreadPoolWorker) * nWorkerCount);
+  pthread_t *pThreads = malloc(sizeof(pthread_t) * nWorkerCount);
+
+  threadPool.pTaskRanges = malloc(sizeof(TaskRange) * nWorkerCount);
+  threadPool.nWorkerCount = nWorkerCount;
+  threadPool.task = task;
+  threadPool.pContext = pContext;
+
+  if (pWorkers == NULL || pThreads == NULL || threadPool.pTaskRanges == NULL) {
+    free(pWorkers);
+    free(pThreads);
+    free(threadPool.pTaskRanges);
+
+    return -1;
+  }
+
+  for (int nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+    pthread_mutex_init(&threadPool.pTaskRanges[nWorkerIndex].mutex, NULL);
+    threadPool.pTaskRanges[nWorkerIndex].nNextTaskIndex = nTaskCount * nWorkerIndex / nWorkerCount;
+    threadPool.pTaskRanges[nWorkerIndex].nEndTaskIndex = nTaskCount * (nWorkerIndex + 1) / nWorkerCount;
+
+    pWorkers[nWorkerIndex].pThreadPool = &threadPool;
+    pWorkers[nWorkerIndex].nWorkerIndex = nWorkerIndex;
+  }
+
+  int nStartedWorkerCount = 1;
+
+  while (nStartedWorkerCount < nWorkerCount &&
+         pthread_create(&pThreads[nStartedWorkerCount], NULL, runThreadPoolWorker, &pWorkers[nStartedWorkerCount]) ==
+           0) {
+    nStartedWorkerCount++;
+  }
+
+  // The calling thread works as the first worker, and any workers that failed to start are stolen from instead.
+  runThreadPoolWorker(&pWorkers[0]);
+
+  for (int nWorkerIndex = 1; nWorkerIndex < nStartedWorkerCount; nWorkerIndex++) {
+    pthread_join(pThreads[nWorkerIndex], NULL);
+  }
+
+  for (int nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+    pthread_mutex_destroy(&threadPool.pTaskRanges[nWorkerIndex].mutex);
+  }
+
+  free(pWorkers);
+  free(pThreads);
+  free(threadPool.pTaskRanges);
+
+  return 0;
+}
+
+/**
+ * Gets the number of processors available to the program.
+ * @returns A positive integer value.
+ */
+int getProcessorCount(void) {
+  long nProcessorCount = sysconf(_SC_NPROCESSORS_ONLN);
+
+  return nProcessorCount > 0 ? (int)nProcessorCount : 1;
+}
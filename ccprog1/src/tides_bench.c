@@ -0,0 +1,622 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "clock.h"
+#include "engine.h"
+#include "output.h"
+#include "policy.h"
+#include "prompts.h"
+#include "random.h"
+#include "text_graphics.h"
+#include "thread_pool.h"
+#include "trading.h"
+#include "transposition.h"
+#include "weather.h"
+
+#define DEFAULT_BENCHMARK_REPETITIONS 31
+#define BENCHMARK_WARM_UP_SECONDS 0.05
+#define BENCHMARK_REPETITION_SECONDS 0.01
+#define BENCHMARK_SAMPLE_SECONDS 1e-6
+#define BENCHMARK_MINIMUM_P99_SAMPLE_COUNT 100
+#define BENCHMARK_SEED 1
+
+#define BENCHMARK_TRANSPOSITION_GAME_COUNT 1024
+#define BENCHMARK_TRANSPOSITION_ENTRY_COUNT 16384
+#define BENCHMARK_TRANSPOSITION_HOT_STATE_COUNT 4096
+#define BENCHMARK_TRANSPOSITION_GENERATION_SIZE 4096
+#define BENCHMARK_TRANSPOSITION_MAXIMUM_DEPTH 16
+
+/**
+ * A benchmark, which runs the measured operation the passed number of times and may print out what the operations did
+ * once it has been timed.
+ */
+typedef struct {
+  const char *strName;
+  void (*runBenchmark)(long nOperationCount);
+  void (*printBenchmarkReport)(void);
+} Benchmark;
+
+/** The results of the operations, which are kept so that the compiler cannot remove the operations. */
+static volatile uint64_t nBenchmarkSink = 0;
+static RandomGenerator benchmarkRandomGenerator;
+static OutputSink benchmarkOutputSink;
+
+/** The states that the transposition table benchmarks look up, which are packed from games of the greedy policy. */
+static PackedGameState *pBenchmarkPackedGameStates = NULL;
+static long nBenchmarkPackedGameStateCount = 0;
+static TranspositionTable benchmarkTranspositionTable;
+static long nTranspositionOperationCount = 0;
+static long nTranspositionMismatchCount = 0;
+
+/**
+ * Runs `generateCargoPrices` for each port in turn.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runGenerateCargoPrices(long nOperationCount) {
+  int nCargoPrices[CARGO_COUNT];
+  uint64_t nSum = 0;
+
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    generateCargoPrices(&benchmarkRandomGenerator, (int)(nOperationIndex % PORT_COUNT), nCargoPrices);
+    nSum += (uint64_t)nCargoPrices[0];
+  }
+
+  nBenchmarkSink += nSum;
+}
+
+/**
+ * Runs `generateRandomBool` with an even chance.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runGenerateRandomBool(long nOperationCount) {
+  uint64_t nSum = 0;
+
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    nSum += (uint64_t)generateRandomBool(&benchmarkRandomGenerator, 50);
+  }
+
+  nBenchmarkSink += nSum;
+}
+
+/**
+ * Runs `tradeCargo`, alternating between buying and selling so that the balance stays the same.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runTradeCargo(long nOperationCount) {
+  int nPlayerBalance = 1000000;
+  int nShipCargoAmount = 0;
+
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    char cTransactionTypeId = nOperationIndex % 2 == 0 ? BUY_TRANSACTION_TYPE_ID : SELL_TRANSACTION_TYPE_ID;
+
+    tradeCargo(cTransactionTypeId, &nPlayerBalance, 10, 5, &nShipCargoAmount);
+  }
+
+  nBenchmarkSink += (uint64_t)nPlayerBalance;
+}
+
+/**
+ * Runs `upgradeShip` on a new ship.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runUpgradeShip(long nOperationCount) {
+  uint64_t nSum = 0;
+
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    int nPlayerBalance = 1000000;
+    int nShipCargoLimit = TIER_ONE_SHIP_CARGO_LIMIT;
+    int nShipUpgradeCost;
+    int nShipNewCargoLimit;
+
+    getShipUpgrade(nShipCargoLimit, &nShipUpgradeCost, &nShipNewCargoLimit);
+    upgradeShip(&nPlayerBalance, nShipUpgradeCost, &nShipCargoLimit, nShipNewCargoLimit);
+    nSum += (uint64_t)nShipCargoLimit;
+  }
+
+  nBenchmarkSink += nSum;
+}
+
+/**
+ * Runs `setStormStrength` through every wind signal.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runSetStormStrength(long nOperationCount) {
+  int nStormWindSignalNumber = 0;
+  int nPostponedDepartureChance = 0;
+  uint64_t nSum = 0;
+
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    setStormStrength(&nStormWindSignalNumber, (int)(nOperationIndex % MAXIMUM_WIND_SIGNAL_NUMBER) + 1,
+                     &nPostponedDepartureChance);
+    nSum += (uint64_t)nPostponedDepartureChance;
+  }
+
+  nBenchmarkSink += nSum;
+}
+
+/**
+ * Runs `stepGame` with a navigation to the next port, which ends the turn, starting a new game whenever one ends.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runNavigationStep(long nOperationCount) {
+  static const char cPortIds[PORT_COUNT] = {TONDO_PORT_ID, MANILA_PORT_ID, PANDAKAN_PORT_ID, SAPA_PORT_ID};
+  GameState gameState;
+  GameAction action = {NAVIGATE_ACTION_ID, 0, 0, 0};
+
+  initializeGame(&gameState, 0, 1000, 100, BENCHMARK_SEED);
+
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    if (isGameOver(&gameState)) initializeGame(&gameState, 0, 1000, 100, BENCHMARK_SEED + (uint64_t)nOperationIndex);
+
+    action.cPortId = cPortIds[(getPortIndex(gameState.cCurrentPortId) + 1) % PORT_COUNT];
+    stepGame(&gameState, action);
+  }
+
+  nBenchmarkSink += (uint64_t)gameState.nPlayerBalance;
+}
+
+/**
+ * Plays a full turn of the greedy policy, which trades until it sails away, starting a new game whenever one ends.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runGreedyTurn(long nOperationCount) {
+  GameState gameState;
+
+  initializeGame(&gameState, 0, 1000, 100, BENCHMARK_SEED);
+
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    if (isGameOver(&gameState)) initializeGame(&gameState, 0, 1000, 100, BENCHMARK_SEED + (uint64_t)nOperationIndex);
+
+    int nPlayerTurns = gameState.nPlayerTurns;
+
+    while (gameState.nPlayerTurns == nPlayerTurns && !isGameOver(&gameState)) {
+      stepGame(&gameState, chooseGreedyAction(&gameState));
+    }
+  }
+
+  nBenchmarkSink += (uint64_t)gameState.nPlayerBalance;
+}
+
+/**
+ * Packs every state reached by the greedy policy in `BENCHMARK_TRANSPOSITION_GAME_COUNT` games and allocates the table
+ * that the transposition table benchmark looks them up in, unless this has already been done.
+ * @returns `0` if the states and table are ready or `-1` if they could not be allocated.
+ */
+static int prepareTranspositionBenchmark(void) {
+  if (benchmarkTranspositionTable.pSlots != NULL) return 0;
+
+  long nStateCapacity = 0;
+
+  for (uint64_t nGameIndex = 0; nGameIndex < BENCHMARK_TRANSPOSITION_GAME_COUNT; nGameIndex++) {
+    GameState gameState;
+
+    initializeGame(&gameState, 0, 1000, 100, BENCHMARK_SEED + nGameIndex);
+
+    while (!isGameOver(&gameState)) {
+      if (nBenchmarkPackedGameStateCount == nStateCapacity) {
+        nStateCapacity = nStateCapacity > 0 ? nStateCapacity * 2 : 4096;
+
+        PackedGameState *pPackedGameStates = realloc(pBenchmarkPackedGameStates,
+                                                     sizeof(PackedGameState) * (size_t)nStateCapacity);
+
+        if (pPackedGameStates == NULL) return -1;
+
+        pBenchmarkPackedGameStates = pPackedGameStates;
+      }
+
+      packGameState(&gameState, &pBenchmarkPackedGameStates[nBenchmarkPackedGameStateCount++]);
+      stepGame(&gameState, chooseGreedyAction(&gameState));
+    }
+  }
+
+  return createTranspositionTable(&benchmarkTranspositionTable, BENCHMARK_TRANSPOSITION_ENTRY_COUNT);
+}
+
+/**
+ * Gets the entry that the transposition table benchmarks store for the passed state, which is derived from the state
+ * so that a hit can be checked against it.
+ * @param pPackedGameState The state of the entry.
+ * @param nDepth The depth of the entry.
+ * @returns The entry.
+ */
+static TranspositionEntry getBenchmarkTranspositionEntry(const PackedGameState *pPackedGameState, uint16_t nDepth) {
+  TranspositionEntry transpositionEntry;
+
+  transpositionEntry.nValue = (float)pPackedGameState->nPlayerBalance;
+  transpositionEntry.nDepth = nDepth;
+  transpositionEntry.nActionIndex = pPackedGameState->nPortAndShipTier;
+
+  return transpositionEntry;
+}
+
+/**
+ * Looks up a state in the transposition table, then stores its entry at a random depth as a search revisiting it
+ * would, and checks that a hit holds the entry of the same state.
+ * @param pPackedGameState The state to look up.
+ * @param nDepth The depth of the entry to store.
+ * @returns `1` if the table held a different entry for the state or `0` if it did not.
+ */
+static int runTranspositionLookup(const PackedGameState *pPackedGameState, uint16_t nDepth) {
+  uint64_t nHash = hashPackedGameState(pPackedGameState);
+  TranspositionEntry storedEntry;
+  TranspositionEntry transpositionEntry = getBenchmarkTranspositionEntry(pPackedGameState, nDepth);
+  int bIsMismatch = 0;
+
+  if (probeTranspositionTable(&benchmarkTranspositionTable, nHash, &storedEntry)) {
+    bIsMismatch = storedEntry.nValue != transpositionEntry.nValue ||
+                  storedEntry.nActionIndex != transpositionEntry.nActionIndex;
+  }
+
+  storeTranspositionEntry(&benchmarkTranspositionTable, nHash, transpositionEntry);
+
+  return bIsMismatch;
+}
+
+/**
+ * Looks up and stores greedy game states in a table that holds a fraction of them, half of them drawn from a small set
+ * of hot states that mostly hit and half from every state, and starts a new search generation every
+ * `BENCHMARK_TRANSPOSITION_GENERATION_SIZE` operations.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runTranspositionTable(long nOperationCount) {
+  if (prepareTranspositionBenchmark() != 0) return;
+
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    uint32_t nStateCount = nOperationIndex % 2 == 0 ? BENCHMARK_TRANSPOSITION_HOT_STATE_COUNT
+                                                    : (uint32_t)nBenchmarkPackedGameStateCount;
+    uint32_t nStateIndex = generateBoundedRandomNumber(&benchmarkRandomGenerator, nStateCount);
+    uint16_t nDepth = (uint16_t)generateBoundedRandomNumber(&benchmarkRandomGenerator,
+                                                            BENCHMARK_TRANSPOSITION_MAXIMUM_DEPTH);
+
+    nTranspositionMismatchCount += runTranspositionLookup(&pBenchmarkPackedGameStates[nStateIndex], nDepth);
+
+    if (++nTranspositionOperationCount % BENCHMARK_TRANSPOSITION_GENERATION_SIZE == 0) {
+      advanceTranspositionGeneration(&benchmarkTranspositionTable);
+    }
+  }
+
+  nBenchmarkSink += (uint64_t)benchmarkTranspositionTable.nHitCount;
+}
+
+/**
+ * Looks up and stores every state in a share of the packed states, starting at a different offset in each worker so
+ * that workers write the same buckets at the same time.
+ * @param pContext The number of mismatched hits, which is incremented atomically.
+ * @param nTaskIndex The index of the share.
+ * @param nWorkerIndex The index of the worker running the task.
+ */
+static void runConcurrentTranspositionTask(void *pContext, long nTaskIndex, int nWorkerIndex) {
+  long *nMismatchCount = pContext;
+  long nStateCount = nBenchmarkPackedGameStateCount;
+  long nTaskMismatchCount = 0;
+
+  for (long nStateIndex = 0; nStateIndex < BENCHMARK_TRANSPOSITION_ENTRY_COUNT; nStateIndex++) {
+    long nOffset = (nTaskIndex * BENCHMARK_TRANSPOSITION_HOT_STATE_COUNT / 4 + nStateIndex) % nStateCount;
+
+    nTaskMismatchCount += runTranspositionLookup(&pBenchmarkPackedGameStates[nOffset],
+                                                 (uint16_t)((nStateIndex + nWorkerIndex) %
+                                                            BENCHMARK_TRANSPOSITION_MAXIMUM_DEPTH));
+  }
+
+  __atomic_fetch_add(nMismatchCount, nTaskMismatchCount, __ATOMIC_RELAXED);
+}
+
+/**
+ * Prints out the counters of the transposition table after it has been timed, then has every processor look up and
+ * store the same states at once and prints out whether any hit held the entry of a different state.
+ */
+static void printTranspositionReport(void) {
+  const TranspositionTable *pTranspositionTable = &benchmarkTranspositionTable;
+
+  if (pTranspositionTable->pSlots == NULL) return;
+
+  long nProbeCount = pTranspositionTable->nHitCount + pTranspositionTable->nMissCount;
+
+  printf("  %ld states | %ld probes | %.1f%% hits | %ld stores | %ld replacements | generation %d | %ld mismatches\n",
+         nBenchmarkPackedGameStateCount, nProbeCount, pTranspositionTable->nHitCount * 100.0 / nProbeCount,
+         pTranspositionTable->nStoreCount, pTranspositionTable->nReplacementCount, pTranspositionTable->nGeneration,
+         nTranspositionMismatchCount);
+
+  int nWorkerCount = getProcessorCount() > 1 ? getProcessorCount() : 2;
+  long nMismatchCount = 0;
+
+  clearTranspositionTable(&benchmarkTranspositionTable);
+
+  if (runThreadPoolTasks(nWorkerCount * 4L, nWorkerCount, runConcurrentTranspositionTask, &nMismatchCount) != 0) {
+    return;
+  }
+
+  nProbeCount = pTranspositionTable->nHitCount + pTranspositionTable->nMissCount;
+
+  printf("  %d threads at once | %ld probes | %.1f%% hits | %ld replacements | %ld mismatches\n", nWorkerCount,
+         nProbeCount, pTranspositionTable->nHitCount * 100.0 / nProbeCount, pTranspositionTable->nReplacementCount,
+         nMismatchCount);
+}
+
+/**
+ * Renders the game start screen into the memory sink.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runGameStartScreen(long nOperationCount) {
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    printGameStartScreen();
+    nBenchmarkSink += benchmarkOutputSink.nLength;
+    clearOutputSink(&benchmarkOutputSink);
+  }
+}
+
+/**
+ * Renders the main screen of a ship carrying every cargo into the memory sink.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runMainScreen(long nOperationCount) {
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    printMainScreen((int)(nOperationIndex % 29) + 1, MANILA_PORT_ID, 42, 12345, 23, 100, 60, 75, 10, 20, 20, 10, 12,
+                    15, 33, 70);
+    nBenchmarkSink += benchmarkOutputSink.nLength;
+    clearOutputSink(&benchmarkOutputSink);
+  }
+}
+
+/**
+ * Renders the transaction screen into the memory sink.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runTransactionScreen(long nOperationCount) {
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    char cTransactionTypeId = nOperationIndex % 2 == 0 ? BUY_TRANSACTION_TYPE_ID : SELL_TRANSACTION_TYPE_ID;
+
+    printTransactionScreen(cTransactionTypeId, SILK_CARGO_ID, 25, 33);
+    nBenchmarkSink += benchmarkOutputSink.nLength;
+    clearOutputSink(&benchmarkOutputSink);
+  }
+}
+
+/**
+ * Renders the ship upgrade menu and screen into the memory sink.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runShipUpgradeScreens(long nOperationCount) {
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    printShipUpgradeMenu(TIER_ONE_SHIP_CARGO_LIMIT);
+    printShipUpgradeScreen(25, 500);
+    nBenchmarkSink += benchmarkOutputSink.nLength;
+    clearOutputSink(&benchmarkOutputSink);
+  }
+}
+
+/**
+ * Renders the navigation menu and screen into the memory sink.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runNavigationScreens(long nOperationCount) {
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    printNavigationMenu(MANILA_PORT_ID, 10);
+    printNavigationScreen(1, TONDO_PORT_ID, 10);
+    nBenchmarkSink += benchmarkOutputSink.nLength;
+    clearOutputSink(&benchmarkOutputSink);
+  }
+}
+
+/**
+ * Renders the weather report screen of a strengthening storm into the memory sink.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runWeatherReportScreen(long nOperationCount) {
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    printWeatherReportScreen(0, 3, 4, SIGNAL_FOUR_STORM_POSTPONED_DEPARTURE_CHANCE, 3);
+    nBenchmarkSink += benchmarkOutputSink.nLength;
+    clearOutputSink(&benchmarkOutputSink);
+  }
+}
+
+/**
+ * Renders the winning game end screen into the memory sink.
+ * @param nOperationCount The number of times to run the operation.
+ */
+static void runGameEndScreen(long nOperationCount) {
+  for (long nOperationIndex = 0; nOperationIndex < nOperationCount; nOperationIndex++) {
+    printGameEndScreen(150, 100, 2500, 1000, MAXIMUM_PLAYER_TURNS);
+    nBenchmarkSink += benchmarkOutputSink.nLength;
+    clearOutputSink(&benchmarkOutputSink);
+  }
+}
+
+static const Benchmark benchmarks[] = {
+  {"generateCargoPrices", runGenerateCargoPrices, NULL},
+  {"generateRandomBool", runGenerateRandomBool, NULL},
+  {"tradeCargo", runTradeCargo, NULL},
+  {"upgradeShip", runUpgradeShip, NULL},
+  {"setStormStrength", runSetStormStrength, NULL},
+  {"stepGame (navigation)", runNavigationStep, NULL},
+  {"greedy turn", runGreedyTurn, NULL},
+  {"transposition table", runTranspositionTable, printTranspositionReport},
+  {"printGameStartScreen", runGameStartScreen, NULL},
+  {"printMainScreen", runMainScreen, NULL},
+  {"printTransactionScreen", runTransactionScreen, NULL},
+  {"printShipUpgrade* screens", runShipUpgradeScreens, NULL},
+  {"printNavigation* screens", runNavigationScreens, NULL},
+  {"printWeatherReportScreen", runWeatherReportScreen, NULL},
+  {"printGameEndScreen", runGameEndScreen, NULL},
+};
+
+/**
+ * Compares two timings for sorting them in ascending order.
+ * @param pFirstTiming The first timing.
+ * @param pSecondTiming The second timing.
+ * @returns A negative value, zero, or a positive value if the first timing is shorter than, equal to, or longer than
+ * the second.
+ */
+static int compareTimings(const void *pFirstTiming, const void *pSecondTiming) {
+  double nFirstTiming = *(const double *)pFirstTiming;
+  double nSecondTiming = *(const double *)pSecondTiming;
+
+  return (nFirstTiming > nSecondTiming) - (nFirstTiming < nSecondTiming);
+}
+
+/**
+ * Times the passed number of operations of a benchmark.
+ * @param pBenchmark The benchmark to time.
+ * @param nOperationCount The number of operations to run.
+ * @returns The elapsed time in seconds.
+ */
+static double timeBenchmark(const Benchmark *pBenchmark, long nOperationCount) {
+  uint64_t nStartNanoseconds = getMonotonicNanoseconds();
+
+  pBenchmark->runBenchmark(nOperationCount);
+
+  return (getMonotonicNanoseconds() - nStartNanoseconds) / 1e9;
+}
+
+/**
+ * Warms up a benchmark, then times its repetitions in samples of about `BENCHMARK_SAMPLE_SECONDS` each, which are short
+ * enough for a slow operation to stand out, and prints out the distribution of their time per operation to the
+ * console. A repetition holds enough samples to take about `BENCHMARK_REPETITION_SECONDS`.
+ * @param pBenchmark The benchmark to run.
+ * @param nRepetitionCount The number of timed repetitions.
+ * @returns `0` if the benchmark was run or `-1` if its samples could not be allocated.
+ */
+static int runBenchmark(const Benchmark *pBenchmark, int nRepetitionCount) {
+  long nSampleOperationCount = 1;
+  long nRepetitionSampleCount = 1;
+  long nWarmUpRepetitionCount = 0;
+
+  // The first operation may set up what the others share, which must not be mistaken for the cost of an operation.
+  pBenchmark->runBenchmark(1);
+
+  while (timeBenchmark(pBenchmark, nSampleOperationCount) < BENCHMARK_SAMPLE_SECONDS) nSampleOperationCount *= 2;
+
+  while (timeBenchmark(pBenchmark, nSampleOperationCount * nRepetitionSampleCount) < BENCHMARK_REPETITION_SECONDS) {
+    nRepetitionSampleCount *= 2;
+  }
+
+  for (uint64_t nWarmUpStartNanoseconds = getMonotonicNanoseconds();
+       getMonotonicNanoseconds() - nWarmUpStartNanoseconds < BENCHMARK_WARM_UP_SECONDS * 1e9;
+       nWarmUpRepetitionCount++) {
+    timeBenchmark(pBenchmark, nSampleOperationCount * nRepetitionSampleCount);
+  }
+
+  long nSampleCount = nRepetitionSampleCount * nRepetitionCount;
+  double *nTimings = malloc(sizeof(double) * (size_t)nSampleCount);
+
+  if (nTimings == NULL) return -1;
+
+  for (long nSampleIndex = 0; nSampleIndex < nSampleCount; nSampleIndex++) {
+    nTimings[nSampleIndex] = timeBenchmark(pBenchmark, nSampleOperationCount) * 1e9 / nSampleOperationCount;
+  }
+
+  qsort(nTimings, (size_t)nSampleCount, sizeof(double), compareTimings);
+
+  printf("%-28s %10.2f", pBenchmark->strName, nTimings[nSampleCount / 2]);
+
+  // The 99th percentile of fewer samples than this would only be their maximum.
+  if (nSampleCount >= BENCHMARK_MINIMUM_P99_SAMPLE_COUNT) {
+    printf(" %10.2f", nTimings[(nSampleCount * 99 + 99) / 100 - 1]);
+  } else {
+    printf(" %10s", "-");
+  }
+
+  printf(" %10.2f %10.2f %4ld %4d x %ld x %ld\n", nTimings[0], nTimings[nSampleCount - 1], nWarmUpRepetitionCount,
+         nRepetitionCount, nRepetitionSampleCount, nSampleOperationCount);
+  free(nTimings);
+
+  return 0;
+}
+
+/**
+ * Prints out how to use the benchmarks to the console.
+ * @param strProgramName The name the benchmarks were run with.
+ */
+static void printBenchmarkUsage(const char *strProgramName) {
+  fprintf(stderr, "Usage: %s [--repetitions N] [--filter TEXT]\n", strProgramName);
+}
+
+int main(int argc, char *argv[]) {
+  int nRepetitionCount = DEFAULT_BENCHMARK_REPETITIONS;
+  const char *strFilter = "";
+  int nStatus = 0;
+
+  for (int nArgumentIndex = 1; nArgumentIndex < argc; nArgumentIndex++) {
+    const char *strOption = argv[nArgumentIndex];
+
+    if (nArgumentIndex + 1 >= argc) {
+      printBenchmarkUsage(argv[0]);
+
+      return 1;
+    }
+
+    const char *strValue = argv[++nArgumentIndex];
+
+    if (strcmp(strOption, "--repetitions") == 0) {
+      nRepetitionCount = atoi(strValue);
+    } else if (strcmp(strOption, "--filter") == 0) {
+      strFilter = strValue;
+    } else {
+      printBenchmarkUsage(argv[0]);
+
+      return 1;
+    }
+  }
+
+  if (nRepetitionCount < 1) {
+    printBenchmarkUsage(argv[0]);
+
+    return 1;
+  }
+
+  if (openMemoryOutputSink(&benchmarkOutputSink) != 0) {
+    fprintf(stderr, "Could not allocate the benchmarks.\n");
+
+    return 1;
+  }
+
+  seedRandomGenerator(&benchmarkRandomGenerator, BENCHMARK_SEED);
+  setOutputSink(&benchmarkOutputSink);
+
+  printf("Warm-up: %.0f ms | Repetition: ~%.0f ms | Sample: ~%.0f us | Times are in ns/op of a sample\n",
+         BENCHMARK_WARM_UP_SECONDS * 1e3, BENCHMARK_REPETITION_SECONDS * 1e3, BENCHMARK_SAMPLE_SECONDS * 1e6);
+  printf("%-28s %10s %10s %10s %10s %4s %s\n", "Benchmark", "median", "p99", "min", "max", "warm",
+         "reps x samples x ops");
+
+  for (size_t nBenchmarkIndex = 0; nBenchmarkIndex < sizeof(benchmarks) / sizeof(benchmarks[0]); nBenchmarkIndex++) {
+    if (strstr(benchmarks[nBenchmarkIndex].strName, strFilter) == NULL) continue;
+
+    if (runBenchmark(&benchmarks[nBenchmarkIndex], nRepetitionCount) != 0) {
+      fprintf(stderr, "Could not allocate the samples of %s.\n", benchmarks[nBenchmarkIndex].strName);
+      nStatus = 1;
+
+      break;
+    }
+
+    if (benchmarks[nBenchmarkIndex].printBenchmarkReport != NULL) benchmarks[nBenchmarkIndex].printBenchmarkReport();
+  }
+
+  setOutputSink(NULL);
+  closeOutputSink(&benchmarkOutputSink);
+  destroyTranspositionTable(&benchmarkTranspositionTable);
+  free(pBenchmarkPackedGameStates);
+
+  return nStatus;
+}
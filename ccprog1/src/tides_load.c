@@ -0,0 +1,649 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "clock.h"
+#include "scripted_player.h"
+
+#define DEFAULT_LOAD_HOST "127.0.0.1"
+#define DEFAULT_LOAD_PLAYER_COUNT 100
+#define DEFAULT_LOAD_IDLE_COUNT 0
+#define DEFAULT_LOAD_PROCESS_COUNT 1
+
+#define LOAD_FRAME_INITIAL_CAPACITY 16384
+#define LOAD_READ_BUFFER_SIZE 65536
+#define LOAD_EVENT_COUNT 256
+#define LOAD_INITIAL_LATENCY_CAPACITY 65536
+#define LOAD_PIPE_LATENCY_COUNT 4096
+
+/** A simulated player's connection, along with the output of the frame that the server is currently sending it. */
+typedef struct {
+  int nFileDescriptor;
+  int bIsIdle;
+  char *strFrame;
+  size_t nFrameLength;
+  size_t nFrameCapacity;
+  int bHasAnswered;
+  int nDayStep;
+  double nAnswerSeconds;
+} LoadPlayer;
+
+/** Where the server listens, which is either a Unix socket path or an IPv4 address and TCP port. */
+typedef struct {
+  const char *strSocketPath;
+  const char *strHost;
+  int nPort;
+} LoadTarget;
+
+/** The latency of every frame that answered a player, which grows as frames are received. */
+typedef struct {
+  double *nLatencies;
+  long nLatencyCount;
+  long nLatencyCapacity;
+} LoadLatencies;
+
+/** What a share of the players did, which every process reports to the first one along with its latencies. */
+typedef struct {
+  long nIdleConnectedCount;
+  long nIdleClosedCount;
+  long nCompletedGameCount;
+  long nFailedGameCount;
+  long nLatencyCount;
+  double nElapsedSeconds;
+} LoadResult;
+
+/** Raises the limit on open file descriptors as high as it goes, since every player holds one. */
+static void raiseFileDescriptorLimit(void) {
+  struct rlimit fileDescriptorLimit;
+
+  if (getrlimit(RLIMIT_NOFILE, &fileDescriptorLimit) != 0) return;
+
+  fileDescriptorLimit.rlim_cur = fileDescriptorLimit.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &fileDescriptorLimit);
+}
+
+/**
+ * Connects to the server and makes the connection non-blocking.
+ * @param pLoadTarget Where the server listens.
+ * @returns The file descriptor of the connection, or `-1` if it could not be made.
+ */
+static int connectLoadTarget(const LoadTarget *pLoadTarget) {
+  int nFileDescriptor;
+  int nStatus;
+
+  if (pLoadTarget->strSocketPath != NULL) {
+    struct sockaddr_un socketAddress;
+
+    memset(&socketAddress, 0, sizeof(socketAddress));
+    socketAddress.sun_family = AF_UNIX;
+    strncpy(socketAddress.sun_path, pLoadTarget->strSocketPath, sizeof(socketAddress.sun_path) - 1);
+
+    if ((nFileDescriptor = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) return -1;
+
+    nStatus = connect(nFileDescriptor, (struct sockaddr *)&socketAddress, sizeof(socketAddress));
+  } else {
+    struct sockaddr_in socketAddress;
+
+    memset(&socketAddress, 0, sizeof(socketAddress));
+    socketAddress.sin_family = AF_INET;
+    socketAddress.sin_port = htons((uint16_t)pLoadTarget->nPort);
+
+    if (inet_pton(AF_INET, pLoadTarget->strHost, &socketAddress.sin_addr) != 1) return -1;
+
+    if ((nFileDescriptor = socket(AF_INET, SOCK_STREAM, 0)) < 0) return -1;
+
+    nStatus = connect(nFileDescriptor, (struct sockaddr *)&socketAddress, sizeof(socketAddress));
+  }
+
+  int nFlags = fcntl(nFileDescriptor, F_GETFL, 0);
+
+  if (nStatus != 0 || nFlags < 0 || fcntl(nFileDescriptor, F_SETFL, nFlags | O_NONBLOCK) != 0) {
+    close(nFileDescriptor);
+
+    return -1;
+  }
+
+  return nFileDescriptor;
+}
+
+/**
+ * Connects the passed player to the server to play a new game.
+ * @param[in,out] pLoadPlayer The player to connect.
+ * @param pLoadTarget Where the server listens.
+ * @param nEpollFileDescriptor The epoll instance.
+ * @returns `0` if the player was connected or `-1` if it could not be.
+ */
+static int startLoadPlayer(LoadPlayer *pLoadPlayer, const LoadTarget *pLoadTarget, int nEpollFileDescriptor) {
+  struct epoll_event event;
+
+  if ((pLoadPlayer->nFileDescriptor = connectLoadTarget(pLoadTarget)) < 0) return -1;
+
+  pLoadPlayer->nFrameLength = 0;
+  pLoadPlayer->bHasAnswered = 0;
+  pLoadPlayer->nDayStep = 0;
+
+  event.events = EPOLLIN;
+  event.data.ptr = pLoadPlayer;
+
+  if (epoll_ctl(nEpollFileDescriptor, EPOLL_CTL_ADD, pLoadPlayer->nFileDescriptor, &event) != 0) {
+    close(pLoadPlayer->nFileDescriptor);
+
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * Appends the passed output to the frame that the player is receiving, growing the frame if it is full.
+ * @param[in,out] pLoadPlayer The player receiving the frame.
+ * @param pOutput The output to append.
+ * @param nOutputLength The number of bytes to append.
+ * @returns `0` if the output was appended or `-1` if the frame could not grow.
+ */
+static int appendLoadFrame(LoadPlayer *pLoadPlayer, const char *pOutput, size_t nOutputLength) {
+  if (pLoadPlayer->nFrameLength + nOutputLength + 1 > pLoadPlayer->nFrameCapacity) {
+    size_t nFrameCapacity = pLoadPlayer->nFrameCapacity > 0 ? pLoadPlayer->nFrameCapacity : LOAD_FRAME_INITIAL_CAPACITY;
+
+    while (pLoadPlayer->nFrameLength + nOutputLength + 1 > nFrameCapacity) nFrameCapacity *= 2;
+
+    char *strFrame = realloc(pLoadPlayer->strFrame, nFrameCapacity);
+
+    if (strFrame == NULL) return -1;
+
+    pLoadPlayer->strFrame = strFrame;
+    pLoadPlayer->nFrameCapacity = nFrameCapacity;
+  }
+
+  memcpy(pLoadPlayer->strFrame + pLoadPlayer->nFrameLength, pOutput, nOutputLength);
+  pLoadPlayer->nFrameLength += nOutputLength;
+  pLoadPlayer->strFrame[pLoadPlayer->nFrameLength] = '\0';
+
+  return 0;
+}
+
+/**
+ * Checks whether the frame that the player is receiving is complete, which it is once it ends with an input marker: a
+ * new line, the marker's padding, and `% `.
+ * @param pLoadPlayer The player receiving the frame.
+ * @returns `1` if the frame is complete or `0` if more of it is on its way.
+ */
+static int isLoadFrameComplete(const LoadPlayer *pLoadPlayer) {
+  const char *strFrame = pLoadPlayer->strFrame;
+  size_t nFrameIndex = pLoadPlayer->nFrameLength;
+
+  if (nFrameIndex < 3 || strFrame[nFrameIndex - 1] != ' ' || strFrame[nFrameIndex - 2] != '%') return 0;
+
+  for (nFrameIndex -= 3; nFrameIndex > 0 && strFrame[nFrameIndex] == ' '; nFrameIndex--) continue;
+
+  return strFrame[nFrameIndex] == '\n';
+}
+
+/**
+ * Records the latency of a frame, from the moment its answer was sent until all of it was received.
+ * @param[in,out] pLoadLatencies The latencies to record into.
+ * @param nLatencySeconds The latency of the frame.
+ * @returns `0` if the latency was recorded or `-1` if there was no room for it.
+ */
+static int recordLoadLatency(LoadLatencies *pLoadLatencies, double nLatencySeconds) {
+  if (pLoadLatencies->nLatencyCount == pLoadLatencies->nLatencyCapacity) {
+    long nLatencyCapacity = pLoadLatencies->nLatencyCapacity > 0 ? pLoadLatencies->nLatencyCapacity * 2
+                                                                 : LOAD_INITIAL_LATENCY_CAPACITY;
+    double *nLatencies = realloc(pLoadLatencies->nLatencies, sizeof(double) * (size_t)nLatencyCapacity);
+
+    if (nLatencies == NULL) return -1;
+
+    pLoadLatencies->nLatencies = nLatencies;
+    pLoadLatencies->nLatencyCapacity = nLatencyCapacity;
+  }
+
+  pLoadLatencies->nLatencies[pLoadLatencies->nLatencyCount++] = nLatencySeconds;
+
+  return 0;
+}
+
+/**
+ * Answers the prompt that the player's complete frame ends with and starts timing the next frame.
+ * @param[in,out] pLoadPlayer The player to answer for.
+ * @returns `0` if the answer was sent or `-1` if the frame has no known prompt or the answer could not be sent.
+ */
+static int answerLoadFrame(LoadPlayer *pLoadPlayer) {
+  const char *strPromptText;
+  const ScriptedPrompt *pPrompt = findScriptedPrompt(pLoadPlayer->strFrame, &strPromptText);
+  char strAnswer[SCRIPTED_ANSWER_SIZE + 1];
+
+  if (pPrompt == NULL) return -1;
+
+  chooseScriptedAnswer(pPrompt, strPromptText, &pLoadPlayer->nDayStep, strAnswer);
+  strcat(strAnswer, "\n");
+
+  pLoadPlayer->nFrameLength = 0;
+  pLoadPlayer->bHasAnswered = 1;
+  pLoadPlayer->nAnswerSeconds = getMonotonicNanoseconds() / 1e9;
+
+  // An answer is a few bytes, which an empty socket buffer always takes at once.
+  return write(pLoadPlayer->nFileDescriptor, strAnswer, strlen(strAnswer)) == (ssize_t)strlen(strAnswer) ? 0 : -1;
+}
+
+/**
+ * Compares two latencies for sorting them in ascending order.
+ * @param pFirstLatency The first latency.
+ * @param pSecondLatency The second latency.
+ * @returns A negative value, zero, or a positive value if the first latency is shorter than, equal to, or longer than
+ * the second.
+ */
+static int compareLatencies(const void *pFirstLatency, const void *pSecondLatency) {
+  double nFirstLatency = *(const double *)pFirstLatency;
+  double nSecondLatency = *(const double *)pSecondLatency;
+
+  return (nFirstLatency > nSecondLatency) - (nFirstLatency < nSecondLatency);
+}
+
+/**
+ * Plays the passed number of games across the passed number of active players, while the idle players sit at their
+ * first prompt until the games are over.
+ * @param pLoadTarget Where the server listens.
+ * @param nPlayerCount The number of active players.
+ * @param nIdleCount The number of idle players.
+ * @param nGameCount The number of games to play, which must be at least the number of active players.
+ * @param[out] pLoadResult What the players did.
+ * @param[out] pLoadLatencies The latency of every frame that answered a player.
+ * @returns `0` if the players could be started or `-1` if they could not.
+ */
+static int runLoadPlayers(const LoadTarget *pLoadTarget, long nPlayerCount, long nIdleCount, long nGameCount,
+                          LoadResult *pLoadResult, LoadLatencies *pLoadLatencies) {
+  int nEpollFileDescriptor = epoll_create1(0);
+  LoadPlayer *pLoadPlayers = calloc((size_t)(nPlayerCount + nIdleCount), sizeof(LoadPlayer));
+  char *pReadBuffer = malloc(LOAD_READ_BUFFER_SIZE);
+
+  memset(pLoadResult, 0, sizeof(LoadResult));
+
+  if (nEpollFileDescriptor < 0 || pLoadPlayers == NULL || pReadBuffer == NULL) {
+    fprintf(stderr, "Could not allocate the load generator.\n");
+    free(pLoadPlayers);
+    free(pReadBuffer);
+
+    return -1;
+  }
+
+  // Idle players connect first and never answer, so they only cost the server the memory of their sessions.
+  for (long nPlayerIndex = nPlayerCount; nPlayerIndex < nPlayerCount + nIdleCount; nPlayerIndex++) {
+    pLoadPlayers[nPlayerIndex].bIsIdle = 1;
+
+    if (startLoadPlayer(&pLoadPlayers[nPlayerIndex], pLoadTarget, nEpollFileDescriptor) != 0) {
+      fprintf(stderr, "Could only connect %ld idle players.\n", pLoadResult->nIdleConnectedCount);
+
+      break;
+    }
+
+    pLoadResult->nIdleConnectedCount++;
+  }
+
+  long nStartedGameCount = 0;
+  double nStartSeconds = getMonotonicNanoseconds() / 1e9;
+
+  for (long nPlayerIndex = 0; nPlayerIndex < nPlayerCount; nPlayerIndex++, nStartedGameCount++) {
+    if (startLoadPlayer(&pLoadPlayers[nPlayerIndex], pLoadTarget, nEpollFileDescriptor) != 0) {
+      fprintf(stderr, "Could not connect to the server.\n");
+      free(pLoadPlayers);
+      free(pReadBuffer);
+
+      return -1;
+    }
+  }
+
+  struct epoll_event events[LOAD_EVENT_COUNT];
+
+  while (pLoadResult->nCompletedGameCount + pLoadResult->nFailedGameCount < nGameCount) {
+    int nEventCount = epoll_wait(nEpollFileDescriptor, events, LOAD_EVENT_COUNT, -1);
+
+    if (nEventCount < 0 && errno == EINTR) continue;
+
+    if (nEventCount < 0) break;
+
+    for (int nEventIndex = 0; nEventIndex < nEventCount; nEventIndex++) {
+      LoadPlayer *pLoadPlayer = events[nEventIndex].data.ptr;
+      ssize_t nReadCount = read(pLoadPlayer->nFileDescriptor, pReadBuffer, LOAD_READ_BUFFER_SIZE);
+      int bIsFailed = 0;
+
+      if (nReadCount < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) continue;
+
+      if (pLoadPlayer->bIsIdle) {
+        if (nReadCount <= 0) {
+          close(pLoadPlayer->nFileDescriptor);
+          pLoadResult->nIdleClosedCount++;
+        }
+
+        continue;
+      }
+
+      if (nReadCount > 0) {
+        bIsFailed = appendLoadFrame(pLoadPlayer, pReadBuffer, (size_t)nReadCount) != 0;
+
+        if (!bIsFailed && isLoadFrameComplete(pLoadPlayer)) {
+          double nLatencySeconds = getMonotonicNanoseconds() / 1e9 - pLoadPlayer->nAnswerSeconds;
+
+          if (pLoadPlayer->bHasAnswered) recordLoadLatency(pLoadLatencies, nLatencySeconds);
+
+          bIsFailed = answerLoadFrame(pLoadPlayer) != 0;
+        }
+
+        if (!bIsFailed) continue;
+      }
+
+      // The server closes the connection once it has sent the end screen, which is the last frame of the game.
+      if (!bIsFailed && pLoadPlayer->nFrameLength > 0 && pLoadPlayer->bHasAnswered) {
+        recordLoadLatency(pLoadLatencies, getMonotonicNanoseconds() / 1e9 - pLoadPlayer->nAnswerSeconds);
+        pLoadResult->nCompletedGameCount++;
+      } else {
+        pLoadResult->nFailedGameCount++;
+      }
+
+      close(pLoadPlayer->nFileDescriptor);
+
+      if (nStartedGameCount < nGameCount) {
+        if (startLoadPlayer(pLoadPlayer, pLoadTarget, nEpollFileDescriptor) != 0) {
+          pLoadResult->nFailedGameCount += nGameCount - nStartedGameCount;
+          nStartedGameCount = nGameCount;
+        } else {
+          nStartedGameCount++;
+        }
+      }
+    }
+  }
+
+  pLoadResult->nElapsedSeconds = getMonotonicNanoseconds() / 1e9 - nStartSeconds;
+  pLoadResult->nLatencyCount = pLoadLatencies->nLatencyCount;
+
+  for (long nPlayerIndex = 0; nPlayerIndex < nPlayerCount + pLoadResult->nIdleConnectedCount; nPlayerIndex++) {
+    free(pLoadPlayers[nPlayerIndex].strFrame);
+  }
+
+  free(pLoadPlayers);
+  free(pReadBuffer);
+  close(nEpollFileDescriptor);
+
+  return 0;
+}
+
+/**
+ * Transfers the passed number of bytes through a pipe, retrying until all of them have been transferred.
+ * @param nFileDescriptor The end of the pipe.
+ * @param pBytes The bytes to write, or where to store the bytes read.
+ * @param nByteCount The number of bytes to transfer.
+ * @param bIsWriting Whether to write the bytes instead of reading them.
+ * @returns `0` if every byte was transferred or `-1` if the pipe was closed or broken.
+ */
+static int transferLoadPipe(int nFileDescriptor, void *pBytes, size_t nByteCount, int bIsWriting) {
+  char *pCursor = pBytes;
+
+  while (nByteCount > 0) {
+    ssize_t nTransferredCount = bIsWriting ? write(nFileDescriptor, pCursor, nByteCount)
+                                           : read(nFileDescriptor, pCursor, nByteCount);
+
+    if (nTransferredCount < 0 && errno == EINTR) continue;
+
+    if (nTransferredCount <= 0) return -1;
+
+    pCursor += nTransferredCount;
+    nByteCount -= (size_t)nTransferredCount;
+  }
+
+  return 0;
+}
+
+/**
+ * Gets the share of the passed count that a process plays, which spreads the remainder over the first processes.
+ * @param nCount The count to share.
+ * @param nProcessIndex The index of the process.
+ * @param nProcessCount The number of processes.
+ * @returns The share of the process.
+ */
+static long getLoadShare(long nCount, int nProcessIndex, int nProcessCount) {
+  return nCount / nProcessCount + (nProcessIndex < nCount % nProcessCount ? 1 : 0);
+}
+
+/**
+ * Plays the players across the passed number of processes, each of which plays its share with its own event loop and
+ * reports what its players did and their latencies to this one through a pipe.
+ * @param pLoadTarget Where the server listens.
+ * @param nPlayerCount The number of active players.
+ * @param nIdleCount The number of idle players.
+ * @param nGameCount The number of games to play, which must be at least the number of active players.
+ * @param nProcessCount The number of processes, which must be at most the number of active players.
+ * @param[out] pLoadResult What every player did, whose elapsed time is that of the slowest process.
+ * @param[out] pLoadLatencies The latency of every frame that answered a player.
+ * @returns `0` if every process reported or `-1` if any of them could not.
+ */
+static int runLoadProcesses(const LoadTarget *pLoadTarget, long nPlayerCount, long nIdleCount, long nGameCount,
+                            int nProcessCount, LoadResult *pLoadResult, LoadLatencies *pLoadLatencies) {
+  int *nPipeFileDescriptors = malloc(sizeof(int) * (size_t)nProcessCount);
+  int nStartedProcessCount = 0;
+  int nStatus = 0;
+
+  memset(pLoadResult, 0, sizeof(LoadResult));
+
+  if (nPipeFileDescriptors == NULL) return -1;
+
+  // Every process must start before any is waited on, so they all play at the same time.
+  for (; nStartedProcessCount < nProcessCount; nStartedProcessCount++) {
+    int nProcessIndex = nStartedProcessCount;
+    int nPipe[2];
+
+    if (pipe(nPipe) != 0) break;
+
+    pid_t nProcessId = fork();
+
+    if (nProcessId == 0) {
+      LoadResult loadResult;
+
+      close(nPipe[0]);
+
+      for (int nPipeIndex = 0; nPipeIndex < nProcessIndex; nPipeIndex++) close(nPipeFileDescriptors[nPipeIndex]);
+
+      if (runLoadPlayers(pLoadTarget, getLoadShare(nPlayerCount, nProcessIndex, nProcessCount),
+                         getLoadShare(nIdleCount, nProcessIndex, nProcessCount),
+                         getLoadShare(nGameCount, nProcessIndex, nProcessCount), &loadResult, pLoadLatencies) != 0 ||
+          transferLoadPipe(nPipe[1], &loadResult, sizeof(LoadResult), 1) != 0 ||
+          transferLoadPipe(nPipe[1], pLoadLatencies->nLatencies, sizeof(double) * (size_t)loadResult.nLatencyCount,
+                           1) != 0) {
+        _exit(1);
+      }
+
+      _exit(0);
+    }
+
+    close(nPipe[1]);
+
+    if (nProcessId < 0) {
+      close(nPipe[0]);
+
+      break;
+    }
+
+    nPipeFileDescriptors[nProcessIndex] = nPipe[0];
+  }
+
+  if (nStartedProcessCount < nProcessCount) {
+    fprintf(stderr, "Could only start %d load processes.\n", nStartedProcessCount);
+    nStatus = -1;
+  }
+
+  for (int nProcessIndex = 0; nProcessIndex < nStartedProcessCount; nProcessIndex++) {
+    int nPipeFileDescriptor = nPipeFileDescriptors[nProcessIndex];
+    LoadResult loadResult;
+
+    if (transferLoadPipe(nPipeFileDescriptor, &loadResult, sizeof(LoadResult), 0) != 0) {
+      nStatus = -1;
+      close(nPipeFileDescriptor);
+
+      continue;
+    }
+
+    for (long nLatencyIndex = 0; nLatencyIndex < loadResult.nLatencyCount; nLatencyIndex += LOAD_PIPE_LATENCY_COUNT) {
+      double nLatencies[LOAD_PIPE_LATENCY_COUNT];
+      long nBatchCount = loadResult.nLatencyCount - nLatencyIndex < LOAD_PIPE_LATENCY_COUNT
+                             ? loadResult.nLatencyCount - nLatencyIndex
+                             : LOAD_PIPE_LATENCY_COUNT;
+
+      if (transferLoadPipe(nPipeFileDescriptor, nLatencies, sizeof(double) * (size_t)nBatchCount, 0) != 0) {
+        nStatus = -1;
+
+        break;
+      }
+
+      for (long nBatchIndex = 0; nBatchIndex < nBatchCount; nBatchIndex++) {
+        if (recordLoadLatency(pLoadLatencies, nLatencies[nBatchIndex]) != 0) nStatus = -1;
+      }
+    }
+
+    pLoadResult->nIdleConnectedCount += loadResult.nIdleConnectedCount;
+    pLoadResult->nIdleClosedCount += loadResult.nIdleClosedCount;
+    pLoadResult->nCompletedGameCount += loadResult.nCompletedGameCount;
+    pLoadResult->nFailedGameCount += loadResult.nFailedGameCount;
+
+    if (loadResult.nElapsedSeconds > pLoadResult->nElapsedSeconds) {
+      pLoadResult->nElapsedSeconds = loadResult.nElapsedSeconds;
+    }
+
+    close(nPipeFileDescriptor);
+  }
+
+  while (wait(NULL) > 0) continue;
+
+  pLoadResult->nLatencyCount = pLoadLatencies->nLatencyCount;
+  free(nPipeFileDescriptors);
+
+  return nStatus;
+}
+
+/**
+ * Prints out how to use the load generator to the console.
+ * @param strProgramName The name the load generator was run with.
+ */
+static void printLoadUsage(const char *strProgramName) {
+  fprintf(stderr,
+          "Usage: %s (--unix PATH | --port N [--host ADDRESS]) [--players N] [--idle N] [--games N] [--processes N]\n",
+          strProgramName);
+}
+
+int main(int argc, char *argv[]) {
+  LoadTarget loadTarget = {NULL, DEFAULT_LOAD_HOST, 0};
+  long nPlayerCount = DEFAULT_LOAD_PLAYER_COUNT;
+  long nIdleCount = DEFAULT_LOAD_IDLE_COUNT;
+  long nGameCount = -1;
+  int nProcessCount = DEFAULT_LOAD_PROCESS_COUNT;
+
+  for (int nArgumentIndex = 1; nArgumentIndex < argc; nArgumentIndex++) {
+    const char *strOption = argv[nArgumentIndex];
+
+    if (nArgumentIndex + 1 >= argc) {
+      printLoadUsage(argv[0]);
+
+      return 1;
+    }
+
+    const char *strValue = argv[++nArgumentIndex];
+
+    if (strcmp(strOption, "--unix") == 0) {
+      loadTarget.strSocketPath = strValue;
+    } else if (strcmp(strOption, "--port") == 0) {
+      loadTarget.nPort = atoi(strValue);
+    } else if (strcmp(strOption, "--host") == 0) {
+      loadTarget.strHost = strValue;
+    } else if (strcmp(strOption, "--players") == 0) {
+      nPlayerCount = strtol(strValue, NULL, 10);
+    } else if (strcmp(strOption, "--idle") == 0) {
+      nIdleCount = strtol(strValue, NULL, 10);
+    } else if (strcmp(strOption, "--games") == 0) {
+      nGameCount = strtol(strValue, NULL, 10);
+    } else if (strcmp(strOption, "--processes") == 0) {
+      nProcessCount = atoi(strValue);
+    } else {
+      printLoadUsage(argv[0]);
+
+      return 1;
+    }
+  }
+
+  // Every active player plays one game unless told otherwise.
+  if (nGameCount < 0) nGameCount = nPlayerCount;
+
+  if ((loadTarget.strSocketPath == NULL) == (loadTarget.nPort <= 0) || loadTarget.nPort > 65535 || nPlayerCount < 1 ||
+      nIdleCount < 0 || nGameCount < nPlayerCount || nProcessCount < 1 || nProcessCount > nPlayerCount) {
+    printLoadUsage(argv[0]);
+
+    return 1;
+  }
+
+  raiseFileDescriptorLimit();
+  signal(SIGPIPE, SIG_IGN);
+
+  LoadResult loadResult;
+  LoadLatencies loadLatencies = {NULL, 0, 0};
+  int nStatus = nProcessCount > 1 ? runLoadProcesses(&loadTarget, nPlayerCount, nIdleCount, nGameCount, nProcessCount,
+                                                     &loadResult, &loadLatencies)
+                                  : runLoadPlayers(&loadTarget, nPlayerCount, nIdleCount, nGameCount, &loadResult,
+                                                   &loadLatencies);
+
+  if (nStatus != 0) {
+    free(loadLatencies.nLatencies);
+
+    return 1;
+  }
+
+  double nElapsedSeconds = loadResult.nElapsedSeconds;
+  long nFrameCount = loadLatencies.nLatencyCount;
+
+  printf("Players: %ld active | %ld idle (%ld dropped) | Processes: %d | Games: %ld completed | %ld failed\n",
+         nPlayerCount, loadResult.nIdleConnectedCount, loadResult.nIdleClosedCount, nProcessCount,
+         loadResult.nCompletedGameCount, loadResult.nFailedGameCount);
+  printf("Elapsed: %.3f s | %.0f games/s | %.0f frames/s\n", nElapsedSeconds,
+         loadResult.nCompletedGameCount / nElapsedSeconds, nFrameCount / nElapsedSeconds);
+
+  if (nFrameCount > 0) {
+    double *nLatencies = loadLatencies.nLatencies;
+
+    qsort(nLatencies, (size_t)nFrameCount, sizeof(double), compareLatencies);
+
+    printf("Frames: %ld | Answer to frame: p50 %.1f us | p90 %.1f us | p99 %.1f us | max %.1f us\n", nFrameCount,
+           nLatencies[nFrameCount / 2] * 1e6, nLatencies[nFrameCount * 9 / 10] * 1e6,
+           nLatencies[nFrameCount * 99 / 100] * 1e6, nLatencies[nFrameCount - 1] * 1e6);
+  }
+
+  free(loadLatencies.nLatencies);
+
+  return loadResult.nFailedGameCount == 0 ? 0 : 1;
+}
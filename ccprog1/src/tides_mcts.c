@@ -0,0 +1,178 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "engine.h"
+#include "mcts.h"
+#include "policy.h"
+#include "prompts.h"
+#include "simulation.h"
+#include "thread_pool.h"
+
+#define DEFAULT_SEARCHED_GAME_COUNT 100
+#define DEFAULT_SEARCHED_INITIAL_BALANCE 1000
+#define DEFAULT_SEARCHED_PROFIT_TARGET 100
+#define DEFAULT_SEARCH_TIME_BUDGET 10
+
+/**
+ * Prints out how to use the search bot to the console.
+ * @param strProgramName The name the search bot was run with.
+ */
+static void printSearchUsage(const char *strProgramName) {
+  fprintf(stderr,
+          "Usage: %s [--games N] [--threads N] [--budget MS] [--rollouts N] [--balance N] [--target N] [--seed N]\n",
+          strProgramName);
+}
+
+/**
+ * Prints out a single row of the comparison between policies to the console.
+ * @param strPolicyName The name of the policy.
+ * @param pSimulationSummary The summary of the policy's games.
+ */
+static void printPolicyComparison(const char *strPolicyName, const SimulationSummary *pSimulationSummary) {
+  printf("  %-8s win rate %6.2f%% | mean profit %9.1f%% | p50 %d%% | p10 %d%%\n", strPolicyName,
+         pSimulationSummary->nWinCount * 100.0 / pSimulationSummary->nGameCount,
+         (double)pSimulationSummary->nProfitSum / pSimulationSummary->nGameCount,
+         getSimulationProfitPercentile(pSimulationSummary, 50), getSimulationProfitPercentile(pSimulationSummary, 10));
+}
+
+int main(int argc, char *argv[]) {
+  long nGameCount = DEFAULT_SEARCHED_GAME_COUNT;
+  int nWorkerCount = getProcessorCount();
+  int nTimeBudgetMilliseconds = DEFAULT_SEARCH_TIME_BUDGET;
+  long nRolloutBudget = 0;
+  int nPlayerInitialBalance = DEFAULT_SEARCHED_INITIAL_BALANCE;
+  int nPlayerProfitTarget = DEFAULT_SEARCHED_PROFIT_TARGET;
+  uint64_t nBaseSeed = (uint64_t)time(NULL);
+
+  for (int nArgumentIndex = 1; nArgumentIndex < argc; nArgumentIndex++) {
+    const char *strOption = argv[nArgumentIndex];
+
+    if (nArgumentIndex + 1 >= argc) {
+      printSearchUsage(argv[0]);
+
+      return 1;
+    }
+
+    const char *strValue = argv[++nArgumentIndex];
+
+    if (strcmp(strOption, "--games") == 0) {
+      nGameCount = strtol(strValue, NULL, 10);
+    } else if (strcmp(strOption, "--threads") == 0) {
+      nWorkerCount = atoi(strValue);
+    } else if (strcmp(strOption, "--budget") == 0) {
+      nTimeBudgetMilliseconds = atoi(strValue);
+    } else if (strcmp(strOption, "--rollouts") == 0) {
+      nRolloutBudget = strtol(strValue, NULL, 10);
+    } else if (strcmp(strOption, "--balance") == 0) {
+      nPlayerInitialBalance = atoi(strValue);
+    } else if (strcmp(strOption, "--target") == 0) {
+      nPlayerProfitTarget = atoi(strValue);
+    } else if (strcmp(strOption, "--seed") == 0) {
+      if (parseRandomSeed(strValue, &nBaseSeed) != 0) {
+        printSearchUsage(argv[0]);
+
+        return 1;
+      }
+    } else {
+      printSearchUsage(argv[0]);
+
+      return 1;
+    }
+  }
+
+  if (nGameCount < 1 || nWorkerCount < 1 || nTimeBudgetMilliseconds < 0 || nRolloutBudget < 0 ||
+      nPlayerInitialBalance < MINIMUM_INITIAL_BALANCE || nPlayerProfitTarget < MINIMUM_TARGET_PROFIT) {
+    printSearchUsage(argv[0]);
+
+    return 1;
+  }
+
+  MctsSearch mctsSearch;
+  SimulationSummary *pSearchSummary = malloc(sizeof(SimulationSummary));
+  SimulationSummary *pGreedySummary = malloc(sizeof(SimulationSummary));
+
+  if (pSearchSummary == NULL || pGreedySummary == NULL ||
+      createMctsSearch(&mctsSearch, nWorkerCount, nTimeBudgetMilliseconds, nRolloutBudget, nBaseSeed) != 0) {
+    fprintf(stderr, "Could not start the search.\n");
+    free(pSearchSummary);
+    free(pGreedySummary);
+
+    return 1;
+  }
+
+  resetSimulationSummary(pSearchSummary);
+  resetSimulationSummary(pGreedySummary);
+
+  long nDecisionCount = 0;
+
+  // Games are played one at a time, since every decision already searches on all workers.
+  for (long nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    GameState gameState;
+
+    initializeGame(&gameState, 0, nPlayerInitialBalance, nPlayerProfitTarget, nBaseSeed + nGameIndex);
+
+    while (!isGameOver(&gameState)) {
+      if (stepGame(&gameState, chooseMctsAction(&mctsSearch, &gameState)).nStatus != GAME_STEP_SUCCESS) break;
+
+      nDecisionCount++;
+    }
+
+    recordSimulatedGame(pSearchSummary, gameState.nPlayerProfit, nPlayerProfitTarget);
+    recordSimulatedGame(pGreedySummary,
+                        simulateGame(GREEDY_POLICY_ID, NULL, nPlayerInitialBalance, nPlayerProfitTarget,
+                                     nBaseSeed + nGameIndex),
+                        nPlayerProfitTarget);
+  }
+
+  printf("Policy: mcts | Games: %ld | Threads: %d | Seed: %" PRIu64 "\n", nGameCount, nWorkerCount, nBaseSeed);
+  printf("Initial balance: %d | Profit target: %d%% | Budget: %d ms", nPlayerInitialBalance, nPlayerProfitTarget,
+         nTimeBudgetMilliseconds);
+
+  if (nRolloutBudget > 0) printf(" or %ld rollouts per thread", nRolloutBudget);
+
+  printf(" per decision\n");
+  printf("Decisions: %ld | Rollouts: %ld (%.0f rollouts/s, %.0f per decision)\n", nDecisionCount,
+         mctsSearch.nRolloutCount, mctsSearch.nRolloutCount / mctsSearch.nSearchSeconds,
+         (double)mctsSearch.nRolloutCount / nDecisionCount);
+  printf("Transpositions: %ld rollouts replaced (%.1f%%) | %ld hits of %ld probes | %ld stores\n",
+         mctsSearch.nTranspositionCount, mctsSearch.nTranspositionCount * 100.0 / mctsSearch.nRolloutCount,
+         mctsSearch.transpositionTable.nHitCount,
+         mctsSearch.transpositionTable.nHitCount + mctsSearch.transpositionTable.nMissCount,
+         mctsSearch.transpositionTable.nStoreCount);
+
+  printf("\n");
+
+  printf("Results on the same seeds:\n");
+  printPolicyComparison("mcts", pSearchSummary);
+  printPolicyComparison("greedy", pGreedySummary);
+
+  destroyMctsSearch(&mctsSearch);
+  free(pSearchSummary);
+  free(pGreedySummary);
+
+  return 0;
+}
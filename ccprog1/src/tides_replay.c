@@ -0,0 +1,182 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "clock.h"
+#include "engine.h"
+#include "journal.h"
+
+/**
+ * Prints out how to use the replayer to the console.
+ * @param strProgramName The name the replayer was run with.
+ */
+static void printReplayUsage(const char *strProgramName) {
+  fprintf(stderr, "Usage: %s --journal FILE [--repeat N] [--list N] [--seek SESSION:TURN]\n", strProgramName);
+}
+
+/**
+ * Prints out the state of a game that was sought to in the passed journal to the console, followed by the actions
+ * that are left in its turn.
+ * @param[in,out] pActionJournalReader The journal to seek through.
+ * @param nSessionNumber The number of the game, which is `1` for the first game of the journal.
+ * @param nTurn The turn to seek to.
+ * @returns `0` if the game was printed or `-1` if the journal could not be sought through.
+ */
+static int printSoughtGame(ActionJournalReader *pActionJournalReader, long nSessionNumber, int nTurn) {
+  GameState gameState;
+  uint64_t nStartNanoseconds = getMonotonicNanoseconds();
+
+  if (seekJournalTurn(pActionJournalReader, nSessionNumber - 1, nTurn, &gameState) != 0) return -1;
+
+  uint64_t nSeekNanoseconds = getMonotonicNanoseconds() - nStartNanoseconds;
+
+  printf("Session %ld, turn %d (sought in %.1f us)\n", nSessionNumber, gameState.nPlayerTurns, nSeekNanoseconds / 1e3);
+  printf("  Port %c | balance %d | profit %d%% of %d%% | cargo %d/%d/%d/%d of %d\n", gameState.cCurrentPortId,
+         gameState.nPlayerBalance, gameState.nPlayerProfit, gameState.nPlayerProfitTarget,
+         gameState.nShipCoconutCargoAmount, gameState.nShipRiceCargoAmount, gameState.nShipSilkCargoAmount,
+         gameState.nShipGunCargoAmount, gameState.nShipCargoLimit);
+  printf("  Prices %d/%d/%d/%d | storm signal %d for %d turns\n", gameState.nCoconutMarketPrice,
+         gameState.nRiceMarketPrice, gameState.nSilkMarketPrice, gameState.nGunMarketPrice,
+         gameState.nStormWindSignalNumber, gameState.nStormTurnDuration);
+
+  int nSoughtTurn = gameState.nPlayerTurns;
+
+  // Steps forwards through the rest of the turn, which ends with the action that sails away.
+  while (gameState.nPlayerTurns == nSoughtTurn &&
+         replayJournalAction(pActionJournalReader, &gameState) == JOURNAL_READ_SUCCESS) {
+    printf("  -> balance %d | profit %d%% | turn %d\n", gameState.nPlayerBalance, gameState.nPlayerProfit,
+           gameState.nPlayerTurns);
+  }
+
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  const char *strJournalFilePath = NULL;
+  long nRepeatCount = 1;
+  long nListedSessionCount = 0;
+  long nSoughtSessionNumber = 0;
+  int nSoughtTurn = 0;
+
+  for (int nArgumentIndex = 1; nArgumentIndex < argc; nArgumentIndex++) {
+    const char *strOption = argv[nArgumentIndex];
+
+    if (nArgumentIndex + 1 >= argc) {
+      printReplayUsage(argv[0]);
+
+      return 1;
+    }
+
+    const char *strValue = argv[++nArgumentIndex];
+
+    if (strcmp(strOption, "--journal") == 0) {
+      strJournalFilePath = strValue;
+    } else if (strcmp(strOption, "--repeat") == 0) {
+      nRepeatCount = strtol(strValue, NULL, 10);
+    } else if (strcmp(strOption, "--list") == 0) {
+      nListedSessionCount = strtol(strValue, NULL, 10);
+    } else if (strcmp(strOption, "--seek") == 0) {
+      if (sscanf(strValue, "%ld:%d", &nSoughtSessionNumber, &nSoughtTurn) != 2) nSoughtSessionNumber = -1;
+    } else {
+      printReplayUsage(argv[0]);
+
+      return 1;
+    }
+  }
+
+  if (strJournalFilePath == NULL || nRepeatCount < 1 || nListedSessionCount < 0 || nSoughtSessionNumber < 0 ||
+      nSoughtTurn < 0) {
+    printReplayUsage(argv[0]);
+
+    return 1;
+  }
+
+  ActionJournalReader actionJournalReader;
+
+  if (openActionJournalReader(&actionJournalReader, strJournalFilePath) != 0) {
+    fprintf(stderr, "Could not open the journal %s.\n", strJournalFilePath);
+
+    return 1;
+  }
+
+  if (nSoughtSessionNumber > 0) {
+    int nStatus = printSoughtGame(&actionJournalReader, nSoughtSessionNumber, nSoughtTurn);
+
+    closeActionJournalReader(&actionJournalReader);
+
+    if (nStatus != 0) fprintf(stderr, "Could not seek to turn %d of session %ld.\n", nSoughtTurn, nSoughtSessionNumber);
+
+    return nStatus != 0 ? 1 : 0;
+  }
+
+  long nSessionCount = 0;
+  long nTruncatedSessionCount = 0;
+  long nWinCount = 0;
+  long nTotalActionCount = 0;
+  uint64_t nStartNanoseconds = getMonotonicNanoseconds();
+
+  for (long nRepeatIndex = 0; nRepeatIndex < nRepeatCount; nRepeatIndex++) {
+    JournalSession session;
+    GameState gameState;
+    long nActionCount;
+    int nStatus;
+
+    rewindActionJournalReader(&actionJournalReader);
+
+    while ((nStatus = replayJournalSession(&actionJournalReader, &session, &gameState, &nActionCount)) !=
+           JOURNAL_READ_END) {
+      nSessionCount++;
+      nTotalActionCount += nActionCount;
+
+      if (gameState.nPlayerProfit >= gameState.nPlayerProfitTarget) nWinCount++;
+
+      if (nSessionCount <= nListedSessionCount) {
+        printf("Session %ld: seed %" PRIu64 " | balance %d | profit %d%% of %d%% | turns %d | actions %ld%s\n",
+               nSessionCount, session.nSeed, gameState.nPlayerBalance, gameState.nPlayerProfit,
+               gameState.nPlayerProfitTarget, gameState.nPlayerTurns, nActionCount,
+               nStatus == JOURNAL_READ_MALFORMED ? " (truncated)" : "");
+      }
+
+      // A corrupt or truncated game leaves the rest of the journal unreadable.
+      if (nStatus == JOURNAL_READ_MALFORMED) {
+        nTruncatedSessionCount++;
+
+        break;
+      }
+    }
+  }
+
+  double nElapsedSeconds = (getMonotonicNanoseconds() - nStartNanoseconds) / 1e9;
+
+  closeActionJournalReader(&actionJournalReader);
+
+  printf("Sessions: %ld (%ld truncated) | Actions: %ld | Wins: %ld\n", nSessionCount, nTruncatedSessionCount,
+         nTotalActionCount, nWinCount);
+  printf("Elapsed: %.3f s (%.0f sessions/s, %.0f actions/s)\n", nElapsedSeconds,
+         nElapsedSeconds > 0 ? nSessionCount / nElapsedSeconds : 0.0,
+         nElapsedSeconds > 0 ? nTotalActionCount / nElapsedSeconds : 0.0);
+
+  return 0;
+}
@@ -0,0 +1,921 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+// Exposes `MAP_ANONYMOUS`, which the workers share their statistics and metrics through.
+#define _DEFAULT_SOURCE
+
+#include <arpa/inet.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "clock.h"
+#include "metrics.h"
+#include "output.h"
+#include "session.h"
+#include "slab.h"
+#include "text_graphics.h"
+
+#define DEFAULT_SERVER_HOST "127.0.0.1"
+#define DEFAULT_SERVER_MAXIMUM_SESSION_COUNT 65536
+#define DEFAULT_SERVER_SEED 1
+
+#define SERVER_INPUT_BUFFER_SIZE 64
+#define SERVER_LISTEN_BACKLOG 4096
+#define SERVER_EVENT_COUNT 256
+
+/**
+ * A player's connection and the game it is playing, which lives in a slot of the server's session pool. The output of a
+ * frame is only kept in its arena once the player stops reading it, so an idle session holds no buffers of its own. The
+ * time its last frame was sent in full is kept until the player answers, which is its input wait.
+ */
+typedef struct {
+  int nFileDescriptor;
+  int bIsGameOver;
+  int bIsSkippingToken;
+  GameSession gameSession;
+  char strInput[SERVER_INPUT_BUFFER_SIZE];
+  size_t nInputLength;
+  SessionArena pendingOutput;
+  uint64_t nFrameSentNanoseconds;
+} ServerConnection;
+
+/** The totals of everything a worker has done since it started, along with the occupancy of its pools. */
+typedef struct {
+  long nAcceptedCount;
+  long nRejectedCount;
+  long nCompletedGameCount;
+  long nOpenCount;
+  long nMaximumOpenCount;
+  long nAnswerCount;
+  long nBlockedWriteCount;
+  uint64_t nReceivedByteCount;
+  uint64_t nSentByteCount;
+  long nUsedSessionSlotCount;
+  long nMaximumUsedSessionSlotCount;
+  long nSessionSlotCount;
+  long nUsedArenaChunkCount;
+  long nMaximumUsedArenaChunkCount;
+  long nArenaChunkCount;
+} ServerStatistics;
+
+/** What a worker publishes to the supervisor: its statistics and a copy of its metrics registry. */
+typedef struct {
+  ServerStatistics serverStatistics;
+  MetricsSnapshot metricsSnapshot;
+} ServerReport;
+
+/**
+ * Everything a single worker's event loop owns: its sockets, the sink that every frame is rendered into, the pools that
+ * its sessions and their unsent output are allocated from, and its statistics, which it reports to the supervisor.
+ */
+typedef struct {
+  int nListenerFileDescriptor;
+  int nEpollFileDescriptor;
+  OutputSink outputSink;
+  uint64_t nNextSeed;
+  uint64_t nSeedStep;
+  long nMaximumSessionCount;
+  SlabPool connectionPool;
+  SlabPool chunkPool;
+  ServerStatistics serverStatistics;
+  ServerReport *pPublishedReport;
+} Server;
+
+static volatile sig_atomic_t bIsStopping = 0;
+static volatile sig_atomic_t bIsReportRequested = 0;
+
+/**
+ * Asks the server to stop once it has handled the events it is handling, which runs when it receives `SIGINT` or
+ * `SIGTERM`. The supervisor then stops its workers the same way.
+ * @param nSignalNumber The number of the signal.
+ */
+static void stopServer(int nSignalNumber) {
+  (void)nSignalNumber;
+
+  bIsStopping = 1;
+}
+
+/**
+ * Asks the supervisor to print out the statistics and metrics of its workers once it wakes up, which runs when it
+ * receives `SIGUSR1`.
+ * @param nSignalNumber The number of the signal.
+ */
+static void requestServerReport(int nSignalNumber) {
+  (void)nSignalNumber;
+
+  bIsReportRequested = 1;
+}
+
+/**
+ * Wakes the supervisor up when a worker exits, which runs when it receives `SIGCHLD`.
+ * @param nSignalNumber The number of the signal.
+ */
+static void wakeServerSupervisor(int nSignalNumber) { (void)nSignalNumber; }
+
+/**
+ * Makes reads and writes on the passed file descriptor return immediately instead of waiting.
+ * @param nFileDescriptor The file descriptor.
+ * @returns `0` if the file descriptor is non-blocking or `-1` if it could not be changed.
+ */
+static int setNonBlocking(int nFileDescriptor) {
+  int nFlags = fcntl(nFileDescriptor, F_GETFL, 0);
+
+  if (nFlags < 0) return -1;
+
+  return fcntl(nFileDescriptor, F_SETFL, nFlags | O_NONBLOCK);
+}
+
+/** Raises the limit on open file descriptors as high as it goes, since every session holds one. */
+static void raiseFileDescriptorLimit(void) {
+  struct rlimit fileDescriptorLimit;
+
+  if (getrlimit(RLIMIT_NOFILE, &fileDescriptorLimit) != 0) return;
+
+  fileDescriptorLimit.rlim_cur = fileDescriptorLimit.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &fileDescriptorLimit);
+}
+
+/**
+ * Clears the way for a listener on the passed Unix socket path. Only a socket that nothing listens on anymore, which a
+ * server that did not exit cleanly leaves behind, is removed; anything else at the path is left alone.
+ * @param pSocketAddress The address of the socket.
+ * @returns `0` if the path is free or `-1` if it holds something other than a stale socket.
+ */
+static int removeStaleUnixSocket(const struct sockaddr_un *pSocketAddress) {
+  struct stat fileStatus;
+
+  if (lstat(pSocketAddress->sun_path, &fileStatus) != 0) return errno == ENOENT ? 0 : -1;
+
+  if (!S_ISSOCK(fileStatus.st_mode)) {
+    fprintf(stderr, "%s is not a socket, so it is left alone.\n", pSocketAddress->sun_path);
+
+    return -1;
+  }
+
+  int nFileDescriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+
+  if (nFileDescriptor < 0) return -1;
+
+  int nConnectStatus = connect(nFileDescriptor, (const struct sockaddr *)pSocketAddress, sizeof(*pSocketAddress));
+  int nConnectError = errno;
+
+  close(nFileDescriptor);
+
+  if (nConnectStatus == 0) {
+    fprintf(stderr, "%s is in use by another server.\n", pSocketAddress->sun_path);
+
+    return -1;
+  }
+
+  if (nConnectError == ENOENT) return 0;
+
+  if (nConnectError != ECONNREFUSED) return -1;
+
+  return unlink(pSocketAddress->sun_path) == 0 || errno == ENOENT ? 0 : -1;
+}
+
+/**
+ * Opens a non-blocking socket that listens on the passed Unix socket path, replacing a stale socket left there.
+ * @param strSocketPath The path of the socket.
+ * @returns The file descriptor of the socket, or `-1` if it could not be opened.
+ */
+static int openUnixListener(const char *strSocketPath) {
+  struct sockaddr_un socketAddress;
+  int nFileDescriptor;
+
+  if (strlen(strSocketPath) >= sizeof(socketAddress.sun_path)) return -1;
+
+  memset(&socketAddress, 0, sizeof(socketAddress));
+  socketAddress.sun_family = AF_UNIX;
+  strcpy(socketAddress.sun_path, strSocketPath);
+
+  if (removeStaleUnixSocket(&socketAddress) != 0) return -1;
+
+  if ((nFileDescriptor = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) return -1;
+
+  if (bind(nFileDescriptor, (struct sockaddr *)&socketAddress, sizeof(socketAddress)) != 0 ||
+      listen(nFileDescriptor, SERVER_LISTEN_BACKLOG) != 0 || setNonBlocking(nFileDescriptor) != 0) {
+    close(nFileDescriptor);
+
+    return -1;
+  }
+
+  return nFileDescriptor;
+}
+
+/**
+ * Opens a non-blocking socket that listens on the passed IPv4 address and TCP port. Every worker opens its own, which
+ * the kernel spreads new connections across.
+ * @param strHost The IPv4 address to listen on.
+ * @param nPort The TCP port to listen on.
+ * @returns The file descriptor of the socket, or `-1` if it could not be opened.
+ */
+static int openTcpListener(const char *strHost, int nPort) {
+  struct sockaddr_in socketAddress;
+  int nFileDescriptor;
+  int bIsReusingAddress = 1;
+  int bIsReusingPort = 1;
+
+  memset(&socketAddress, 0, sizeof(socketAddress));
+  socketAddress.sin_family = AF_INET;
+  socketAddress.sin_port = htons((uint16_t)nPort);
+
+  if (inet_pton(AF_INET, strHost, &socketAddress.sin_addr) != 1) return -1;
+
+  if ((nFileDescriptor = socket(AF_INET, SOCK_STREAM, 0)) < 0) return -1;
+
+  setsockopt(nFileDescriptor, SOL_SOCKET, SO_REUSEADDR, &bIsReusingAddress, sizeof(bIsReusingAddress));
+
+  if (setsockopt(nFileDescriptor, SOL_SOCKET, SO_REUSEPORT, &bIsReusingPort, sizeof(bIsReusingPort)) != 0) {
+    close(nFileDescriptor);
+
+    return -1;
+  }
+
+  if (bind(nFileDescriptor, (struct sockaddr *)&socketAddress, sizeof(socketAddress)) != 0 ||
+      listen(nFileDescriptor, SERVER_LISTEN_BACKLOG) != 0 || setNonBlocking(nFileDescriptor) != 0) {
+    close(nFileDescriptor);
+
+    return -1;
+  }
+
+  return nFileDescriptor;
+}
+
+/**
+ * Closes the passed connection and returns everything it holds to the server's pools.
+ * @param[in,out] pServer The server that the connection belongs to.
+ * @param[in,out] pServerConnection The connection to close.
+ */
+static void closeServerConnection(Server *pServer, ServerConnection *pServerConnection) {
+  // Closing the socket also removes it from the epoll instance, since no other descriptor refers to it.
+  close(pServerConnection->nFileDescriptor);
+  resetSessionArena(&pServerConnection->pendingOutput, &pServer->chunkPool);
+  freeSlabSlot(&pServer->connectionPool, pServerConnection);
+
+  pServer->serverStatistics.nOpenCount--;
+}
+
+/**
+ * Sends as much of the output kept in the connection's arena as the socket takes without waiting.
+ * @param[in,out] pServer The server that the connection belongs to.
+ * @param[in,out] pServerConnection The connection to send to.
+ * @returns `0` if the socket took what it could or `-1` if the connection is broken.
+ */
+static int sendPendingServerOutput(Server *pServer, ServerConnection *pServerConnection) {
+  const char *pOutput;
+  size_t nOutputLength;
+
+  while ((pOutput = peekSessionArena(&pServerConnection->pendingOutput, &nOutputLength)) != NULL) {
+    ssize_t nWrittenCount = write(pServerConnection->nFileDescriptor, pOutput, nOutputLength);
+
+    if (nWrittenCount < 0 && errno == EINTR) continue;
+
+    if (nWrittenCount < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return 0;
+
+    if (nWrittenCount < 0) return -1;
+
+    consumeSessionArena(&pServerConnection->pendingOutput, &pServer->chunkPool, (size_t)nWrittenCount);
+    pServer->serverStatistics.nSentByteCount += (uint64_t)nWrittenCount;
+  }
+
+  if (isMetricsRecording()) pServerConnection->nFrameSentNanoseconds = getMonotonicNanoseconds();
+
+  return 0;
+}
+
+/**
+ * Sends the frame rendered into the server's sink to the player with as few writes as the socket allows, then keeps
+ * what the socket did not take in the connection's arena until it can take more.
+ * @param[in,out] pServer The server that the connection belongs to.
+ * @param[in,out] pServerConnection The connection to send to.
+ * @returns `0` if the frame was sent or kept or `-1` if the connection is broken.
+ */
+static int sendServerOutput(Server *pServer, ServerConnection *pServerConnection) {
+  const char *pOutput = pServer->outputSink.pBuffer;
+  size_t nOutputLength = pServer->outputSink.nLength;
+  size_t nSentLength = 0;
+
+  // Output kept from before must be sent first, so a new frame waits behind it.
+  while (pServerConnection->pendingOutput.pFirstChunk == NULL && nSentLength < nOutputLength) {
+    ssize_t nWrittenCount = write(pServerConnection->nFileDescriptor, pOutput + nSentLength,
+                                  nOutputLength - nSentLength);
+
+    if (nWrittenCount < 0 && errno == EINTR) continue;
+
+    if (nWrittenCount < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+
+    if (nWrittenCount < 0) return -1;
+
+    nSentLength += (size_t)nWrittenCount;
+    pServer->serverStatistics.nSentByteCount += (uint64_t)nWrittenCount;
+  }
+
+  if (nSentLength == nOutputLength) {
+    if (isMetricsRecording()) pServerConnection->nFrameSentNanoseconds = getMonotonicNanoseconds();
+
+    return 0;
+  }
+
+  pServer->serverStatistics.nBlockedWriteCount++;
+
+  return appendSessionArena(&pServerConnection->pendingOutput, &pServer->chunkPool, pOutput + nSentLength,
+                            nOutputLength - nSentLength);
+}
+
+/**
+ * Updates which events the epoll instance waits for on the passed connection. A connection with output left to send
+ * waits until it can send more instead of reading further answers, which holds back players who do not read.
+ * @param pServer The server that the connection belongs to.
+ * @param pServerConnection The connection to update.
+ * @returns `0` if the events were updated or `-1` if they could not be.
+ */
+static int updateServerConnectionEvents(const Server *pServer, ServerConnection *pServerConnection) {
+  struct epoll_event event;
+
+  event.events = pServerConnection->pendingOutput.pFirstChunk != NULL ? EPOLLOUT : EPOLLIN;
+  event.data.ptr = pServerConnection;
+
+  return epoll_ctl(pServer->nEpollFileDescriptor, EPOLL_CTL_MOD, pServerConnection->nFileDescriptor, &event);
+}
+
+/**
+ * Feeds every complete answer in the connection's input to its game, each of which ends at whitespace. An answer too
+ * long for the input buffer is fed cut short, which the game rejects, and the rest of it is skipped.
+ * @param[in,out] pServer The server that the connection belongs to.
+ * @param[in,out] pServerConnection The connection whose answers to feed.
+ */
+static void feedServerInput(Server *pServer, ServerConnection *pServerConnection) {
+  char *strInput = pServerConnection->strInput;
+  size_t nTokenStart = 0;
+  size_t nInputIndex;
+
+  for (nInputIndex = 0; nInputIndex < pServerConnection->nInputLength && !pServerConnection->bIsGameOver;
+       nInputIndex++) {
+    if (!isspace((unsigned char)strInput[nInputIndex])) continue;
+
+    if (nInputIndex > nTokenStart && !pServerConnection->bIsSkippingToken) {
+      pServerConnection->bIsGameOver = feedGameSession(&pServerConnection->gameSession, strInput + nTokenStart,
+                                                       nInputIndex - nTokenStart);
+      pServer->serverStatistics.nAnswerCount++;
+    }
+
+    pServerConnection->bIsSkippingToken = 0;
+    nTokenStart = nInputIndex + 1;
+  }
+
+  if (pServerConnection->bIsGameOver) {
+    pServerConnection->nInputLength = 0;
+
+    return;
+  }
+
+  size_t nTokenLength = pServerConnection->nInputLength - nTokenStart;
+
+  if (nTokenLength == SERVER_INPUT_BUFFER_SIZE && !pServerConnection->bIsSkippingToken) {
+    pServerConnection->bIsGameOver = feedGameSession(&pServerConnection->gameSession, strInput, nTokenLength);
+    pServer->serverStatistics.nAnswerCount++;
+  }
+
+  if (nTokenLength == SERVER_INPUT_BUFFER_SIZE) {
+    pServerConnection->bIsSkippingToken = 1;
+    nTokenLength = 0;
+  }
+
+  memmove(strInput, strInput + nTokenStart, nTokenLength);
+  pServerConnection->nInputLength = nTokenLength;
+}
+
+/**
+ * Prints out the end screen of a game that is over to the current output sink.
+ * @param pGameSession The game that is over.
+ */
+static void printServerGameEnd(const GameSession *pGameSession) {
+  const GameState *pGameState = &pGameSession->gameState;
+
+  printGameEndScreen(pGameState->nPlayerProfit, pGameState->nPlayerProfitTarget, pGameState->nPlayerBalance,
+                     pGameState->nPlayerInitialBalance, pGameState->nPlayerTurns);
+}
+
+/**
+ * Accepts every connection waiting on the listener and starts a game for each of them, as long as there is room.
+ * @param[in,out] pServer The server to accept for.
+ */
+static void acceptServerConnections(Server *pServer) {
+  ServerStatistics *pServerStatistics = &pServer->serverStatistics;
+  int nFileDescriptor;
+  int bIsDelayingNothing = 1;
+
+  while ((nFileDescriptor = accept(pServer->nListenerFileDescriptor, NULL, NULL)) >= 0) {
+    ServerConnection *pServerConnection = NULL;
+    struct epoll_event event;
+
+    if (pServerStatistics->nOpenCount < pServer->nMaximumSessionCount && setNonBlocking(nFileDescriptor) == 0) {
+      pServerConnection = allocateSlabSlot(&pServer->connectionPool);
+    }
+
+    if (pServerConnection == NULL) {
+      close(nFileDescriptor);
+      pServerStatistics->nRejectedCount++;
+
+      continue;
+    }
+
+    // Every frame is sent with a single write, which must not wait to be merged with the next one. Unix sockets have
+    // no such delay, so failing to turn it off is harmless.
+    setsockopt(nFileDescriptor, IPPROTO_TCP, TCP_NODELAY, &bIsDelayingNothing, sizeof(bIsDelayingNothing));
+
+    memset(pServerConnection, 0, sizeof(ServerConnection));
+    pServerConnection->nFileDescriptor = nFileDescriptor;
+    openSessionArena(&pServerConnection->pendingOutput);
+
+    event.events = EPOLLIN;
+    event.data.ptr = pServerConnection;
+
+    if (epoll_ctl(pServer->nEpollFileDescriptor, EPOLL_CTL_ADD, nFileDescriptor, &event) != 0) {
+      close(nFileDescriptor);
+      freeSlabSlot(&pServer->connectionPool, pServerConnection);
+      pServerStatistics->nRejectedCount++;
+
+      continue;
+    }
+
+    pServerStatistics->nAcceptedCount++;
+    pServerStatistics->nOpenCount++;
+
+    if (pServerStatistics->nOpenCount > pServerStatistics->nMaximumOpenCount) {
+      pServerStatistics->nMaximumOpenCount = pServerStatistics->nOpenCount;
+    }
+
+    clearOutputSink(&pServer->outputSink);
+    printOutput("Game seed: %llu\n", (unsigned long long)pServer->nNextSeed);
+    startGameSession(&pServerConnection->gameSession, pServer->nNextSeed, NULL);
+    pServer->nNextSeed += pServer->nSeedStep;
+
+    if (sendServerOutput(pServer, pServerConnection) != 0 ||
+        updateServerConnectionEvents(pServer, pServerConnection) != 0) {
+      closeServerConnection(pServer, pServerConnection);
+    }
+  }
+}
+
+/**
+ * Handles the events of a single connection: reading and feeding its answers, then sending the frames they drew.
+ * @param[in,out] pServer The server that the connection belongs to.
+ * @param[in,out] pServerConnection The connection whose events to handle.
+ * @param nEvents The events that occurred.
+ */
+static void handleServerConnection(Server *pServer, ServerConnection *pServerConnection, uint32_t nEvents) {
+  if (nEvents & EPOLLOUT) {
+    if (sendPendingServerOutput(pServer, pServerConnection) != 0) {
+      closeServerConnection(pServer, pServerConnection);
+
+      return;
+    }
+  } else if (nEvents & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+    ssize_t nReadCount = read(pServerConnection->nFileDescriptor,
+                              pServerConnection->strInput + pServerConnection->nInputLength,
+                              SERVER_INPUT_BUFFER_SIZE - pServerConnection->nInputLength);
+
+    if (nReadCount < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return;
+
+    if (nReadCount <= 0) {
+      closeServerConnection(pServer, pServerConnection);
+
+      return;
+    }
+
+    pServerConnection->nInputLength += (size_t)nReadCount;
+    pServer->serverStatistics.nReceivedByteCount += (uint64_t)nReadCount;
+
+    // Only the first read after a frame is the player's answer to it, rather than the rest of one already sent.
+    if (pServerConnection->nFrameSentNanoseconds != 0) {
+      recordMetricsHistogram(INPUT_WAIT_METRICS_HISTOGRAM,
+                             getMonotonicNanoseconds() - pServerConnection->nFrameSentNanoseconds);
+      pServerConnection->nFrameSentNanoseconds = 0;
+    }
+
+    // The sink is the scratch memory of every frame, so it is emptied before each one is rendered into it.
+    clearOutputSink(&pServer->outputSink);
+    feedServerInput(pServer, pServerConnection);
+
+    if (pServerConnection->bIsGameOver) {
+      printServerGameEnd(&pServerConnection->gameSession);
+      pServer->serverStatistics.nCompletedGameCount++;
+    }
+
+    if (sendServerOutput(pServer, pServerConnection) != 0) {
+      closeServerConnection(pServer, pServerConnection);
+
+      return;
+    }
+  }
+
+  // A finished game is closed once its end screen has been sent in full.
+  if (pServerConnection->bIsGameOver && pServerConnection->pendingOutput.pFirstChunk == NULL) {
+    closeServerConnection(pServer, pServerConnection);
+  } else if (updateServerConnectionEvents(pServer, pServerConnection) != 0) {
+    closeServerConnection(pServer, pServerConnection);
+  }
+}
+
+/**
+ * Copies the statistics of the worker, the occupancy of its pools, and its metrics to where the supervisor reads them.
+ * @param[in,out] pServer The worker to publish.
+ */
+static void publishServerReport(Server *pServer) {
+  ServerStatistics *pServerStatistics = &pServer->serverStatistics;
+
+  pServerStatistics->nUsedSessionSlotCount = pServer->connectionPool.nUsedSlotCount;
+  pServerStatistics->nMaximumUsedSessionSlotCount = pServer->connectionPool.nMaximumUsedSlotCount;
+  pServerStatistics->nSessionSlotCount = getSlabSlotCount(&pServer->connectionPool);
+  pServerStatistics->nUsedArenaChunkCount = pServer->chunkPool.nUsedSlotCount;
+  pServerStatistics->nMaximumUsedArenaChunkCount = pServer->chunkPool.nMaximumUsedSlotCount;
+  pServerStatistics->nArenaChunkCount = getSlabSlotCount(&pServer->chunkPool);
+
+  pServer->pPublishedReport->serverStatistics = *pServerStatistics;
+  copyMetrics(&pServer->pPublishedReport->metricsSnapshot);
+}
+
+/**
+ * Runs a worker's event loop until it is asked to stop, accepting connections on its listener and playing their games.
+ * @param[in,out] pServer The worker to run, whose listener, seeds, session limit, and published report are set.
+ * @param pWaitSignals The signal mask to wait for events with, which unblocks the signals that stop the worker.
+ * @returns `0` if the worker stopped when asked or `1` if its event loop could not start or failed.
+ */
+static int runServerWorker(Server *pServer, const sigset_t *pWaitSignals) {
+  struct epoll_event listenerEvent;
+
+  // Workers that share a listener are woken one at a time instead of all racing to accept the same connection.
+  pServer->nEpollFileDescriptor = epoll_create1(0);
+  listenerEvent.events = EPOLLIN | EPOLLEXCLUSIVE;
+  listenerEvent.data.ptr = NULL;
+
+  if (pServer->nEpollFileDescriptor < 0 ||
+      epoll_ctl(pServer->nEpollFileDescriptor, EPOLL_CTL_ADD, pServer->nListenerFileDescriptor, &listenerEvent) != 0 ||
+      openMemoryOutputSink(&pServer->outputSink) != 0) {
+    fprintf(stderr, "Could not start the event loop.\n");
+
+    return 1;
+  }
+
+  openSlabPool(&pServer->connectionPool, sizeof(ServerConnection));
+  openSlabPool(&pServer->chunkPool, ARENA_CHUNK_SIZE);
+
+  // Every game renders into the same memory sink, which is sent to its player before the next game renders into it.
+  setOutputSink(&pServer->outputSink);
+  setMetricsRecording(1);
+
+  struct epoll_event events[SERVER_EVENT_COUNT];
+  int nStatus = 0;
+
+  while (!bIsStopping) {
+    int nEventCount = epoll_pwait(pServer->nEpollFileDescriptor, events, SERVER_EVENT_COUNT, -1, pWaitSignals);
+
+    if (nEventCount < 0 && errno == EINTR) continue;
+
+    if (nEventCount < 0) {
+      nStatus = 1;
+
+      break;
+    }
+
+    for (int nEventIndex = 0; nEventIndex < nEventCount; nEventIndex++) {
+      if (events[nEventIndex].data.ptr == NULL) {
+        acceptServerConnections(pServer);
+      } else {
+        handleServerConnection(pServer, events[nEventIndex].data.ptr, events[nEventIndex].events);
+      }
+    }
+
+    publishServerReport(pServer);
+  }
+
+  publishServerReport(pServer);
+
+  close(pServer->nEpollFileDescriptor);
+  close(pServer->nListenerFileDescriptor);
+  closeOutputSink(&pServer->outputSink);
+  closeSlabPool(&pServer->chunkPool);
+  closeSlabPool(&pServer->connectionPool);
+
+  return nStatus;
+}
+
+/**
+ * Prints out the statistics of every worker and their totals, followed by the metrics of every worker added up, to the
+ * standard error stream.
+ * @param pWorkerReports The reports that every worker has published.
+ * @param nWorkerCount The number of workers.
+ * @note The peaks of the totals are the sums of every worker's peak, which need not have been reached at once.
+ */
+static void printServerReport(const ServerReport *pWorkerReports, int nWorkerCount) {
+  static MetricsSnapshot metricsSnapshot;
+  ServerStatistics serverStatistics;
+
+  memset(&metricsSnapshot, 0, sizeof(metricsSnapshot));
+  memset(&serverStatistics, 0, sizeof(serverStatistics));
+
+  for (int nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+    const ServerStatistics *pServerStatistics = &pWorkerReports[nWorkerIndex].serverStatistics;
+
+    addMetricsSnapshot(&metricsSnapshot, &pWorkerReports[nWorkerIndex].metricsSnapshot);
+
+    serverStatistics.nAcceptedCount += pServerStatistics->nAcceptedCount;
+    serverStatistics.nRejectedCount += pServerStatistics->nRejectedCount;
+    serverStatistics.nCompletedGameCount += pServerStatistics->nCompletedGameCount;
+    serverStatistics.nOpenCount += pServerStatistics->nOpenCount;
+    serverStatistics.nMaximumOpenCount += pServerStatistics->nMaximumOpenCount;
+    serverStatistics.nAnswerCount += pServerStatistics->nAnswerCount;
+    serverStatistics.nBlockedWriteCount += pServerStatistics->nBlockedWriteCount;
+    serverStatistics.nReceivedByteCount += pServerStatistics->nReceivedByteCount;
+    serverStatistics.nSentByteCount += pServerStatistics->nSentByteCount;
+    serverStatistics.nUsedSessionSlotCount += pServerStatistics->nUsedSessionSlotCount;
+    serverStatistics.nMaximumUsedSessionSlotCount += pServerStatistics->nMaximumUsedSessionSlotCount;
+    serverStatistics.nSessionSlotCount += pServerStatistics->nSessionSlotCount;
+    serverStatistics.nUsedArenaChunkCount += pServerStatistics->nUsedArenaChunkCount;
+    serverStatistics.nMaximumUsedArenaChunkCount += pServerStatistics->nMaximumUsedArenaChunkCount;
+    serverStatistics.nArenaChunkCount += pServerStatistics->nArenaChunkCount;
+
+    fprintf(stderr, "Worker %d: %ld accepted | %ld open | %ld games completed | %ld answers\n", nWorkerIndex + 1,
+            pServerStatistics->nAcceptedCount, pServerStatistics->nOpenCount, pServerStatistics->nCompletedGameCount,
+            pServerStatistics->nAnswerCount);
+  }
+
+  fprintf(stderr, "Sessions: %ld accepted | %ld rejected | %ld open | %ld at most | %ld games completed\n",
+          serverStatistics.nAcceptedCount, serverStatistics.nRejectedCount, serverStatistics.nOpenCount,
+          serverStatistics.nMaximumOpenCount, serverStatistics.nCompletedGameCount);
+  fprintf(stderr, "Answers: %ld | Received: %llu bytes | Sent: %llu bytes | Blocked writes: %ld\n",
+          serverStatistics.nAnswerCount, (unsigned long long)serverStatistics.nReceivedByteCount,
+          (unsigned long long)serverStatistics.nSentByteCount, serverStatistics.nBlockedWriteCount);
+  fprintf(stderr, "Session slots: %ld used | %ld at most | %ld allocated | %lu bytes each\n",
+          serverStatistics.nUsedSessionSlotCount, serverStatistics.nMaximumUsedSessionSlotCount,
+          serverStatistics.nSessionSlotCount, (unsigned long)getSlabSlotSize(sizeof(ServerConnection)));
+  fprintf(stderr, "Arena chunks: %ld used | %ld at most | %ld allocated | %d bytes each\n",
+          serverStatistics.nUsedArenaChunkCount, serverStatistics.nMaximumUsedArenaChunkCount,
+          serverStatistics.nArenaChunkCount, ARENA_CHUNK_SIZE);
+  writeMetricsSnapshot(stderr, &metricsSnapshot, TEXT_METRICS_FORMAT_ID);
+}
+
+/**
+ * Prints out how to use the server to the console.
+ * @param strProgramName The name the server was run with.
+ */
+static void printServerUsage(const char *strProgramName) {
+  fprintf(stderr,
+          "Usage: %s (--unix PATH | --port N [--host ADDRESS]) [--workers N] [--seed N] [--max-sessions N]\n",
+          strProgramName);
+}
+
+int main(int argc, char *argv[]) {
+  const char *strSocketPath = NULL;
+  const char *strHost = DEFAULT_SERVER_HOST;
+  int nPort = 0;
+  long nProcessorCount = sysconf(_SC_NPROCESSORS_ONLN);
+  int nWorkerCount = nProcessorCount > 0 ? (int)nProcessorCount : 1;
+  uint64_t nBaseSeed = DEFAULT_SERVER_SEED;
+  long nMaximumSessionCount = DEFAULT_SERVER_MAXIMUM_SESSION_COUNT;
+
+  for (int nArgumentIndex = 1; nArgumentIndex < argc; nArgumentIndex++) {
+    const char *strOption = argv[nArgumentIndex];
+
+    if (nArgumentIndex + 1 >= argc) {
+      printServerUsage(argv[0]);
+
+      return 1;
+    }
+
+    const char *strValue = argv[++nArgumentIndex];
+
+    if (strcmp(strOption, "--unix") == 0) {
+      strSocketPath = strValue;
+    } else if (strcmp(strOption, "--port") == 0) {
+      char *pEnd;
+      long nParsedPort = strtol(strValue, &pEnd, 10);
+
+      if (!isdigit((unsigned char)strValue[0]) || *pEnd != '\0' || nParsedPort < 1 || nParsedPort > 65535) {
+        printServerUsage(argv[0]);
+
+        return 1;
+      }
+
+      nPort = (int)nParsedPort;
+    } else if (strcmp(strOption, "--host") == 0) {
+      strHost = strValue;
+    } else if (strcmp(strOption, "--workers") == 0) {
+      nWorkerCount = atoi(strValue);
+    } else if (strcmp(strOption, "--seed") == 0) {
+      if (parseRandomSeed(strValue, &nBaseSeed) != 0) {
+        printServerUsage(argv[0]);
+
+        return 1;
+      }
+    } else if (strcmp(strOption, "--max-sessions") == 0) {
+      nMaximumSessionCount = strtol(strValue, NULL, 10);
+    } else {
+      printServerUsage(argv[0]);
+
+      return 1;
+    }
+  }
+
+  if ((strSocketPath == NULL) == (nPort <= 0) || nWorkerCount < 1 || nMaximumSessionCount < 1) {
+    printServerUsage(argv[0]);
+
+    return 1;
+  }
+
+  raiseFileDescriptorLimit();
+
+  // A Unix socket cannot share its path between listeners, so its workers share a single listener instead.
+  int nListenerCount = strSocketPath != NULL ? 1 : nWorkerCount;
+  int *nListenerFileDescriptors = malloc(sizeof(int) * (size_t)nListenerCount);
+  pid_t *nWorkerProcessIds = calloc((size_t)nWorkerCount, sizeof(pid_t));
+  ServerReport *pWorkerReports = mmap(NULL, sizeof(ServerReport) * (size_t)nWorkerCount, PROT_READ | PROT_WRITE,
+                                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+  if (nListenerFileDescriptors == NULL || nWorkerProcessIds == NULL || pWorkerReports == MAP_FAILED) {
+    fprintf(stderr, "Could not allocate the server.\n");
+    free(nListenerFileDescriptors);
+    free(nWorkerProcessIds);
+
+    return 1;
+  }
+
+  int nOpenListenerCount;
+
+  for (nOpenListenerCount = 0; nOpenListenerCount < nListenerCount; nOpenListenerCount++) {
+    int nFileDescriptor = strSocketPath != NULL ? openUnixListener(strSocketPath) : openTcpListener(strHost, nPort);
+
+    if (nFileDescriptor < 0) break;
+
+    nListenerFileDescriptors[nOpenListenerCount] = nFileDescriptor;
+  }
+
+  if (nOpenListenerCount < nListenerCount) {
+    fprintf(stderr, "Could not listen on %s.\n", strSocketPath != NULL ? strSocketPath : strHost);
+
+    while (nOpenListenerCount > 0) close(nListenerFileDescriptors[--nOpenListenerCount]);
+
+    free(nListenerFileDescriptors);
+    free(nWorkerProcessIds);
+    munmap(pWorkerReports, sizeof(ServerReport) * (size_t)nWorkerCount);
+
+    return 1;
+  }
+
+  struct sigaction stopAction;
+  struct sigaction reportAction;
+  struct sigaction childAction;
+  sigset_t supervisorSignals;
+  sigset_t workerSignals;
+
+  memset(&stopAction, 0, sizeof(stopAction));
+  stopAction.sa_handler = stopServer;
+  sigemptyset(&stopAction.sa_mask);
+  sigaction(SIGINT, &stopAction, NULL);
+  sigaction(SIGTERM, &stopAction, NULL);
+
+  memset(&reportAction, 0, sizeof(reportAction));
+  reportAction.sa_handler = requestServerReport;
+  sigemptyset(&reportAction.sa_mask);
+  sigaction(SIGUSR1, &reportAction, NULL);
+
+  memset(&childAction, 0, sizeof(childAction));
+  childAction.sa_handler = wakeServerSupervisor;
+  sigemptyset(&childAction.sa_mask);
+  sigaction(SIGCHLD, &childAction, NULL);
+  signal(SIGPIPE, SIG_IGN);
+
+  // Signals are only taken while waiting, so none of them can slip in between checking for them and waiting.
+  sigemptyset(&supervisorSignals);
+  sigaddset(&supervisorSignals, SIGINT);
+  sigaddset(&supervisorSignals, SIGTERM);
+  sigaddset(&supervisorSignals, SIGUSR1);
+  sigaddset(&supervisorSignals, SIGCHLD);
+  sigprocmask(SIG_BLOCK, &supervisorSignals, &workerSignals);
+
+  if (strSocketPath != NULL) {
+    fprintf(stderr, "Listening on %s with %d workers of up to %ld sessions of %lu bytes.\n", strSocketPath,
+            nWorkerCount, nMaximumSessionCount, (unsigned long)getSlabSlotSize(sizeof(ServerConnection)));
+  } else {
+    fprintf(stderr, "Listening on %s:%d with %d workers of up to %ld sessions of %lu bytes.\n", strHost, nPort,
+            nWorkerCount, nMaximumSessionCount, (unsigned long)getSlabSlotSize(sizeof(ServerConnection)));
+  }
+
+  int nLiveWorkerCount = 0;
+
+  for (int nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+    pid_t nProcessId = fork();
+
+    if (nProcessId == 0) {
+      // Each worker owns its sessions, pools, and statistics, and only the listener it accepts on.
+      static Server server;
+
+      for (int nListenerIndex = 0; nListenerIndex < nListenerCount; nListenerIndex++) {
+        if (nListenerIndex != nWorkerIndex % nListenerCount) close(nListenerFileDescriptors[nListenerIndex]);
+      }
+
+      server.nListenerFileDescriptor = nListenerFileDescriptors[nWorkerIndex % nListenerCount];
+      server.nNextSeed = nBaseSeed + (uint64_t)nWorkerIndex;
+      server.nSeedStep = (uint64_t)nWorkerCount;
+      server.nMaximumSessionCount = nMaximumSessionCount;
+      server.pPublishedReport = &pWorkerReports[nWorkerIndex];
+
+      signal(SIGUSR1, SIG_IGN);
+      signal(SIGCHLD, SIG_DFL);
+
+      _exit(runServerWorker(&server, &workerSignals));
+    }
+
+    if (nProcessId < 0) {
+      fprintf(stderr, "Could only start %d workers.\n", nLiveWorkerCount);
+      bIsStopping = 1;
+
+      break;
+    }
+
+    nWorkerProcessIds[nWorkerIndex] = nProcessId;
+    nLiveWorkerCount++;
+  }
+
+  // Only the workers accept connections, so a listener is closed as soon as the last worker using it exits.
+  for (int nListenerIndex = 0; nListenerIndex < nListenerCount; nListenerIndex++) {
+    close(nListenerFileDescriptors[nListenerIndex]);
+  }
+
+  int nStatus = 0;
+  int bHasStoppedWorkers = 0;
+
+  while (nLiveWorkerCount > 0) {
+    pid_t nProcessId;
+    int nWorkerStatus;
+
+    while ((nProcessId = waitpid(-1, &nWorkerStatus, WNOHANG)) > 0) {
+      for (int nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+        if (nWorkerProcessIds[nWorkerIndex] == nProcessId) nWorkerProcessIds[nWorkerIndex] = 0;
+      }
+
+      if (!WIFEXITED(nWorkerStatus) || WEXITSTATUS(nWorkerStatus) != 0) nStatus = 1;
+
+      nLiveWorkerCount--;
+    }
+
+    if (bIsStopping && !bHasStoppedWorkers) {
+      for (int nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+        if (nWorkerProcessIds[nWorkerIndex] > 0) kill(nWorkerProcessIds[nWorkerIndex], SIGTERM);
+      }
+
+      bHasStoppedWorkers = 1;
+    }
+
+    if (bIsReportRequested) {
+      bIsReportRequested = 0;
+      printServerReport(pWorkerReports, nWorkerCount);
+    }
+
+    if (nLiveWorkerCount > 0) sigsuspend(&workerSignals);
+  }
+
+  printServerReport(pWorkerReports, nWorkerCount);
+
+  free(nListenerFileDescriptors);
+  free(nWorkerProcessIds);
+  munmap(pWorkerReports, sizeof(ServerReport) * (size_t)nWorkerCount);
+
+  if (strSocketPath != NULL) unlink(strSocketPath);
+
+  return nStatus;
+}
@@ -0,0 +1,460 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _XOPEN_SOURCE 700
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "clock.h"
+#include "scripted_player.h"
+
+#define DEFAULT_SESSION_GAME_PATH "./a.out"
+#define DEFAULT_SESSION_GAME_COUNT 1
+#define DEFAULT_SESSION_SEED 1
+
+#define SESSION_FRAME_BUFFER_SIZE 262144
+#define SESSION_MAXIMUM_INPUT_COUNT 4096
+#define SESSION_POLL_MILLISECONDS 1
+#define SESSION_LATENCY_BUCKET_COUNT 24
+
+/** The totals of every frame of a single kind. */
+typedef struct {
+  long nFrameCount;
+  double nTotalLatencySeconds;
+  double nMaximumLatencySeconds;
+  long nTotalByteCount;
+  long nMaximumByteCount;
+  long nTotalSyscallCount;
+} FrameKindStatistics;
+
+/** The game played under the pseudo-terminal, along with the output of the frame that it is currently drawing. */
+typedef struct {
+  pid_t nProcessId;
+  int nMasterFileDescriptor;
+  char strFrame[SESSION_FRAME_BUFFER_SIZE];
+  size_t nFrameLength;
+  long nFrameByteCount;
+  double nLastOutputSeconds;
+  int bHasExited;
+} TerminalSession;
+
+/**
+ * Starts the game under a new pseudo-terminal whose echo is turned off, so that only the game's own output is read.
+ * @param[out] pTerminalSession The session to start.
+ * @param strGamePath The path of the game's executable.
+ * @param strSeed The seed to pass to the game.
+ * @param bIsRenderingDifferentially Whether or not to pass `--diff-render` to the game.
+ * @returns `0` if the game was started or `-1` if it could not be.
+ */
+static int startTerminalSession(TerminalSession *pTerminalSession, const char *strGamePath, const char *strSeed,
+                                int bIsRenderingDifferentially) {
+  int nMasterFileDescriptor = posix_openpt(O_RDWR | O_NOCTTY);
+
+  if (nMasterFileDescriptor < 0) return -1;
+
+  if (grantpt(nMasterFileDescriptor) != 0 || unlockpt(nMasterFileDescriptor) != 0) {
+    close(nMasterFileDescriptor);
+
+    return -1;
+  }
+
+  const char *strSlavePath = ptsname(nMasterFileDescriptor);
+  pid_t nProcessId = strSlavePath != NULL ? fork() : -1;
+
+  if (nProcessId < 0) {
+    close(nMasterFileDescriptor);
+
+    return -1;
+  }
+
+  if (nProcessId == 0) {
+    int nSlaveFileDescriptor;
+    struct termios terminalAttributes;
+
+    close(nMasterFileDescriptor);
+    setsid();
+
+    if ((nSlaveFileDescriptor = open(strSlavePath, O_RDWR)) < 0) _exit(127);
+
+    if (tcgetattr(nSlaveFileDescriptor, &terminalAttributes) == 0) {
+      terminalAttributes.c_lflag &= ~(tcflag_t)(ECHO | ECHONL);
+      tcsetattr(nSlaveFileDescriptor, TCSANOW, &terminalAttributes);
+    }
+
+    dup2(nSlaveFileDescriptor, STDIN_FILENO);
+    dup2(nSlaveFileDescriptor, STDOUT_FILENO);
+    dup2(nSlaveFileDescriptor, STDERR_FILENO);
+
+    if (nSlaveFileDescriptor > STDERR_FILENO) close(nSlaveFileDescriptor);
+
+    if (bIsRenderingDifferentially) {
+      execl(strGamePath, strGamePath, "--seed", strSeed, "--diff-render", (char *)NULL);
+    } else {
+      execl(strGamePath, strGamePath, "--seed", strSeed, (char *)NULL);
+    }
+
+    _exit(127);
+  }
+
+  pTerminalSession->nProcessId = nProcessId;
+  pTerminalSession->nMasterFileDescriptor = nMasterFileDescriptor;
+  pTerminalSession->nFrameLength = 0;
+  pTerminalSession->nFrameByteCount = 0;
+  pTerminalSession->nLastOutputSeconds = getMonotonicNanoseconds() / 1e9;
+  pTerminalSession->bHasExited = 0;
+
+  return 0;
+}
+
+/**
+ * Checks whether the game is asleep, which it only is while it waits for input once its frame has been written.
+ * @param nProcessId The ID of the game's process.
+ * @returns `1` if the game is asleep or could not be inspected, or `0` if it is still running.
+ */
+static int isTerminalSessionAsleep(pid_t nProcessId) {
+  char strPath[64];
+  char strStatus[512];
+  FILE *pStatusFile;
+
+  snprintf(strPath, sizeof(strPath), "/proc/%ld/stat", (long)nProcessId);
+
+  if ((pStatusFile = fopen(strPath, "r")) == NULL) return 1;
+
+  size_t nStatusLength = fread(strStatus, 1, sizeof(strStatus) - 1, pStatusFile);
+
+  fclose(pStatusFile);
+  strStatus[nStatusLength] = '\0';
+
+  // The state follows the executable's name, which is wrapped in parentheses and may hold spaces of its own.
+  const char *strState = strrchr(strStatus, ')');
+
+  return strState == NULL || strState[1] == '\0' || strState[2] == 'S';
+}
+
+/**
+ * Gets the number of read and write system calls that the game has made so far.
+ * @param nProcessId The ID of the game's process.
+ * @returns The number of system calls, or `-1` if the game could not be inspected.
+ */
+static long getTerminalSessionSyscallCount(pid_t nProcessId) {
+  char strPath[64];
+  char strLine[128];
+  FILE *pInputOutputFile;
+  long nSyscallCount = 0;
+  long nCount;
+
+  snprintf(strPath, sizeof(strPath), "/proc/%ld/io", (long)nProcessId);
+
+  if ((pInputOutputFile = fopen(strPath, "r")) == NULL) return -1;
+
+  while (fgets(strLine, sizeof(strLine), pInputOutputFile) != NULL) {
+    if (sscanf(strLine, "syscr: %ld", &nCount) == 1 || sscanf(strLine, "syscw: %ld", &nCount) == 1) {
+      nSyscallCount += nCount;
+    }
+  }
+
+  fclose(pInputOutputFile);
+
+  return nSyscallCount;
+}
+
+/**
+ * Reads the game's output until it has finished its frame, which it has once it has written something and is asleep
+ * waiting for input with nothing left to read, or once it has exited.
+ * @param[in,out] pTerminalSession The session to read from.
+ */
+static void awaitTerminalSessionFrame(TerminalSession *pTerminalSession) {
+  struct pollfd pollFileDescriptor = {pTerminalSession->nMasterFileDescriptor, POLLIN, 0};
+  char strBuffer[4096];
+
+  while (!pTerminalSession->bHasExited) {
+    int nReadyCount = poll(&pollFileDescriptor, 1, SESSION_POLL_MILLISECONDS);
+
+    if (nReadyCount < 0 && errno != EINTR) {
+      pTerminalSession->bHasExited = 1;
+    } else if (nReadyCount > 0) {
+      ssize_t nReadCount = read(pTerminalSession->nMasterFileDescriptor, strBuffer, sizeof(strBuffer));
+
+      if (nReadCount <= 0) {
+        // Reading the master fails with `EIO` once the game has exited and closed every copy of the slave.
+        pTerminalSession->bHasExited = 1;
+      } else {
+        size_t nCopiedCount = (size_t)nReadCount;
+
+        if (nCopiedCount > SESSION_FRAME_BUFFER_SIZE - 1 - pTerminalSession->nFrameLength) {
+          nCopiedCount = SESSION_FRAME_BUFFER_SIZE - 1 - pTerminalSession->nFrameLength;
+        }
+
+        memcpy(pTerminalSession->strFrame + pTerminalSession->nFrameLength, strBuffer, nCopiedCount);
+        pTerminalSession->nFrameLength += nCopiedCount;
+        pTerminalSession->strFrame[pTerminalSession->nFrameLength] = '\0';
+        pTerminalSession->nFrameByteCount += nReadCount;
+        pTerminalSession->nLastOutputSeconds = getMonotonicNanoseconds() / 1e9;
+      }
+    } else if (pTerminalSession->nFrameByteCount > 0 && isTerminalSessionAsleep(pTerminalSession->nProcessId)) {
+      return;
+    }
+  }
+}
+
+/**
+ * Gets the index of the latency histogram bucket that holds the passed latency, where every bucket is twice as wide as
+ * the one before it, starting from one microsecond.
+ * @param nLatencySeconds The latency.
+ * @returns The index of the bucket.
+ */
+static int getLatencyBucketIndex(double nLatencySeconds) {
+  int nBucketIndex = 0;
+
+  for (double nBucketLimit = 2e-6; nLatencySeconds >= nBucketLimit && nBucketIndex < SESSION_LATENCY_BUCKET_COUNT - 1;
+       nBucketLimit *= 2) {
+    nBucketIndex++;
+  }
+
+  return nBucketIndex;
+}
+
+/**
+ * Compares two latencies for sorting them in ascending order.
+ * @param pFirstLatency The first latency.
+ * @param pSecondLatency The second latency.
+ * @returns A negative value, zero, or a positive value if the first latency is shorter than, equal to, or longer than
+ * the second.
+ */
+static int compareLatencies(const void *pFirstLatency, const void *pSecondLatency) {
+  double nFirstLatency = *(const double *)pFirstLatency;
+  double nSecondLatency = *(const double *)pSecondLatency;
+
+  return (nFirstLatency > nSecondLatency) - (nFirstLatency < nSecondLatency);
+}
+
+/**
+ * Prints out how to use the session benchmark to the console.
+ * @param strProgramName The name the session benchmark was run with.
+ */
+static void printSessionUsage(const char *strProgramName) {
+  fprintf(stderr, "Usage: %s [--game PATH] [--games N] [--seed N] [--render full|diff]\n", strProgramName);
+}
+
+int main(int argc, char *argv[]) {
+  const char *strGamePath = DEFAULT_SESSION_GAME_PATH;
+  long nGameCount = DEFAULT_SESSION_GAME_COUNT;
+  unsigned long long nBaseSeed = DEFAULT_SESSION_SEED;
+  int bIsRenderingDifferentially = 0;
+
+  for (int nArgumentIndex = 1; nArgumentIndex < argc; nArgumentIndex++) {
+    const char *strOption = argv[nArgumentIndex];
+
+    if (nArgumentIndex + 1 >= argc) {
+      printSessionUsage(argv[0]);
+
+      return 1;
+    }
+
+    const char *strValue = argv[++nArgumentIndex];
+
+    if (strcmp(strOption, "--game") == 0) {
+      strGamePath = strValue;
+    } else if (strcmp(strOption, "--games") == 0) {
+      nGameCount = strtol(strValue, NULL, 10);
+    } else if (strcmp(strOption, "--seed") == 0) {
+      nBaseSeed = strtoull(strValue, NULL, 10);
+    } else if (strcmp(strOption, "--render") == 0 && strcmp(strValue, "full") == 0) {
+      bIsRenderingDifferentially = 0;
+    } else if (strcmp(strOption, "--render") == 0 && strcmp(strValue, "diff") == 0) {
+      bIsRenderingDifferentially = 1;
+    } else {
+      printSessionUsage(argv[0]);
+
+      return 1;
+    }
+  }
+
+  if (nGameCount < 1) {
+    printSessionUsage(argv[0]);
+
+    return 1;
+  }
+
+  TerminalSession *pTerminalSession = malloc(sizeof(TerminalSession));
+  double *nLatencies = malloc(sizeof(double) * SESSION_MAXIMUM_INPUT_COUNT * nGameCount);
+  FrameKindStatistics frameKindStatistics[FRAME_KIND_COUNT] = {{0}};
+  long nLatencyBucketCounts[SESSION_LATENCY_BUCKET_COUNT] = {0};
+  long nFrameCount = 0;
+  int bHasSyscallCounts = 1;
+
+  if (pTerminalSession == NULL || nLatencies == NULL) {
+    fprintf(stderr, "Could not allocate the session benchmark.\n");
+    free(pTerminalSession);
+    free(nLatencies);
+
+    return 1;
+  }
+
+  signal(SIGPIPE, SIG_IGN);
+
+  for (long nGameIndex = 0; nGameIndex < nGameCount; nGameIndex++) {
+    char strSeed[32];
+    int nDayStep = 0;
+    long nInputCount = 0;
+
+    snprintf(strSeed, sizeof(strSeed), "%llu", nBaseSeed + (unsigned long long)nGameIndex);
+
+    if (startTerminalSession(pTerminalSession, strGamePath, strSeed, bIsRenderingDifferentially) != 0) {
+      fprintf(stderr, "Could not start %s under a pseudo-terminal.\n", strGamePath);
+      free(pTerminalSession);
+      free(nLatencies);
+
+      return 1;
+    }
+
+    // The first frame is drawn without any input, so it only primes the session.
+    awaitTerminalSessionFrame(pTerminalSession);
+
+    while (!pTerminalSession->bHasExited && nInputCount < SESSION_MAXIMUM_INPUT_COUNT) {
+      const char *strPromptText;
+      const ScriptedPrompt *pPrompt = findScriptedPrompt(pTerminalSession->strFrame, &strPromptText);
+      char strAnswer[SCRIPTED_ANSWER_SIZE];
+
+      if (pPrompt == NULL) {
+        fprintf(stderr, "The game stopped at a frame without a known prompt.\n");
+
+        break;
+      }
+
+      chooseScriptedAnswer(pPrompt, strPromptText, &nDayStep, strAnswer);
+      strcat(strAnswer, "\n");
+
+      long nStartSyscallCount = getTerminalSessionSyscallCount(pTerminalSession->nProcessId);
+
+      pTerminalSession->nFrameLength = 0;
+      pTerminalSession->nFrameByteCount = 0;
+      pTerminalSession->strFrame[0] = '\0';
+
+      double nInputSeconds = getMonotonicNanoseconds() / 1e9;
+
+      if (write(pTerminalSession->nMasterFileDescriptor, strAnswer, strlen(strAnswer)) < 0) break;
+
+      awaitTerminalSessionFrame(pTerminalSession);
+
+      long nEndSyscallCount = getTerminalSessionSyscallCount(pTerminalSession->nProcessId);
+      double nLatencySeconds = pTerminalSession->nLastOutputSeconds - nInputSeconds;
+      const char *strNextPromptText;
+      const ScriptedPrompt *pNextPrompt = findScriptedPrompt(pTerminalSession->strFrame, &strNextPromptText);
+      int nFrameKind = pTerminalSession->bHasExited || pNextPrompt == NULL ? END_FRAME_KIND : pNextPrompt->nFrameKind;
+      FrameKindStatistics *pFrameKindStatistics = &frameKindStatistics[nFrameKind];
+
+      if (nLatencySeconds < 0) nLatencySeconds = 0;
+
+      if (nStartSyscallCount < 0 || nEndSyscallCount < 0) bHasSyscallCounts = 0;
+
+      pFrameKindStatistics->nFrameCount++;
+      pFrameKindStatistics->nTotalLatencySeconds += nLatencySeconds;
+      pFrameKindStatistics->nTotalByteCount += pTerminalSession->nFrameByteCount;
+      pFrameKindStatistics->nTotalSyscallCount += nEndSyscallCount - nStartSyscallCount;
+
+      if (nLatencySeconds > pFrameKindStatistics->nMaximumLatencySeconds) {
+        pFrameKindStatistics->nMaximumLatencySeconds = nLatencySeconds;
+      }
+
+      if (pTerminalSession->nFrameByteCount > pFrameKindStatistics->nMaximumByteCount) {
+        pFrameKindStatistics->nMaximumByteCount = pTerminalSession->nFrameByteCount;
+      }
+
+      nLatencies[nFrameCount++] = nLatencySeconds;
+      nLatencyBucketCounts[getLatencyBucketIndex(nLatencySeconds)]++;
+      nInputCount++;
+    }
+
+    if (!pTerminalSession->bHasExited) kill(pTerminalSession->nProcessId, SIGTERM);
+
+    waitpid(pTerminalSession->nProcessId, NULL, 0);
+    close(pTerminalSession->nMasterFileDescriptor);
+  }
+
+  if (nFrameCount == 0) {
+    fprintf(stderr, "The game did not draw any frames.\n");
+    free(pTerminalSession);
+    free(nLatencies);
+
+    return 1;
+  }
+
+  qsort(nLatencies, (size_t)nFrameCount, sizeof(double), compareLatencies);
+
+  printf("Game: %s | Games: %ld | Seed: %llu | Render: %s\n", strGamePath, nGameCount, nBaseSeed,
+         bIsRenderingDifferentially ? "diff" : "full");
+  printf("Frames: %ld | Input to frame: p50 %.1f us | p90 %.1f us | p99 %.1f us | max %.1f us\n", nFrameCount,
+         nLatencies[nFrameCount / 2] * 1e6, nLatencies[nFrameCount * 9 / 10] * 1e6,
+         nLatencies[nFrameCount * 99 / 100] * 1e6, nLatencies[nFrameCount - 1] * 1e6);
+
+  printf("\n");
+
+  printf("%-16s %6s %12s %12s %10s %10s %10s\n", "Frame", "count", "mean us", "max us", "mean B", "max B",
+         bHasSyscallCounts ? "syscalls" : "syscalls?");
+
+  for (int nFrameKind = 0; nFrameKind < FRAME_KIND_COUNT; nFrameKind++) {
+    const FrameKindStatistics *pFrameKindStatistics = &frameKindStatistics[nFrameKind];
+
+    if (pFrameKindStatistics->nFrameCount == 0) continue;
+
+    printf("%-16s %6ld %12.1f %12.1f %10.0f %10ld %10.1f\n", getFrameKindName(nFrameKind),
+           pFrameKindStatistics->nFrameCount,
+           pFrameKindStatistics->nTotalLatencySeconds * 1e6 / pFrameKindStatistics->nFrameCount,
+           pFrameKindStatistics->nMaximumLatencySeconds * 1e6,
+           (double)pFrameKindStatistics->nTotalByteCount / pFrameKindStatistics->nFrameCount,
+           pFrameKindStatistics->nMaximumByteCount,
+           (double)pFrameKindStatistics->nTotalSyscallCount / pFrameKindStatistics->nFrameCount);
+  }
+
+  printf("\n");
+
+  printf("Input to frame latency:\n");
+
+  long nMaximumBucketCount = 1;
+
+  for (int nBucketIndex = 0; nBucketIndex < SESSION_LATENCY_BUCKET_COUNT; nBucketIndex++) {
+    if (nLatencyBucketCounts[nBucketIndex] > nMaximumBucketCount) {
+      nMaximumBucketCount = nLatencyBucketCounts[nBucketIndex];
+    }
+  }
+
+  for (int nBucketIndex = 0; nBucketIndex < SESSION_LATENCY_BUCKET_COUNT; nBucketIndex++) {
+    if (nLatencyBucketCounts[nBucketIndex] == 0) continue;
+
+    int nBarLength = (int)(nLatencyBucketCounts[nBucketIndex] * 50 / nMaximumBucketCount);
+
+    printf("  < %9ld us %6ld %.*s\n", 2L << nBucketIndex, nLatencyBucketCounts[nBucketIndex],
+           nBarLength > 0 ? nBarLength : 1, "##################################################");
+  }
+
+  free(pTerminalSession);
+  free(nLatencies);
+
+  return 0;
+}
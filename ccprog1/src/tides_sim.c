@@ -0,0 +1,230 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <inttypes.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "clock.h"
+#include "policy.h"
+#include "prompts.h"
+#include "simulation.h"
+#include "solver.h"
+#include "thread_pool.h"
+
+#define DEFAULT_SIMULATED_GAME_COUNT 1000000
+#define DEFAULT_SIMULATED_INITIAL_BALANCE 1000
+#define DEFAULT_SIMULATED_PROFIT_TARGET 100
+#define DEFAULT_SIMULATED_BATCH_SIZE 1024
+
+/**
+ * Prints out how to use the simulator to the console.
+ * @param strProgramName The name the simulator was run with.
+ */
+static void printSimulatorUsage(const char *strProgramName) {
+  fprintf(stderr,
+          "Usage: %s [--games N] [--threads N] [--policy random|greedy|solved] [--balance N] [--target N]\n"
+          "       [--seed N] [--batch-size N] [--verify N] [--table FILE]\n",
+          strProgramName);
+}
+
+/**
+ * Prints out the share of games whose final profit falls within the passed range to the console.
+ * @param pSimulationSummary The summary to inspect.
+ * @param strLabel The label of the range.
+ * @param nMinimumProfit The inclusive lower bound of the range.
+ * @param nMaximumProfit The inclusive upper bound of the range.
+ * @note Profits of `1000` and above are only known to three significant digits, so ranges there are approximate.
+ */
+static void printProfitRangeShare(const SimulationSummary *pSimulationSummary, const char *strLabel,
+                                  int nMinimumProfit, int nMaximumProfit) {
+  long nRangeCount = 0;
+
+  for (int nProfitIndex = 0; nProfitIndex < SIMULATION_PROFIT_BUCKET_COUNT; nProfitIndex++) {
+    int nProfit = getSimulationIndexProfit(nProfitIndex);
+
+    if (nProfit >= nMinimumProfit && nProfit <= nMaximumProfit) {
+      nRangeCount += pSimulationSummary->nProfitCounts[nProfitIndex];
+    }
+  }
+
+  printf("  %-24s %6.2f%%\n", strLabel, nRangeCount * 100.0 / pSimulationSummary->nGameCount);
+}
+
+/**
+ * Gets the name of the passed policy, which is the same name that `--policy` accepts.
+ * @param cPolicyId The ID of the policy.
+ * @returns The name of the policy.
+ */
+static const char *getPolicyName(char cPolicyId) {
+  if (cPolicyId == GREEDY_POLICY_ID) {
+    return "greedy";
+  } else if (cPolicyId == SOLVED_POLICY_ID) {
+    return "solved";
+  } else {
+    return "random";
+  }
+}
+
+int main(int argc, char *argv[]) {
+  long nGameCount = DEFAULT_SIMULATED_GAME_COUNT;
+  int nWorkerCount = getProcessorCount();
+  char cPolicyId = GREEDY_POLICY_ID;
+  int nPlayerInitialBalance = DEFAULT_SIMULATED_INITIAL_BALANCE;
+  int nPlayerProfitTarget = DEFAULT_SIMULATED_PROFIT_TARGET;
+  uint64_t nBaseSeed = (uint64_t)time(NULL);
+  int nBatchSize = DEFAULT_SIMULATED_BATCH_SIZE;
+  long nVerifiedGameCount = 0;
+  const char *strTableFilePath = NULL;
+
+  for (int nArgumentIndex = 1; nArgumentIndex < argc; nArgumentIndex++) {
+    const char *strOption = argv[nArgumentIndex];
+
+    if (nArgumentIndex + 1 >= argc) {
+      printSimulatorUsage(argv[0]);
+
+      return 1;
+    }
+
+    const char *strValue = argv[++nArgumentIndex];
+
+    if (strcmp(strOption, "--games") == 0) {
+      nGameCount = strtol(strValue, NULL, 10);
+    } else if (strcmp(strOption, "--threads") == 0) {
+      nWorkerCount = atoi(strValue);
+    } else if (strcmp(strOption, "--policy") == 0 && strcmp(strValue, "random") == 0) {
+      cPolicyId = RANDOM_POLICY_ID;
+    } else if (strcmp(strOption, "--policy") == 0 && strcmp(strValue, "greedy") == 0) {
+      cPolicyId = GREEDY_POLICY_ID;
+    } else if (strcmp(strOption, "--policy") == 0 && strcmp(strValue, "solved") == 0) {
+      cPolicyId = SOLVED_POLICY_ID;
+    } else if (strcmp(strOption, "--table") == 0) {
+      strTableFilePath = strValue;
+    } else if (strcmp(strOption, "--balance") == 0) {
+      nPlayerInitialBalance = atoi(strValue);
+    } else if (strcmp(strOption, "--target") == 0) {
+      nPlayerProfitTarget = atoi(strValue);
+    } else if (strcmp(strOption, "--seed") == 0) {
+      if (parseRandomSeed(strValue, &nBaseSeed) != 0) {
+        printSimulatorUsage(argv[0]);
+
+        return 1;
+      }
+    } else if (strcmp(strOption, "--batch-size") == 0) {
+      nBatchSize = atoi(strValue);
+    } else if (strcmp(strOption, "--verify") == 0) {
+      nVerifiedGameCount = strtol(strValue, NULL, 10);
+    } else {
+      printSimulatorUsage(argv[0]);
+
+      return 1;
+    }
+  }
+
+  if (nGameCount < 1 || nWorkerCount < 1 || nPlayerInitialBalance < MINIMUM_INITIAL_BALANCE ||
+      nPlayerProfitTarget < MINIMUM_TARGET_PROFIT || nBatchSize < 0 || nVerifiedGameCount < 0 ||
+      (cPolicyId == SOLVED_POLICY_ID && strTableFilePath == NULL)) {
+    printSimulatorUsage(argv[0]);
+
+    return 1;
+  }
+
+  if (nVerifiedGameCount > 0) {
+    long nMismatchCount = verifyBatchSimulation(nVerifiedGameCount, nBatchSize > 0 ? nBatchSize : 1,
+                                                nPlayerInitialBalance, nPlayerProfitTarget, nBaseSeed);
+
+    if (nMismatchCount != 0) {
+      fprintf(stderr, "Batched games differ from scalar games: %ld of %ld\n", nMismatchCount, nVerifiedGameCount);
+
+      return 1;
+    }
+
+    printf("Verified %ld batched games against the scalar engine.\n", nVerifiedGameCount);
+  }
+
+  SolvedPolicy solvedPolicy = {{0}, NULL};
+
+  if (cPolicyId == SOLVED_POLICY_ID && loadSolvedPolicy(&solvedPolicy, strTableFilePath) != 0) {
+    fprintf(stderr, "Could not load the policy table %s.\n", strTableFilePath);
+
+    return 1;
+  }
+
+  // Only the greedy policy has a batched version, since the random policy draws from a second generator per game.
+  int bIsBatched = nBatchSize > 0 && cPolicyId == GREEDY_POLICY_ID;
+  SimulationSummary *pSimulationSummary = malloc(sizeof(SimulationSummary));
+
+  if (pSimulationSummary == NULL) {
+    destroySolvedPolicy(&solvedPolicy);
+
+    return 1;
+  }
+
+  uint64_t nStartNanoseconds = getMonotonicNanoseconds();
+  int nStatus = bIsBatched ? runBatchSimulation(pSimulationSummary, nGameCount, nBatchSize, nWorkerCount,
+                                                 nPlayerInitialBalance, nPlayerProfitTarget, nBaseSeed)
+                           : runSimulation(pSimulationSummary, cPolicyId, &solvedPolicy, nGameCount, nWorkerCount,
+                                           nPlayerInitialBalance, nPlayerProfitTarget, nBaseSeed);
+
+  destroySolvedPolicy(&solvedPolicy);
+
+  if (nStatus != 0) {
+    fprintf(stderr, "Could not start the simulation.\n");
+    free(pSimulationSummary);
+
+    return 1;
+  }
+
+  double nElapsedSeconds = (getMonotonicNanoseconds() - nStartNanoseconds) / 1e9;
+
+  printf("Policy: %s | Games: %ld | Threads: %d | Seed: %" PRIu64 "\n",
+         getPolicyName(cPolicyId), nGameCount, nWorkerCount, nBaseSeed);
+  printf("Initial balance: %d | Profit target: %d%% | Batch size: %d\n", nPlayerInitialBalance, nPlayerProfitTarget,
+         bIsBatched ? nBatchSize : 1);
+  printf("Elapsed: %.3f s (%.0f games/s, %.1fM games/min)\n", nElapsedSeconds, nGameCount / nElapsedSeconds,
+         nGameCount / nElapsedSeconds * 60 / 1e6);
+
+  printf("\n");
+
+  printf("Win rate: %.2f%%\n", pSimulationSummary->nWinCount * 100.0 / pSimulationSummary->nGameCount);
+  printf("Final profit: min %d%% | mean %.1f%% | max %d%%\n", pSimulationSummary->nMinimumProfit,
+         (double)pSimulationSummary->nProfitSum / pSimulationSummary->nGameCount, pSimulationSummary->nMaximumProfit);
+  printf("Percentiles: p10 %d%% | p25 %d%% | p50 %d%% | p75 %d%% | p90 %d%% | p99 %d%%\n",
+         getSimulationProfitPercentile(pSimulationSummary, 10), getSimulationProfitPercentile(pSimulationSummary, 25),
+         getSimulationProfitPercentile(pSimulationSummary, 50), getSimulationProfitPercentile(pSimulationSummary, 75),
+         getSimulationProfitPercentile(pSimulationSummary, 90), getSimulationProfitPercentile(pSimulationSummary, 99));
+
+  printf("\n");
+
+  printf("Distribution against the target:\n");
+  printProfitRangeShare(pSimulationSummary, "loss (< 0%)", INT_MIN, -1);
+  printProfitRangeShare(pSimulationSummary, "short of target", 0, nPlayerProfitTarget - 1);
+  printProfitRangeShare(pSimulationSummary, "target to 2x target", nPlayerProfitTarget, nPlayerProfitTarget * 2 - 1);
+  printProfitRangeShare(pSimulationSummary, "2x to 4x target", nPlayerProfitTarget * 2, nPlayerProfitTarget * 4 - 1);
+  printProfitRangeShare(pSimulationSummary, "4x target and above", nPlayerProfitTarget * 4, INT_MAX);
+
+  free(pSimulationSummary);
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "clock.h"
+#include "prompts.h"
+#include "solver.h"
+#include "thread_pool.h"
+
+#define DEFAULT_SOLVED_INITIAL_BALANCE 1000
+#define DEFAULT_SOLVED_PROFIT_TARGET 100
+
+/**
+ * Prints out how to use the solver to the console.
+ * @param strProgramName The name the solver was run with.
+ */
+static void printSolverUsage(const char *strProgramName) {
+  fprintf(stderr, "Usage: %s [--threads N] [--balance N] [--target N] [--output FILE]\n", strProgramName);
+}
+
+int main(int argc, char *argv[]) {
+  int nWorkerCount = getProcessorCount();
+  int nPlayerInitialBalance = DEFAULT_SOLVED_INITIAL_BALANCE;
+  int nPlayerProfitTarget = DEFAULT_SOLVED_PROFIT_TARGET;
+  const char *strOutputFilePath = NULL;
+
+  for (int nArgumentIndex = 1; nArgumentIndex < argc; nArgumentIndex++) {
+    const char *strOption = argv[nArgumentIndex];
+
+    if (nArgumentIndex + 1 >= argc) {
+      printSolverUsage(argv[0]);
+
+      return 1;
+    }
+
+    const char *strValue = argv[++nArgumentIndex];
+
+    if (strcmp(strOption, "--threads") == 0) {
+      nWorkerCount = atoi(strValue);
+    } else if (strcmp(strOption, "--balance") == 0) {
+      nPlayerInitialBalance = atoi(strValue);
+    } else if (strcmp(strOption, "--target") == 0) {
+      nPlayerProfitTarget = atoi(strValue);
+    } else if (strcmp(strOption, "--output") == 0) {
+      strOutputFilePath = strValue;
+    } else {
+      printSolverUsage(argv[0]);
+
+      return 1;
+    }
+  }
+
+  if (nWorkerCount < 1 || nPlayerInitialBalance < MINIMUM_INITIAL_BALANCE ||
+      nPlayerProfitTarget < MINIMUM_TARGET_PROFIT) {
+    printSolverUsage(argv[0]);
+
+    return 1;
+  }
+
+  SolvedPolicy solvedPolicy;
+  uint64_t nStartNanoseconds = getMonotonicNanoseconds();
+
+  if (solveGame(&solvedPolicy, nWorkerCount) != 0) {
+    fprintf(stderr, "Could not solve the game.\n");
+
+    return 1;
+  }
+
+  double nElapsedSeconds = (getMonotonicNanoseconds() - nStartNanoseconds) / 1e9;
+  double nExpectedBalance = getSolvedExpectedBalance(&solvedPolicy, nPlayerInitialBalance);
+  double nExpectedProfit = (nExpectedBalance - nPlayerInitialBalance) * 100 / nPlayerInitialBalance;
+
+  printf("Solved %ld states in %.3f s with %d threads\n", (long)SOLVER_VALUE_COUNT, nElapsedSeconds, nWorkerCount);
+  printf("Initial balance: %d | Profit target: %d%%\n", nPlayerInitialBalance, nPlayerProfitTarget);
+  printf("Expected final balance: %.0f | Expected final profit: %.1f%% (%s the target)\n", nExpectedBalance,
+         nExpectedProfit, nExpectedProfit >= nPlayerProfitTarget ? "meets" : "misses");
+
+  if (strOutputFilePath != NULL) {
+    if (saveSolvedPolicy(&solvedPolicy, strOutputFilePath) != 0) {
+      fprintf(stderr, "Could not write the policy table %s.\n", strOutputFilePath);
+      destroySolvedPolicy(&solvedPolicy);
+
+      return 1;
+    }
+
+    printf("Policy table: %s\n", strOutputFilePath);
+  }
+
+  destroySolvedPolicy(&solvedPolicy);
+
+  return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "trace.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "clock.h"
+
+/** A single start or end of a span, which is timestamped in nanoseconds. */
+typedef struct {
+  const char *strName;
+  uint64_t nTimestamp;
+  char cPhase;
+} TraceEvent;
+
+/**
+ * The events of a single thread that have yet to be written, whose oldest event is at the start index. Each thread
+ * owns its buffer, so recording an event never waits on another thread.
+ */
+typedef struct {
+  TraceEvent events[TRACE_BUFFER_CAPACITY];
+  int nStartIndex;
+  int nEventCount;
+  int nThreadId;
+} TraceRing;
+
+static FILE *pTraceFile = NULL;
+static int nNextTraceThreadId = 0;
+static __thread TraceRing traceRing = {{{0}}, 0, 0, 0};
+
+/**
+ * Opens the file that traced spans are written to as Chrome trace-event JSON. Spans are discarded until it is opened.
+ * @param strFilePath The path of the file to write.
+ * @returns `0` if the file was opened or `-1` if it could not be.
+ */
+int openTraceFile(const char *strFilePath) {
+  if ((pTraceFile = fopen(strFilePath, "w")) == NULL) return -1;
+
+  fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", pTraceFile);
+
+  return 0;
+}
+
+/**
+ * Appends an event to the calling thread's ring buffer, which is written to the trace file whenever it fills up.
+ * @param strName The name of the span, which must outlive the trace.
+ * @param cPhase The Chrome trace-event phase, which is either `B` for the start of a span or `E` for its end.
+ */
+void recordTraceEvent(const char *strName, char cPhase) {
+  if (pTraceFile == NULL) return;
+
+  if (traceRing.nEventCount == TRACE_BUFFER_CAPACITY) flushTraceEvents();
+
+  TraceEvent *pTraceEvent = &traceRing.events[(traceRing.nStartIndex + traceRing.nEventCount) % TRACE_BUFFER_CAPACITY];
+
+  pTraceEvent->strName = strName;
+  pTraceEvent->nTimestamp = getMonotonicNanoseconds();
+  pTraceEvent->cPhase = cPhase;
+  traceRing.nEventCount++;
+}
+
+/** Writes the events buffered by the calling thread to the trace file, which threads must do before they exit. */
+void flushTraceEvents(void) {
+  if (pTraceFile == NULL || traceRing.nEventCount == 0) return;
+
+  if (traceRing.nThreadId == 0) traceRing.nThreadId = __atomic_add_fetch(&nNextTraceThreadId, 1, __ATOMIC_RELAXED);
+
+  // Each event is a single `fprintf`, which the C library locks, so events of different threads never interleave.
+  while (traceRing.nEventCount > 0) {
+    const TraceEvent *pTraceEvent = &traceRing.events[traceRing.nStartIndex];
+
+    fprintf(pTraceFile, "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":1,\"tid\":%d},\n",
+            pTraceEvent->strName, pTraceEvent->cPhase, (unsigned long long)(pTraceEvent->nTimestamp / 1000),
+            (unsigned)(pTraceEvent->nTimestamp % 1000), traceRing.nThreadId);
+
+    traceRing.nStartIndex = (traceRing.nStartIndex + 1) % TRACE_BUFFER_CAPACITY;
+    traceRing.nEventCount--;
+  }
+}
+
+/** Writes the events buffered by the calling thread to the trace file, then closes it. */
+void closeTraceFile(void) {
+  if (pTraceFile == NULL) return;
+
+  flushTraceEvents();
+
+  // Every event is followed by a comma, so the trace ends with an event that names the process.
+  fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Tides of Manila\"}}\n]}\n",
+        pTraceFile);
+  fclose(pTraceFile);
+  pTraceFile = NULL;
+}
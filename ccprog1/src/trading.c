@@ -18,16 +18,91 @@
 
 #include "trading.h"
 
-#include <stdlib.h>
+#include "prompts.h"
+
+const char PORT_IDS[PORT_COUNT] = {TONDO_PORT_ID, MANILA_PORT_ID, PANDAKAN_PORT_ID, SAPA_PORT_ID};
+const char CARGO_IDS[CARGO_COUNT] = {COCONUT_CARGO_ID, RICE_CARGO_ID, SILK_CARGO_ID, GUN_CARGO_ID};
+
+#define CARGO_PRICE_RANGE(PORT, CARGO) (PORT##_MAXIMUM_##CARGO##_PRICE - PORT##_MINIMUM_##CARGO##_PRICE + 1)
+
+const int MINIMUM_CARGO_PRICES[PORT_COUNT][CARGO_COUNT] = {
+  {TONDO_MINIMUM_COCONUT_PRICE, TONDO_MINIMUM_RICE_PRICE, TONDO_MINIMUM_SILK_PRICE, TONDO_MINIMUM_GUN_PRICE},
+  {MANILA_MINIMUM_COCONUT_PRICE, MANILA_MINIMUM_RICE_PRICE, MANILA_MINIMUM_SILK_PRICE, MANILA_MINIMUM_GUN_PRICE},
+  {PANDAKAN_MINIMUM_COCONUT_PRICE, PANDAKAN_MINIMUM_RICE_PRICE, PANDAKAN_MINIMUM_SILK_PRICE,
+   PANDAKAN_MINIMUM_GUN_PRICE},
+  {SAPA_MINIMUM_COCONUT_PRICE, SAPA_MINIMUM_RICE_PRICE, SAPA_MINIMUM_SILK_PRICE, SAPA_MINIMUM_GUN_PRICE}};
+const uint32_t CARGO_PRICE_RANGES[PORT_COUNT][CARGO_COUNT] = {
+  {CARGO_PRICE_RANGE(TONDO, COCONUT), CARGO_PRICE_RANGE(TONDO, RICE), CARGO_PRICE_RANGE(TONDO, SILK),
+   CARGO_PRICE_RANGE(TONDO, GUN)},
+  {CARGO_PRICE_RANGE(MANILA, COCONUT), CARGO_PRICE_RANGE(MANILA, RICE), CARGO_PRICE_RANGE(MANILA, SILK),
+   CARGO_PRICE_RANGE(MANILA, GUN)},
+  {CARGO_PRICE_RANGE(PANDAKAN, COCONUT), CARGO_PRICE_RANGE(PANDAKAN, RICE), CARGO_PRICE_RANGE(PANDAKAN, SILK),
+   CARGO_PRICE_RANGE(PANDAKAN, GUN)},
+  {CARGO_PRICE_RANGE(SAPA, COCONUT), CARGO_PRICE_RANGE(SAPA, RICE), CARGO_PRICE_RANGE(SAPA, SILK),
+   CARGO_PRICE_RANGE(SAPA, GUN)}};
+
+#undef CARGO_PRICE_RANGE
+
+/**
+ * Gets the index of the passed port within the list of all ports.
+ * @param cPortId The ID of the port.
+ * @pre @p cPortId must have a character value of `T`, `M`, `P`, or `S`.
+ * @returns An integer value within the range of `0` and `3`.
+ */
+int getPortIndex(char cPortId) {
+  int nPortIndex = 0;
+
+  while (nPortIndex < PORT_COUNT - 1 && PORT_IDS[nPortIndex] != cPortId) nPortIndex++;
+
+  return nPortIndex;
+}
+
+/**
+ * Gets the index of the passed cargo within the list of all cargo.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
+ * @returns An integer value within the range of `0` and `3`.
+ */
+int getCargoIndex(char cCargoId) {
+  int nCargoIndex = 0;
+
+  while (nCargoIndex < CARGO_COUNT - 1 && CARGO_IDS[nCargoIndex] != cCargoId) nCargoIndex++;
+
+  return nCargoIndex;
+}
+
+/**
+ * Generates a random market price for every cargo within the price ranges of the passed port.
+ * @param[in,out] pRandomGenerator The game's random number generator.
+ * @param nPortIndex The index of the port.
+ * @param[out] nCargoPrices The market price of each cargo, ordered by cargo index.
+ * @pre @p nPortIndex must have an integer value within the range of `0` and `3`.
+ */
+void generateCargoPrices(RandomGenerator *pRandomGenerator, int nPortIndex, int nCargoPrices[CARGO_COUNT]) {
+  uint32_t nRandomNumbers[CARGO_COUNT];
+
+  generateBoundedRandomNumbers(pRandomGenerator, CARGO_PRICE_RANGES[nPortIndex], nRandomNumbers, CARGO_COUNT);
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_COUNT; nCargoIndex++) {
+    nCargoPrices[nCargoIndex] = MINIMUM_CARGO_PRICES[nPortIndex][nCargoIndex] + (int)nRandomNumbers[nCargoIndex];
+  }
+}
 
 /**
- * Generates a random price within the passed minimum and maximum prices.
- * @param nMinimumPrice The minimum allowed price.
- * @param nMaximumPrice The maximum allowed price.
- * @returns An integer value within the range of `nMinimumPrice` and `nMaximumPrice`.
+ * Gets the minimum and maximum market prices of the passed cargo in the passed port.
+ * @param cPortId The ID of the port.
+ * @param cCargoId The ID of the cargo.
+ * @param[out] nMinimumPrice The minimum market price.
+ * @param[out] nMaximumPrice The maximum market price.
+ * @pre @p cPortId must have a character value of `T`, `M`, `P`, or `S`.
+ * @pre @p cCargoId must have a character value of `C`, `R`, `S`, or `G`.
  */
-int generateRandomPrice(int nMinimumPrice, int nMaximumPrice) {
-  return (rand() % (nMaximumPrice - nMinimumPrice + 1)) + nMinimumPrice;
+void getCargoPriceRange(char cPortId, char cCargoId, int *nMinimumPrice, int *nMaximumPrice) {
+  int nPortIndex = getPortIndex(cPortId);
+  int nCargoIndex = getCargoIndex(cCargoId);
+
+  *nMinimumPrice = MINIMUM_CARGO_PRICES[nPortIndex][nCargoIndex];
+  *nMaximumPrice = *nMinimumPrice + (int)CARGO_PRICE_RANGES[nPortIndex][nCargoIndex] - 1;
 }
 
 /**
@@ -0,0 +1,278 @@
+/*
+ * Tides of Manila: A Merchant's Quest is a turn-based CLI-based game.
+ * Copyright (C) 2024  CielSachen
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "transposition.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRANSPOSITION_GENERATION_SHIFT 56
+#define TRANSPOSITION_ACTION_INDEX_SHIFT 48
+#define TRANSPOSITION_DEPTH_SHIFT 32
+
+/**
+ * Mixes the bits of the passed word so that every input bit affects every output bit.
+ * @param nWord The word to mix.
+ * @returns The mixed word.
+ */
+static uint64_t mixHashBits(uint64_t nWord) {
+  nWord ^= nWord >> 33;
+  nWord *= 0xFF51AFD7ED558CCDULL;
+  nWord ^= nWord >> 33;
+  nWord *= 0xC4CEB9FE1A85EC53ULL;
+  nWord ^= nWord >> 33;
+
+  return nWord;
+}
+
+/**
+ * Packs the passed entry and generation into the data word of a slot, which is never `0` since the generation is not.
+ * @param transpositionEntry The entry to pack.
+ * @param nGeneration The generation the entry was stored in.
+ * @returns The data word of the slot.
+ */
+static uint64_t packTranspositionData(TranspositionEntry transpositionEntry, uint8_t nGeneration) {
+  uint32_t nValueBits;
+
+  memcpy(&nValueBits, &transpositionEntry.nValue, sizeof(nValueBits));
+
+  return (uint64_t)nGeneration << TRANSPOSITION_GENERATION_SHIFT |
+         (uint64_t)transpositionEntry.nActionIndex << TRANSPOSITION_ACTION_INDEX_SHIFT |
+         (uint64_t)transpositionEntry.nDepth << TRANSPOSITION_DEPTH_SHIFT | nValueBits;
+}
+
+/**
+ * Unpacks the entry from the data word of a slot.
+ * @param nData The data word of the slot.
+ * @param[out] pTranspositionEntry The unpacked entry.
+ */
+static void unpackTranspositionData(uint64_t nData, TranspositionEntry *pTranspositionEntry) {
+  uint32_t nValueBits = (uint32_t)nData;
+
+  memcpy(&pTranspositionEntry->nValue, &nValueBits, sizeof(nValueBits));
+  pTranspositionEntry->nDepth = (uint16_t)(nData >> TRANSPOSITION_DEPTH_SHIFT);
+  pTranspositionEntry->nActionIndex = (uint8_t)(nData >> TRANSPOSITION_ACTION_INDEX_SHIFT);
+}
+
+/**
+ * Gets the first slot of the bucket that the state with the passed hash belongs to.
+ * @param pTranspositionTable The table to look in.
+ * @param nHash The hash of the state.
+ * @returns The key word of the bucket's first slot, which is followed by its data word and then by the other slots.
+ */
+static uint64_t *getTranspositionBucket(const TranspositionTable *pTranspositionTable, uint64_t nHash) {
+  return &pTranspositionTable->pSlots[(nHash & pTranspositionTable->nBucketMask) * TRANSPOSITION_BUCKET_SIZE * 2];
+}
+
+/**
+ * Packs the decision-relevant state of the passed game.
+ * @param pGameState The game to pack.
+ * @param[out] pPackedGameState The packed state.
+ */
+void packGameState(const GameState *pGameState, PackedGameState *pPackedGameState) {
+  memset(pPackedGameState, 0, sizeof(PackedGameState));
+
+  pPackedGameState->nPlayerBalance = pGameState->nPlayerBalance;
+  pPackedGameState->nShipCargoAmounts[0] = (uint16_t)pGameState->nShipCoconutCargoAmount;
+  pPackedGameState->nShipCargoAmounts[1] = (uint16_t)pGameState->nShipRiceCargoAmount;
+  pPackedGameState->nShipCargoAmounts[2] = (uint16_t)pGameState->nShipSilkCargoAmount;
+  pPackedGameState->nShipCargoAmounts[3] = (uint16_t)pGameState->nShipGunCargoAmount;
+  pPackedGameState->nMarketPrices[0] = (uint16_t)pGameState->nCoconutMarketPrice;
+  pPackedGameState->nMarketPrices[1] = (uint16_t)pGameState->nRiceMarketPrice;
+  pPackedGameState->nMarketPrices[2] = (uint16_t)pGameState->nSilkMarketPrice;
+  pPackedGameState->nMarketPrices[3] = (uint16_t)pGameState->nGunMarketPrice;
+  pPackedGameState->nPlayerTurns = (uint8_t)pGameState->nPlayerTurns;
+  pPackedGameState->nPortAndShipTier =
+    (uint8_t)(getPortIndex(pGameState->cCurrentPortId) |
+              (pGameState->nShipCargoLimit / TIER_ONE_SHIP_CARGO_LIMIT - 1) << 2 | (pGameState->bIsQuitting != 0) << 4);
+  pPackedGameState->nStormTurnDuration = (int8_t)pGameState->nStormTurnDuration;
+  pPackedGameState->nStormWindSignalNumber = (uint8_t)pGameState->nStormWindSignalNumber;
+}
+
+/**
+ * Hashes the passed packed state.
+ * @param pPackedGameState The packed state to hash.
+ * @returns A 64-bit hash whose bits are all equally mixed.
+ */
+uint64_t hashPackedGameState(const PackedGameState *pPackedGameState) {
+  uint64_t nWords[3];
+
+  memcpy(nWords, pPackedGameState, sizeof(nWords));
+
+  // The three products are independent, so they overlap in the pipeline before the single final mix.
+  uint64_t nFirstWord = nWords[0] * 0x9E3779B97F4A7C15ULL;
+  uint64_t nSecondWord = nWords[1] * 0xC2B2AE3D27D4EB4FULL;
+  uint64_t nThirdWord = nWords[2] * 0x165667B19E3779F9ULL;
+
+  return mixHashBits(nFirstWord ^ (nSecondWord << 21 | nSecondWord >> 43) ^ (nThirdWord << 42 | nThirdWord >> 22));
+}
+
+/**
+ * Checks whether both packed states are the same.
+ * @param pFirstPackedGameState The first packed state.
+ * @param pSecondPackedGameState The second packed state.
+ * @returns `1` if the states are the same or `0` if they are not.
+ */
+int isPackedGameStateEqual(const PackedGameState *pFirstPackedGameState,
+                           const PackedGameState *pSecondPackedGameState) {
+  return memcmp(pFirstPackedGameState, pSecondPackedGameState, sizeof(PackedGameState)) == 0;
+}
+
+/**
+ * Allocates an empty table that holds at most the passed number of entries, rounded down to a power of two buckets.
+ * @param[out] pTranspositionTable The table to allocate.
+ * @param nEntryCount The maximum number of entries.
+ * @returns `0` if the table was allocated or `-1` if it could not be.
+ */
+int createTranspositionTable(TranspositionTable *pTranspositionTable, long nEntryCount) {
+  uint64_t nBucketCount = 1;
+
+  while (nBucketCount * 2 * TRANSPOSITION_BUCKET_SIZE <= (uint64_t)nEntryCount) nBucketCount *= 2;
+
+  memset(pTranspositionTable, 0, sizeof(TranspositionTable));
+
+  void *pSlots = NULL;
+
+  size_t nSlotArraySize = sizeof(uint64_t) * 2 * TRANSPOSITION_BUCKET_SIZE * nBucketCount;
+
+  if (posix_memalign(&pSlots, TRANSPOSITION_ALIGNMENT, nSlotArraySize) != 0) return -1;
+
+  pTranspositionTable->pSlots = pSlots;
+  pTranspositionTable->nBucketMask = nBucketCount - 1;
+
+  clearTranspositionTable(pTranspositionTable);
+
+  return 0;
+}
+
+/**
+ * Frees the slots of the passed table.
+ * @param[in,out] pTranspositionTable The table to free.
+ */
+void destroyTranspositionTable(TranspositionTable *pTranspositionTable) {
+  free(pTranspositionTable->pSlots);
+
+  pTranspositionTable->pSlots = NULL;
+}
+
+/**
+ * Empties the passed table and resets its counters.
+ * @param[in,out] pTranspositionTable The table to empty.
+ * @note This must not be called while other threads use the table.
+ */
+void clearTranspositionTable(TranspositionTable *pTranspositionTable) {
+  memset(pTranspositionTable->pSlots, 0,
+         sizeof(uint64_t) * 2 * TRANSPOSITION_BUCKET_SIZE * (pTranspositionTable->nBucketMask + 1));
+
+  pTranspositionTable->nGeneration = 1;
+  pTranspositionTable->nHitCount = 0;
+  pTranspositionTable->nMissCount = 0;
+  pTranspositionTable->nStoreCount = 0;
+  pTranspositionTable->nReplacementCount = 0;
+}
+
+/**
+ * Starts a new search generation, which makes every entry stored so far the first to be replaced.
+ * @param[in,out] pTranspositionTable The table whose generation to advance.
+ * @note This must not be called while other threads use the table.
+ */
+void advanceTranspositionGeneration(TranspositionTable *pTranspositionTable) {
+  // The generation skips `0` so that the data word of a stored entry is never mistaken for an empty slot.
+  pTranspositionTable->nGeneration =
+    pTranspositionTable->nGeneration == UINT8_MAX ? 1 : pTranspositionTable->nGeneration + 1;
+}
+
+/**
+ * Looks up the entry of the state with the passed hash.
+ * @param[in,out] pTranspositionTable The table to look in, whose hit or miss count is incremented.
+ * @param nHash The hash of the state.
+ * @param[out] pTranspositionEntry The entry of the state, which is only set if it was found.
+ * @returns `1` if the entry was found or `0` if it was not.
+ */
+int probeTranspositionTable(TranspositionTable *pTranspositionTable, uint64_t nHash,
+                            TranspositionEntry *pTranspositionEntry) {
+  uint64_t *pBucket = getTranspositionBucket(pTranspositionTable, nHash);
+
+  for (int nSlotIndex = 0; nSlotIndex < TRANSPOSITION_BUCKET_SIZE; nSlotIndex++) {
+    uint64_t nKey = __atomic_load_n(&pBucket[nSlotIndex * 2], __ATOMIC_RELAXED);
+    uint64_t nData = __atomic_load_n(&pBucket[nSlotIndex * 2 + 1], __ATOMIC_RELAXED);
+
+    if (nData != 0 && (nKey ^ nData) == nHash) {
+      unpackTranspositionData(nData, pTranspositionEntry);
+      __atomic_fetch_add(&pTranspositionTable->nHitCount, 1, __ATOMIC_RELAXED);
+
+      return 1;
+    }
+  }
+
+  __atomic_fetch_add(&pTranspositionTable->nMissCount, 1, __ATOMIC_RELAXED);
+
+  return 0;
+}
+
+/**
+ * Stores the entry of the state with the passed hash. An existing entry of the same state from the current generation
+ * is only overwritten by an entry of at least its depth.
+ * @param[in,out] pTranspositionTable The table to store in, whose store and replacement counts are incremented.
+ * @param nHash The hash of the state.
+ * @param transpositionEntry The entry to store.
+ */
+void storeTranspositionEntry(TranspositionTable *pTranspositionTable, uint64_t nHash,
+                             TranspositionEntry transpositionEntry) {
+  uint64_t *pBucket = getTranspositionBucket(pTranspositionTable, nHash);
+  uint8_t nGeneration = pTranspositionTable->nGeneration;
+  int nVictimSlotIndex = 0;
+  long nVictimPriority = -1;
+  int bIsReplacement = 0;
+
+  for (int nSlotIndex = 0; nSlotIndex < TRANSPOSITION_BUCKET_SIZE; nSlotIndex++) {
+    uint64_t nKey = __atomic_load_n(&pBucket[nSlotIndex * 2], __ATOMIC_RELAXED);
+    uint64_t nData = __atomic_load_n(&pBucket[nSlotIndex * 2 + 1], __ATOMIC_RELAXED);
+    int bIsCurrentGeneration = (uint8_t)(nData >> TRANSPOSITION_GENERATION_SHIFT) == nGeneration;
+    uint16_t nDepth = (uint16_t)(nData >> TRANSPOSITION_DEPTH_SHIFT);
+
+    if (nData != 0 && (nKey ^ nData) == nHash) {
+      if (bIsCurrentGeneration && nDepth > transpositionEntry.nDepth) return;
+
+      nVictimSlotIndex = nSlotIndex;
+      bIsReplacement = 0;
+
+      break;
+    }
+
+    // Empty slots go first, then entries from older generations, and then the shallowest entries.
+    long nPriority = nData == 0 ? LONG_MAX : (bIsCurrentGeneration ? 0 : UINT16_MAX + 1L) + UINT16_MAX - nDepth;
+
+    if (nPriority > nVictimPriority) {
+      nVictimSlotIndex = nSlotIndex;
+      nVictimPriority = nPriority;
+      bIsReplacement = nData != 0;
+    }
+  }
+
+  uint64_t nData = packTranspositionData(transpositionEntry, nGeneration);
+
+  __atomic_store_n(&pBucket[nVictimSlotIndex * 2], nHash ^ nData, __ATOMIC_RELAXED);
+  __atomic_store_n(&pBucket[nVictimSlotIndex * 2 + 1], nData, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&pTranspositionTable->nStoreCount, 1, __ATOMIC_RELAXED);
+
+  if (bIsReplacement) __atomic_fetch_add(&pTranspositionTable->nReplacementCount, 1, __ATOMIC_RELAXED);
+}
@@ -18,24 +18,27 @@
 
 #include "weather.h"
 
-#include <stdlib.h>
-
 /**
  * Generates a random boolean based on the passed chance of returning a `true`.
+ * @param[in,out] pRandomGenerator The game's random number generator.
  * @param nTruePercentChance The percentage chance of this function returning `1`.
  * @pre @p nTruePercentChance must have a positive integer value greater than or equal to  `1` and less than or equal to
  * `100`.
  * @returns `1` if `true` or `0` if `false`.
  */
-int generateRandomBool(int nTruePercentChance) { return (rand() % 100) + 1 <= nTruePercentChance; }
+int generateRandomBool(RandomGenerator *pRandomGenerator, int nTruePercentChance) {
+  return (int)generateBoundedRandomNumber(pRandomGenerator, 100) + 1 <= nTruePercentChance;
+}
 
 /**
  * Generates a random duration in turns for a storm within the passed minimum and constant maximum turn duration.
+ * @param[in,out] pRandomGenerator The game's random number generator.
  * @param nMinimumTurnDuration The minimum allowed duration in turns.
  * @returns An integer value within the range of `nMinimumTurnDuration` and `10`.
  */
-int generateRandomStormTurnDuration(int nMinimumTurnDuration) {
-  return (rand() % (MAXIMUM_STORM_TURN_DURATION - nMinimumTurnDuration + 1)) + nMinimumTurnDuration;
+int generateRandomStormTurnDuration(RandomGenerator *pRandomGenerator, int nMinimumTurnDuration) {
+  return (int)generateBoundedRandomNumber(pRandomGenerator, MAXIMUM_STORM_TURN_DURATION - nMinimumTurnDuration + 1) +
+         nMinimumTurnDuration;
 }
 
 /**